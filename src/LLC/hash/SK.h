@@ -424,6 +424,43 @@ namespace LLC
 
 		return hashKeccak;
 	}
+
+
+	/** SK1024Lanes
+     *
+     *  Get the number of messages the multi-buffer SK1024 hashes at once on this processor.
+     *
+     *  @return 8 with AVX-512, 4 with AVX2, otherwise 1 for the scalar fallback.
+     *
+     **/
+	uint32_t SK1024Lanes();
+
+
+	/** SK1024
+     *
+     *  1024-bit hashing of a batch of messages used to build Block Hashes in bulk. Messages with the
+     *  same number of blocks are hashed side by side in SIMD lanes, bypassing the hash cache.
+     *
+     *  @param[in] vData The messages to hash.
+     *  @param[out] vHashes The hash of each message, in the same order.
+     *  @param[in] nLanes The number of lanes to use, 0 for the widest supported.
+     *
+     **/
+	void SK1024(const std::vector<std::vector<uint8_t>>& vData, std::vector<uint1024_t>& vHashes, uint32_t nLanes = 0);
+
+
+	/** SK512Pairs
+     *
+     *  512-bit hashing of adjacent pairs of hashes used to build Merkle Trees in bulk, the same as
+     *  SK512 over the two hashes back to back. Pairs are hashed side by side in SIMD lanes.
+     *
+     *  @param[in] pHashes The hashes to pair up, 2 * nPairs of them.
+     *  @param[in] nPairs The number of pairs to hash.
+     *  @param[out] pParents The hash of each pair, nPairs of them.
+     *  @param[in] nLanes The number of lanes to use, 0 for the widest supported.
+     *
+     **/
+	void SK512Pairs(const uint512_t* pHashes, const uint32_t nPairs, uint512_t* pParents, uint32_t nLanes = 0);
 }
 
 #endif
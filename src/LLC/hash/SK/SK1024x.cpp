@@ -0,0 +1,308 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+#include <LLC/hash/SK/lanes.h>
+#include <LLC/hash/SK/skein_iv.h>
+
+#include <cstring>
+
+namespace LLC
+{
+
+#ifdef SK_LANES
+    namespace
+    {
+        using namespace lanes;
+
+
+        /* Skein MIX function on words A and B. */
+        #define MIX(A, B, ROT) { X[A] += X[B]; rotl<ROT>(X[B]); X[B] ^= X[A]; }
+
+
+        /* One Threefish-1024 round of eight MIX functions. */
+        #define ROUND1024(p0,p1,p2,p3,p4,p5,p6,p7,p8,p9,pA,pB,pC,pD,pE,pF,ROT) \
+            MIX(p0, p1, ROT##_0); MIX(p2, p3, ROT##_1);                        \
+            MIX(p4, p5, ROT##_2); MIX(p6, p7, ROT##_3);                        \
+            MIX(p8, p9, ROT##_4); MIX(pA, pB, ROT##_5);                        \
+            MIX(pC, pD, ROT##_6); MIX(pE, pF, ROT##_7);
+
+
+        /* Threefish-1024 key injection number S. */
+        #define INJECT1024(S)                                                  \
+            for(uint32_t i = 0; i < 16; ++i)                                   \
+                X[i] += ks[((S) + i) % 17];                                    \
+            X[13] += ts[(S) % 3];                                              \
+            X[14] += ts[((S) + 1) % 3];                                        \
+            X[15] += static_cast<uint64_t>(S);
+
+
+        /* Process one Skein-1024 UBI block in every lane: H = E(H, T, W) ^ W. */
+        template<typename V>
+        __attribute__((always_inline)) inline void skein_block(V* H, const V* W, const V& T0, const uint64_t T1)
+        {
+            V ks[17];
+            V ts[3];
+
+            /* Precompute the key schedule for this block. */
+            ks[16] = V{} + SKEIN_KS_PARITY;
+            for(uint32_t i = 0; i < 16; ++i)
+            {
+                ks[i]   = H[i];
+                ks[16] ^= H[i];
+            }
+
+            ts[0] = T0;
+            ts[1] = V{} + T1;
+            ts[2] = ts[0] ^ ts[1];
+
+            /* Do the first full key injection. */
+            V X[16];
+            for(uint32_t i = 0; i < 16; ++i)
+                X[i] = W[i] + ks[i];
+
+            X[13] += ts[0];
+            X[14] += ts[1];
+
+            /* Eight rounds between every key injection. */
+            for(uint32_t r = 0; r < SKEIN1024_ROUNDS_TOTAL / 8; ++r)
+            {
+                ROUND1024( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15, R1024_0);
+                ROUND1024( 0, 9, 2,13, 6,11, 4,15,10, 7,12, 3,14, 5, 8, 1, R1024_1);
+                ROUND1024( 0, 7, 2, 5, 4, 3, 6, 1,12,15,14,13, 8,11,10, 9, R1024_2);
+                ROUND1024( 0,15, 2,11, 6,13, 4, 9,14, 1, 8, 5,10, 3,12, 7, R1024_3);
+                INJECT1024(2 * r + 1);
+
+                ROUND1024( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15, R1024_4);
+                ROUND1024( 0, 9, 2,13, 6,11, 4,15,10, 7,12, 3,14, 5, 8, 1, R1024_5);
+                ROUND1024( 0, 7, 2, 5, 4, 3, 6, 1,12,15,14,13, 8,11,10, 9, R1024_6);
+                ROUND1024( 0,15, 2,11, 6,13, 4, 9,14, 1, 8, 5,10, 3,12, 7, R1024_7);
+                INJECT1024(2 * r + 2);
+            }
+
+            /* Do the final feedforward xor. */
+            for(uint32_t i = 0; i < 16; ++i)
+                H[i] = X[i] ^ W[i];
+        }
+
+        #undef INJECT1024
+        #undef ROUND1024
+        #undef MIX
+
+
+        /* Hash LANES messages with the same number of Skein blocks, one message per lane. */
+        template<typename V, uint32_t LANES>
+        __attribute__((always_inline)) inline void sk1024_lanes(const std::vector<uint8_t>** pData, uint1024_t* pHash)
+        {
+            /* Every lane processes the same number of blocks, the last one is the final block. */
+            const uint64_t nBlocks = std::max<uint64_t>(1, (pData[0]->size() + SKEIN1024_BLOCK_BYTES - 1) / SKEIN1024_BLOCK_BYTES);
+
+            /* Start every lane from the precomputed 1024-bit output IV. */
+            V H[16];
+            for(uint32_t i = 0; i < 16; ++i)
+                H[i] = V{} + SKEIN1024_IV_1024[i];
+
+            /* Process the message blocks. */
+            V T0 = V{};
+            uint64_t T1 = SKEIN_T1_FLAG_FIRST | SKEIN_T1_BLK_TYPE_MSG;
+            for(uint64_t nBlock = 0; nBlock < nBlocks; ++nBlock)
+            {
+                const uint64_t nOffset = nBlock * SKEIN1024_BLOCK_BYTES;
+                const bool fFinal      = (nBlock + 1 == nBlocks);
+
+                /* Transpose the block of each lane into words, zero padding the final block. */
+                V W[16];
+                for(uint32_t n = 0; n < LANES; ++n)
+                {
+                    uint64_t vWords[16] = { 0 };
+
+                    const uint64_t nSize  = pData[n]->size();
+                    const uint64_t nBytes = std::min<uint64_t>(nSize - std::min(nSize, nOffset), SKEIN1024_BLOCK_BYTES);
+                    if(nBytes > 0)
+                        std::memcpy(vWords, pData[n]->data() + nOffset, nBytes);
+
+                    for(uint32_t i = 0; i < 16; ++i)
+                        W[i][n] = vWords[i];
+
+                    /* The tweak counts the bytes processed in this lane. */
+                    T0[n] += (fFinal ? nBytes : SKEIN1024_BLOCK_BYTES);
+                }
+
+                if(fFinal)
+                    T1 |= SKEIN_T1_FLAG_FINAL;
+
+                skein_block<V>(H, W, T0, T1);
+                T1 &= ~SKEIN_T1_FLAG_FIRST;
+            }
+
+            /* Run threefish in counter mode for the single output block. */
+            {
+                V W[16];
+                for(uint32_t i = 0; i < 16; ++i)
+                    W[i] = V{};
+
+                skein_block<V>(H, W, V{} + sizeof(uint64_t), SKEIN_T1_FLAG_FIRST | SKEIN_T1_BLK_TYPE_OUT_FINAL);
+            }
+
+            /* Absorb the 128 byte skein hash into keccak at a rate of 9 words. */
+            V A[25];
+            for(uint32_t i = 0; i < 25; ++i)
+                A[i] = V{};
+
+            for(uint32_t i = 0; i < 9; ++i)
+                A[i] ^= H[i];
+
+            keccak_f1600<V>(A);
+
+            for(uint32_t i = 0; i < 7; ++i)
+                A[i] ^= H[i + 9];
+
+            /* Pad with the delimited suffix 0x05 and the final bit of the rate. */
+            A[7] ^= 0x05;
+            A[8] ^= 0x8000000000000000ULL;
+
+            keccak_f1600<V>(A);
+
+            /* Squeeze 128 bytes: the 9 words of the rate, then 7 more after another permutation. */
+            uint64_t vOut[LANES][16];
+            for(uint32_t i = 0; i < 9; ++i)
+                for(uint32_t n = 0; n < LANES; ++n)
+                    vOut[n][i] = A[i][n];
+
+            keccak_f1600<V>(A);
+
+            for(uint32_t i = 0; i < 7; ++i)
+                for(uint32_t n = 0; n < LANES; ++n)
+                    vOut[n][i + 9] = A[i][n];
+
+            for(uint32_t n = 0; n < LANES; ++n)
+                std::memcpy(pHash[n].begin(), vOut[n], sizeof(vOut[n]));
+        }
+
+
+        /* Four lane kernel for AVX2. */
+        __attribute__((target("avx2"))) void sk1024_avx2(const std::vector<uint8_t>** pData, uint1024_t* pHash)
+        {
+            sk1024_lanes<lane4_t, 4>(pData, pHash);
+        }
+
+
+        /* Eight lane kernel for AVX-512. */
+        __attribute__((target("avx512f"))) void sk1024_avx512(const std::vector<uint8_t>** pData, uint1024_t* pHash)
+        {
+            sk1024_lanes<lane8_t, 8>(pData, pHash);
+        }
+    }
+#endif
+
+
+    /* Hash a single message without going through the hash cache. */
+    static uint1024_t sk1024_scalar(const std::vector<uint8_t>& vData)
+    {
+        uint1024_t hashSkein;
+        Skein1024_Ctxt_t ctxSkein;
+        Skein1024_Init(&ctxSkein, 1024);
+        Skein1024_Update(&ctxSkein, (vData.empty() ? pblank : vData.data()), vData.size());
+        Skein1024_Final(&ctxSkein, (uint8_t *)&hashSkein);
+
+        uint1024_t hashKeccak;
+        Keccak_HashInstance ctxKeccak;
+        Keccak_HashInitialize(&ctxKeccak, 576, 1024, 1024, 0x05);
+        Keccak_HashUpdate(&ctxKeccak, (uint8_t *)&hashSkein, 1024);
+        Keccak_HashFinal(&ctxKeccak, (uint8_t *)&hashKeccak);
+
+        return hashKeccak;
+    }
+
+
+    /* Get the number of messages the multi-buffer SK1024 hashes at once on this processor. */
+    uint32_t SK1024Lanes()
+    {
+        return lanes::supported();
+    }
+
+
+    /* 1024-bit hashing of a batch of messages, used to build Block Hashes in bulk. */
+    void SK1024(const std::vector<std::vector<uint8_t>>& vData, std::vector<uint1024_t>& vHashes, uint32_t nLanes)
+    {
+        vHashes.resize(vData.size());
+
+        /* Use the widest kernel available unless told otherwise. */
+        if(nLanes == 0 || nLanes > SK1024Lanes())
+            nLanes = SK1024Lanes();
+
+    #ifdef SK_LANES
+        if(nLanes == 4 || nLanes == 8)
+        {
+            /* Group the messages by their number of skein blocks, in order of first appearance. */
+            std::vector<uint32_t> vPending(vData.size());
+            for(uint32_t n = 0; n < vData.size(); ++n)
+                vPending[n] = n;
+
+            const std::vector<uint8_t>* pData[8];
+            uint1024_t vHash[8];
+            uint32_t nIndex[8];
+
+            std::vector<uint32_t> vRemaining;
+            while(!vPending.empty())
+            {
+                const uint64_t nBlocks =
+                    std::max<uint64_t>(1, (vData[vPending[0]].size() + SKEIN1024_BLOCK_BYTES - 1) / SKEIN1024_BLOCK_BYTES);
+
+                uint32_t nCount = 0;
+                vRemaining.clear();
+                for(const uint32_t n : vPending)
+                {
+                    const uint64_t nSize =
+                        std::max<uint64_t>(1, (vData[n].size() + SKEIN1024_BLOCK_BYTES - 1) / SKEIN1024_BLOCK_BYTES);
+
+                    if(nSize != nBlocks)
+                    {
+                        vRemaining.push_back(n);
+                        continue;
+                    }
+
+                    pData[nCount]  = &vData[n];
+                    nIndex[nCount] = n;
+
+                    /* Run the lanes once they are full. */
+                    if(++nCount == nLanes)
+                    {
+                        if(nLanes == 8)
+                            sk1024_avx512(pData, vHash);
+                        else
+                            sk1024_avx2(pData, vHash);
+
+                        for(uint32_t i = 0; i < nLanes; ++i)
+                            vHashes[nIndex[i]] = vHash[i];
+
+                        nCount = 0;
+                    }
+                }
+
+                /* A partial group is hashed one by one rather than padding the lanes. */
+                for(uint32_t i = 0; i < nCount; ++i)
+                    vHashes[nIndex[i]] = sk1024_scalar(*pData[i]);
+
+                vPending.swap(vRemaining);
+            }
+
+            return;
+        }
+    #endif
+
+        /* Scalar fallback. */
+        for(uint32_t n = 0; n < vData.size(); ++n)
+            vHashes[n] = sk1024_scalar(vData[n]);
+    }
+}
@@ -0,0 +1,214 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+#include <LLC/hash/macro.h>
+#include <LLC/hash/SK/lanes.h>
+#include <LLC/hash/SK/skein_iv.h>
+
+#include <cstring>
+
+namespace LLC
+{
+
+#ifdef SK_LANES
+    namespace
+    {
+        using namespace lanes;
+
+
+        /* Skein MIX function on words A and B. */
+        #define MIX(A, B, ROT) { X[A] += X[B]; rotl<ROT>(X[B]); X[B] ^= X[A]; }
+
+
+        /* One Threefish-512 round of four MIX functions. */
+        #define ROUND512(p0,p1,p2,p3,p4,p5,p6,p7,ROT)                     \
+            MIX(p0, p1, ROT##_0); MIX(p2, p3, ROT##_1);                   \
+            MIX(p4, p5, ROT##_2); MIX(p6, p7, ROT##_3);
+
+
+        /* Threefish-512 key injection number S. */
+        #define INJECT512(S)                                              \
+            for(uint32_t i = 0; i < 8; ++i)                               \
+                X[i] += ks[((S) + i) % 9];                                \
+            X[5] += ts[(S) % 3];                                          \
+            X[6] += ts[((S) + 1) % 3];                                    \
+            X[7] += static_cast<uint64_t>(S);
+
+
+        /* Process one Skein-512 UBI block in every lane: H = E(H, T, W) ^ W. */
+        template<typename V>
+        __attribute__((always_inline)) inline void skein_block(V* H, const V* W, const uint64_t T0, const uint64_t T1)
+        {
+            V ks[9];
+            V ts[3];
+
+            /* Precompute the key schedule for this block. */
+            ks[8] = V{} + SKEIN_KS_PARITY;
+            for(uint32_t i = 0; i < 8; ++i)
+            {
+                ks[i]  = H[i];
+                ks[8] ^= H[i];
+            }
+
+            ts[0] = V{} + T0;
+            ts[1] = V{} + T1;
+            ts[2] = ts[0] ^ ts[1];
+
+            /* Do the first full key injection. */
+            V X[8];
+            for(uint32_t i = 0; i < 8; ++i)
+                X[i] = W[i] + ks[i];
+
+            X[5] += ts[0];
+            X[6] += ts[1];
+
+            /* Eight rounds between every key injection. */
+            for(uint32_t r = 0; r < SKEIN_512_ROUNDS_TOTAL / 8; ++r)
+            {
+                ROUND512(0, 1, 2, 3, 4, 5, 6, 7, R_512_0);
+                ROUND512(2, 1, 4, 7, 6, 5, 0, 3, R_512_1);
+                ROUND512(4, 1, 6, 3, 0, 5, 2, 7, R_512_2);
+                ROUND512(6, 1, 0, 7, 2, 5, 4, 3, R_512_3);
+                INJECT512(2 * r + 1);
+
+                ROUND512(0, 1, 2, 3, 4, 5, 6, 7, R_512_4);
+                ROUND512(2, 1, 4, 7, 6, 5, 0, 3, R_512_5);
+                ROUND512(4, 1, 6, 3, 0, 5, 2, 7, R_512_6);
+                ROUND512(6, 1, 0, 7, 2, 5, 4, 3, R_512_7);
+                INJECT512(2 * r + 2);
+            }
+
+            /* Do the final feedforward xor. */
+            for(uint32_t i = 0; i < 8; ++i)
+                H[i] = X[i] ^ W[i];
+        }
+
+        #undef INJECT512
+        #undef ROUND512
+        #undef MIX
+
+
+        /* Hash LANES pairs of 512-bit hashes, one pair per lane. */
+        template<typename V, uint32_t LANES>
+        __attribute__((always_inline)) inline void sk512_lanes(const uint512_t* pHashes, uint512_t* pParents)
+        {
+            /* Transpose the left and right hash of each pair into words. */
+            V L[8];
+            V R[8];
+            for(uint32_t n = 0; n < LANES; ++n)
+            {
+                uint64_t vLeft[8];
+                uint64_t vRight[8];
+                std::memcpy(vLeft,  pHashes[2 * n].begin(),     sizeof(vLeft));
+                std::memcpy(vRight, pHashes[2 * n + 1].begin(), sizeof(vRight));
+
+                for(uint32_t i = 0; i < 8; ++i)
+                {
+                    L[i][n] = vLeft[i];
+                    R[i][n] = vRight[i];
+                }
+            }
+
+            /* Start every lane from the precomputed 512-bit output IV. */
+            V H[8];
+            for(uint32_t i = 0; i < 8; ++i)
+                H[i] = V{} + SKEIN_512_IV_512[i];
+
+            /* The 128 byte message is two blocks, the right hash being the final one. */
+            skein_block<V>(H, L, 64,  SKEIN_T1_FLAG_FIRST | SKEIN_T1_BLK_TYPE_MSG);
+            skein_block<V>(H, R, 128, SKEIN_T1_FLAG_FINAL | SKEIN_T1_BLK_TYPE_MSG);
+
+            /* Run threefish in counter mode for the single output block. */
+            {
+                V W[8];
+                for(uint32_t i = 0; i < 8; ++i)
+                    W[i] = V{};
+
+                skein_block<V>(H, W, sizeof(uint64_t), SKEIN_T1_FLAG_FIRST | SKEIN_T1_BLK_TYPE_OUT_FINAL);
+            }
+
+            /* SHA3-512 of the 64 byte skein hash fits in a single block of 9 words. */
+            V A[25];
+            for(uint32_t i = 0; i < 25; ++i)
+                A[i] = V{};
+
+            for(uint32_t i = 0; i < 8; ++i)
+                A[i] ^= H[i];
+
+            /* Pad with the delimited suffix 0x06 and the final bit of the rate. */
+            A[8] ^= 0x8000000000000006ULL;
+
+            keccak_f1600<V>(A);
+
+            /* Squeeze the 8 words of the hash. */
+            for(uint32_t n = 0; n < LANES; ++n)
+            {
+                uint64_t vOut[8];
+                for(uint32_t i = 0; i < 8; ++i)
+                    vOut[i] = A[i][n];
+
+                std::memcpy(pParents[n].begin(), vOut, sizeof(vOut));
+            }
+        }
+
+
+        /* Four lane kernel for AVX2. */
+        __attribute__((target("avx2"))) void sk512_avx2(const uint512_t* pHashes, uint512_t* pParents)
+        {
+            sk512_lanes<lane4_t, 4>(pHashes, pParents);
+        }
+
+
+        /* Eight lane kernel for AVX-512. */
+        __attribute__((target("avx512f"))) void sk512_avx512(const uint512_t* pHashes, uint512_t* pParents)
+        {
+            sk512_lanes<lane8_t, 8>(pHashes, pParents);
+        }
+    }
+#endif
+
+
+    /* 512-bit hashing of adjacent pairs of hashes, used to build Merkle Trees in bulk. */
+    void SK512Pairs(const uint512_t* pHashes, const uint32_t nPairs, uint512_t* pParents, uint32_t nLanes)
+    {
+        /* Use the widest kernel available unless told otherwise. */
+        if(nLanes == 0 || nLanes > lanes::supported())
+            nLanes = lanes::supported();
+
+        uint32_t nPair = 0;
+
+    #ifdef SK_LANES
+        if(nLanes == 8)
+        {
+            for( ; nPair + 8 <= nPairs; nPair += 8)
+                sk512_avx512(pHashes + 2 * nPair, pParents + nPair);
+        }
+
+        if(nLanes >= 4)
+        {
+            for( ; nPair + 4 <= nPairs; nPair += 4)
+                sk512_avx2(pHashes + 2 * nPair, pParents + nPair);
+        }
+    #endif
+
+        /* Hash the pairs that don't fill the lanes one by one. */
+        for( ; nPair < nPairs; ++nPair)
+        {
+            const uint512_t& hashLeft  = pHashes[2 * nPair];
+            const uint512_t& hashRight = pHashes[2 * nPair + 1];
+
+            pParents[nPair] = SK512(BEGIN(hashLeft), END(hashLeft), BEGIN(hashRight), END(hashRight));
+        }
+    }
+}
@@ -0,0 +1,128 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLC_HASH_SK_LANES_H
+#define NEXUS_LLC_HASH_SK_LANES_H
+
+#include <cstdint>
+
+/* Building blocks for the multi-buffer SK hashes, with one message per SIMD lane.
+ *
+ * The kernels are written once over GCC vector types and compiled for each instruction set with
+ * target attributes, so AVX2 and AVX-512 builds don't need the whole binary compiled for them. */
+#if defined(__GNUC__) && defined(__x86_64__)
+    #define SK_LANES
+#endif
+
+namespace LLC
+{
+    namespace lanes
+    {
+    #ifdef SK_LANES
+
+        /* Lane vectors of 64-bit words, word i of every message side by side. */
+        typedef uint64_t lane4_t __attribute__((vector_size(32)));
+        typedef uint64_t lane8_t __attribute__((vector_size(64)));
+
+
+        /* Rotate every lane left by a constant number of bits, in place so no vector crosses a call boundary. */
+        template<uint32_t R, typename V>
+        __attribute__((always_inline)) inline void rotl(V& x)
+        {
+            x = (x << R) | (x >> (64 - R));
+        }
+
+
+        /* The round constants of Keccak-f[1600]. */
+        static const uint64_t KECCAK_ROUND_CONSTANTS[24] =
+        {
+            0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+            0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+            0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+            0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+            0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+            0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+        };
+
+
+        /* Rho and pi steps: rotate the lane that moves into position DST. */
+        #define RHOPI(DST, ROT) { const V t = A[DST]; A[DST] = c; rotl<ROT>(A[DST]); c = t; }
+
+
+        /* Keccak-f[1600] permutation in every lane. */
+        template<typename V>
+        __attribute__((always_inline)) inline void keccak_f1600(V* A)
+        {
+            for(uint32_t r = 0; r < 24; ++r)
+            {
+                /* Theta. */
+                V C[5];
+                for(uint32_t x = 0; x < 5; ++x)
+                    C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+
+                for(uint32_t x = 0; x < 5; ++x)
+                {
+                    V D = C[(x + 1) % 5];
+                    rotl<1>(D);
+                    D ^= C[(x + 4) % 5];
+                    for(uint32_t y = 0; y < 25; y += 5)
+                        A[y + x] ^= D;
+                }
+
+                /* Rho and Pi, following the lane cycle starting at A[1]. */
+                V c = A[1];
+                RHOPI(10,  1); RHOPI( 7,  3); RHOPI(11,  6); RHOPI(17, 10);
+                RHOPI(18, 15); RHOPI( 3, 21); RHOPI( 5, 28); RHOPI(16, 36);
+                RHOPI( 8, 45); RHOPI(21, 55); RHOPI(24,  2); RHOPI( 4, 14);
+                RHOPI(15, 27); RHOPI(23, 41); RHOPI(19, 56); RHOPI(13,  8);
+                RHOPI(12, 25); RHOPI( 2, 43); RHOPI(20, 62); RHOPI(14, 18);
+                RHOPI(22, 39); RHOPI( 9, 61); RHOPI( 6, 20); RHOPI( 1, 44);
+
+                /* Chi. */
+                for(uint32_t y = 0; y < 25; y += 5)
+                {
+                    V T[5];
+                    for(uint32_t x = 0; x < 5; ++x)
+                        T[x] = A[y + x];
+
+                    for(uint32_t x = 0; x < 5; ++x)
+                        A[y + x] = T[x] ^ (~T[(x + 1) % 5] & T[(x + 2) % 5]);
+                }
+
+                /* Iota. */
+                A[0] ^= KECCAK_ROUND_CONSTANTS[r];
+            }
+        }
+
+        #undef RHOPI
+
+    #endif
+
+
+        /* Get the number of lanes the widest kernel supported by this processor runs. */
+        inline uint32_t supported()
+        {
+        #ifdef SK_LANES
+            static const uint32_t nLanes =
+                __builtin_cpu_supports("avx512f") ? 8 : (__builtin_cpu_supports("avx2") ? 4 : 1);
+
+            return nLanes;
+        #else
+            return 1;
+        #endif
+        }
+    }
+}
+
+#endif
@@ -10,7 +10,15 @@
             "ad vocem populi" - To the Voice of the People
 
 ____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLC_PRIME_FERMAT_H
+#define NEXUS_LLC_PRIME_FERMAT_H
+
+#include <LLC/types/uint1024.h>
+
 #include <cstdint>
+#include <cstring>
 
 
 
@@ -143,12 +151,12 @@ inline void sqrredc(uint32_t *z, uint32_t *x, uint32_t *n, const uint32_t d, uin
 {
     uint64_t prod;
     uint32_t m;
-    uint32_t c;
+    uint32_t c = 0;
 
     uint8_t i;
     uint8_t j;
 
-    for(i = 0; i < (WORD_MAX<<1); ++i)
+    for(i = 0; i <= (WORD_MAX<<1); ++i)
         t[i] = 0;
 
 
@@ -183,15 +191,13 @@ inline void sqrredc(uint32_t *z, uint32_t *x, uint32_t *n, const uint32_t d, uin
         t[i + i] = prod;
         c = prod >> 32;
 
-        for(j = i + 1; j < WORD_MAX; ++j)
+        //carry through to the top word, the square always fits in twice the words
+        for(j = i + i + 1; c != 0 && j < (WORD_MAX<<1); ++j)
         {
-            prod = static_cast<uint64_t>(t[i + j]) + c;
-            t[i + j] = prod;
+            prod = static_cast<uint64_t>(t[j]) + c;
+            t[j] = prod;
             c = prod >> 32;
         }
-
-        t[WORD_MAX + i] += c;
-
     }
 
 
@@ -210,6 +216,7 @@ inline void sqrredc(uint32_t *z, uint32_t *x, uint32_t *n, const uint32_t d, uin
 
         j = i;
 
+        //the reduced value is below 2N, so it can spill one bit into t[2 * WORD_MAX]
         while(c != 0)
         {
             prod = static_cast<uint64_t>(t[WORD_MAX + j]) + c;
@@ -220,7 +227,7 @@ inline void sqrredc(uint32_t *z, uint32_t *x, uint32_t *n, const uint32_t d, uin
     }
 
 
-    if(cmp_ge_n<WORD_MAX>(&t[WORD_MAX], n))
+    if(t[WORD_MAX<<1] || cmp_ge_n<WORD_MAX>(&t[WORD_MAX], n))
         sub_n<WORD_MAX>(z, &t[WORD_MAX], n);
     else
         assign<WORD_MAX>(z, &t[WORD_MAX]);
@@ -230,8 +237,7 @@ inline void sqrredc(uint32_t *z, uint32_t *x, uint32_t *n, const uint32_t d, uin
 template<uint8_t WORD_MAX>
 inline void mulredc(uint32_t *z, uint32_t *x, uint32_t *y, uint32_t *n, const uint32_t d, uint32_t *t)
 {
-    //uint32_t m;//, c;
-    //uint64_t temp;
+    uint64_t temp;
 
     assign_zero<WORD_MAX>(t);
     t[WORD_MAX] = 0;
@@ -239,28 +245,23 @@ inline void mulredc(uint32_t *z, uint32_t *x, uint32_t *y, uint32_t *n, const ui
 
     for(uint8_t i = 0; i < WORD_MAX; ++i)
     {
-        //c = addmul_1(t, x, y[i]);
-        t[WORD_MAX] += addmul_1<WORD_MAX>(t, x, y[i]);
-        //temp = static_cast<uint64_t>(t[WORD_MAX]) + c;
-        //t[WORD_MAX] = temp;
-        //t[WORD_MAX] += c;
-        //t[WORD_MAX + 1] = temp >> 32;
-
-        //m = t[0]*d;
-
-        //c = addmul_1(t, n, m);
-        //t[WORD_MAX] += addmul_1<WORD_MAX>(t, n, m);
-        t[WORD_MAX] += addmul_1<WORD_MAX>(t, n, t[0]*d);
-        //temp = static_cast<uint64_t>(t[WORD_MAX]) + c;
-        //t[WORD_MAX] = temp;
-        //t[WORD_MAX] += c;
-        //t[WORD_MAX + 1] = temp >> 32;
+        temp = static_cast<uint64_t>(t[WORD_MAX]) + addmul_1<WORD_MAX>(t, x, y[i]);
+        t[WORD_MAX]    = temp;
+        t[WORD_MAX+1] += temp >> 32;
+
+        temp = static_cast<uint64_t>(t[WORD_MAX]) + addmul_1<WORD_MAX>(t, n, t[0]*d);
+        t[WORD_MAX]    = temp;
+        t[WORD_MAX+1] += temp >> 32;
 
         //#pragma unroll
         for(uint8_t j = 0; j <= WORD_MAX; ++j)
             t[j] = t[j+1];
+
+        t[WORD_MAX+1] = 0;
     }
-    if(cmp_ge_n<WORD_MAX>(t, n))
+
+    //the result is below 2N, the overflow word carries the bit above R for moduli with the top bit set
+    if(t[WORD_MAX] || cmp_ge_n<WORD_MAX>(t, n))
         sub_n<WORD_MAX>(t, t, n);
 
     //#pragma unroll
@@ -272,27 +273,13 @@ inline void mulredc(uint32_t *z, uint32_t *x, uint32_t *y, uint32_t *n, const ui
 template<uint8_t WORD_MAX>
 void redc(uint32_t *z, uint32_t *x, uint32_t *n, const uint32_t d, uint32_t *t)
 {
-    uint32_t m;
-
-    assign<WORD_MAX>(t, x);
-
-    t[WORD_MAX] = 0;
+    uint32_t one[WORD_MAX];
 
-    for(uint8_t i = 0; i < WORD_MAX; ++i)
-    {
-        m = t[0]*d;
-        t[WORD_MAX] = addmul_1<WORD_MAX>(t, n, m);
-
-        for(uint8_t j = 0; j < WORD_MAX; ++j)
-            t[j] = t[j+1];
+    assign_zero<WORD_MAX>(one);
+    one[0] = 1;
 
-        t[WORD_MAX] = 0;
-    }
-
-    if(cmp_ge_n<WORD_MAX>(t, n))
-        sub_n<WORD_MAX>(t, t, n);
-
-    assign<WORD_MAX>(z, t);
+    //converting out of montgomery form is a multiply by one
+    mulredc<WORD_MAX>(z, x, one, n, d, t);
 }
 
 
@@ -304,7 +291,7 @@ uint16_t bit_count(uint32_t *x)
     //#pragma unroll
     for(uint16_t i = 0; i < (WORD_MAX << 5); ++i)
     {
-        if(x[i>>5] & (1 << (i & 31)))
+        if(x[i>>5] & (1u << (i & 31)))
             msb = i;
     }
 
@@ -385,6 +372,18 @@ inline void rshift1(uint32_t *r, uint32_t *a)
 }
 
 
+/* Calculate R = 2X mod N for X < N, keeping the bit shifted out above the word size. */
+template<uint8_t WORD_MAX>
+inline void dbl_n(uint32_t *r, uint32_t *x, uint32_t *n)
+{
+    const uint32_t nTop = x[WORD_MAX-1] >> 31;
+
+    lshift1<WORD_MAX>(r, x);
+    if(nTop || cmp_ge_n<WORD_MAX>(r, n))
+        sub_n<WORD_MAX>(r, r, n);
+}
+
+
 /* Calculate ABar and BBar for Montgomery Modular Multiplication. */
 template<uint8_t WORD_MAX>
 void calcBar(uint32_t *a, uint32_t *b, uint32_t *n, uint32_t *t)
@@ -401,9 +400,7 @@ void calcBar(uint32_t *a, uint32_t *b, uint32_t *n, uint32_t *t)
             sub_n<WORD_MAX>(a, a, t);
     }
 
-    lshift1<WORD_MAX>(b, a);     //calculate 2R mod N;
-    if(cmp_ge_n<WORD_MAX>(b, n))
-        sub_n<WORD_MAX>(b, b, n);
+    dbl_n<WORD_MAX>(b, a, n);     //calculate 2R mod N;
 }
 
 
@@ -430,18 +427,14 @@ template<uint8_t WORD_MAX>
 void calcTable(uint32_t *a, uint32_t *n, uint32_t *t, uint32_t *table)
 {
 
-    lshift1<WORD_MAX>(t, a);     //calculate 2R mod N;
-    if(cmp_ge_n<WORD_MAX>(t, n))
-        sub_n<WORD_MAX>(t, t, n);
+    dbl_n<WORD_MAX>(t, a, n);     //calculate 2R mod N;
 
     assign<WORD_MAX>(&table[WORD_MAX], t);
 
 
     for(uint16_t i = 2; i < WINDOW_SIZE; ++i) //calculate 2^i R mod N
     {
-        lshift1<WORD_MAX>(t, t);
-        if(cmp_ge_n<WORD_MAX>(t, n))
-            sub_n<WORD_MAX>(t, t, n);
+        dbl_n<WORD_MAX>(t, t, n);
 
         assign<WORD_MAX>(&table[i * WORD_MAX], t);
     }
@@ -452,7 +445,7 @@ void calcTable(uint32_t *a, uint32_t *n, uint32_t *t, uint32_t *table)
 template<uint8_t WORD_MAX>
 void pow2m(uint32_t *X, uint32_t *Exp, uint32_t *N, uint32_t *table)
 {
-    uint32_t t[WORD_MAX << 1];
+    uint32_t t[(WORD_MAX << 1) + 1];
     uint32_t wval = 0;
     uint32_t d = inv2adic(N[0]);
 
@@ -474,7 +467,7 @@ void pow2m(uint32_t *X, uint32_t *Exp, uint32_t *N, uint32_t *table)
 
         wval <<= 1;
 
-        if(Exp[i>>5] & (1 << (i & 31)))
+        if(Exp[i>>5] & (1u << (i & 31)))
             wval |= 1;
 
         if(((i % WINDOW_BITS) == 0) && wval)
@@ -507,7 +500,7 @@ void pow2m(uint32_t *X, uint32_t *Exp, uint32_t *N)
         //mulredc<WORD_MAX>(X, X, X, N, d, t);
         sqrredc<WORD_MAX>(X, X, N, d, t);
 
-        if(Exp[i>>5] & (1 << (i & 31)))
+        if(Exp[i>>5] & (1u << (i & 31)))
             mulredc<WORD_MAX>(X, X, A, N, d, t);
     }
 
@@ -543,7 +536,7 @@ bool fermat_prime(uint32_t *p)
 
 
 /* Test if number p passes Fermat Primality Test base 2. */
-uint1024_t fermat_prime(const uint1024_t &p)
+inline uint1024_t fermat_prime(const uint1024_t &p)
 {
     uint1024_t r;
     uint32_t e[32];
@@ -558,3 +551,279 @@ uint1024_t fermat_prime(const uint1024_t &p)
 
     return r;
 }
+
+
+/* The 64-bit word count of the moduli of prime proofs of work. */
+#define LIMBS_1024 16
+
+
+/* Calculate -N^-1 mod 2^64 for odd N[0], each newton step doubles the correct bits. */
+inline uint64_t inv2adic64(const uint64_t n)
+{
+    uint64_t x = n; //correct to 3 bits for odd n
+    for(uint8_t i = 0; i < 5; ++i)
+        x *= 2 - n * x;
+
+    return -x;
+}
+
+
+/* Check if X >= N over 64-bit words. */
+inline bool cmp_ge_1024(const uint64_t *x, const uint64_t *n)
+{
+    for(int8_t i = LIMBS_1024 - 1; i >= 0; --i)
+    {
+        if(x[i] != n[i])
+            return x[i] > n[i];
+    }
+
+    return true;
+}
+
+
+/* Calculate Z = X - N over 64-bit words. */
+inline void sub_1024(uint64_t *z, const uint64_t *x, const uint64_t *n)
+{
+    uint64_t c = 0;
+    for(uint8_t i = 0; i < LIMBS_1024; ++i)
+    {
+        const uint64_t temp = x[i] - n[i];
+        const uint64_t r    = temp - c;
+
+        c = (temp > x[i]) | (r > temp);
+        z[i] = r;
+    }
+}
+
+
+/* Calculate Z = 2X mod N for X < N, the doubling step of base 2 exponentiation. */
+inline void dbl_1024(uint64_t *z, const uint64_t *x, const uint64_t *n)
+{
+    const uint64_t nTop = x[LIMBS_1024 - 1] >> 63;
+    for(int8_t i = LIMBS_1024 - 1; i > 0; --i)
+        z[i] = (x[i] << 1) | (x[i - 1] >> 63);
+
+    z[0] = x[0] << 1;
+
+    if(nTop || cmp_ge_1024(z, n))
+        sub_1024(z, z, n);
+}
+
+
+/* Double word for the column accumulators, uint128_t is already taken by base_uint<128>. */
+__extension__ typedef unsigned __int128 limb128_t;
+
+
+/* Accumulate the product A * B into the three word column accumulator (LO, HI). */
+inline void mac_1024(limb128_t &lo, uint64_t &hi, const uint64_t a, const uint64_t b)
+{
+    const limb128_t p = static_cast<limb128_t>(a) * b;
+
+    lo += p;
+    hi += (lo < p);
+}
+
+
+/* Shift the column accumulator down by one word once its low word is complete. */
+inline void next_1024(limb128_t &lo, uint64_t &hi)
+{
+    lo = (lo >> 64) | (static_cast<limb128_t>(hi) << 64);
+    hi = 0;
+}
+
+
+/* Add twice the column accumulator (LO2, HI2) into (LO, HI), used for the symmetric products of a square. */
+inline void add2_1024(limb128_t &lo, uint64_t &hi, const limb128_t lo2, const uint64_t hi2)
+{
+    const limb128_t x = lo2 << 1;
+
+    hi += (hi2 << 1) | static_cast<uint64_t>(lo2 >> 127);
+    lo += x;
+    hi += (lo < x);
+}
+
+
+/* Final subtraction of a montgomery product T below 2N, with the bit above R in nTop. */
+inline void final_1024(uint64_t *z, const uint64_t *t, const uint64_t nTop, const uint64_t *n)
+{
+    if(nTop || cmp_ge_1024(t, n))
+        sub_1024(z, t, n);
+    else
+    {
+        for(uint32_t i = 0; i < LIMBS_1024; ++i)
+            z[i] = t[i];
+    }
+}
+
+
+/* Calculate Z = X * Y * R^-1 mod N with finely integrated product scanning.
+ * Each column sums its products into one accumulator, so the multiplies don't chain on a carry.
+ * Results stay below N for any odd N < R. */
+inline void mulredc_1024(uint64_t *z, const uint64_t *x, const uint64_t *y, const uint64_t *n, const uint64_t d)
+{
+    uint64_t m[LIMBS_1024];
+    uint64_t t[LIMBS_1024];
+
+    limb128_t lo = 0;
+    uint64_t hi = 0;
+
+    for(uint32_t i = 0; i < LIMBS_1024; ++i)
+    {
+        for(uint32_t j = 0; j < i; ++j)
+        {
+            mac_1024(lo, hi, x[j], y[i - j]);
+            mac_1024(lo, hi, m[j], n[i - j]);
+        }
+
+        mac_1024(lo, hi, x[i], y[0]);
+
+        m[i] = static_cast<uint64_t>(lo) * d;
+        mac_1024(lo, hi, m[i], n[0]);
+
+        next_1024(lo, hi);
+    }
+
+    for(uint32_t i = LIMBS_1024; i < (LIMBS_1024 << 1); ++i)
+    {
+        for(uint32_t j = i - LIMBS_1024 + 1; j < LIMBS_1024; ++j)
+        {
+            mac_1024(lo, hi, x[j], y[i - j]);
+            mac_1024(lo, hi, m[j], n[i - j]);
+        }
+
+        t[i - LIMBS_1024] = static_cast<uint64_t>(lo);
+        next_1024(lo, hi);
+    }
+
+    final_1024(z, t, static_cast<uint64_t>(lo), n);
+}
+
+
+/* Calculate Z = X^2 * R^-1 mod N with product scanning, summing each symmetric product once and doubling. */
+inline void sqrredc_1024(uint64_t *z, const uint64_t *x, const uint64_t *n, const uint64_t d)
+{
+    uint64_t m[LIMBS_1024];
+    uint64_t t[LIMBS_1024];
+
+    limb128_t lo = 0;
+    uint64_t hi = 0;
+
+    /* The low columns compute the reduction factors. */
+    for(uint32_t i = 0; i < LIMBS_1024; ++i)
+    {
+        limb128_t lo2 = 0;
+        uint64_t hi2 = 0;
+        for(uint32_t j = 0; j < ((i + 1) >> 1); ++j)
+            mac_1024(lo2, hi2, x[j], x[i - j]);
+
+        add2_1024(lo, hi, lo2, hi2);
+        if(!(i & 1))
+            mac_1024(lo, hi, x[i >> 1], x[i >> 1]);
+
+        for(uint32_t j = 0; j < i; ++j)
+            mac_1024(lo, hi, m[j], n[i - j]);
+
+        m[i] = static_cast<uint64_t>(lo) * d;
+        mac_1024(lo, hi, m[i], n[0]);
+
+        next_1024(lo, hi);
+    }
+
+    /* The high columns are the result. */
+    for(uint32_t i = LIMBS_1024; i < (LIMBS_1024 << 1); ++i)
+    {
+        limb128_t lo2 = 0;
+        uint64_t hi2 = 0;
+        for(uint32_t j = i - LIMBS_1024 + 1; j < ((i + 1) >> 1); ++j)
+            mac_1024(lo2, hi2, x[j], x[i - j]);
+
+        add2_1024(lo, hi, lo2, hi2);
+        if(!(i & 1))
+            mac_1024(lo, hi, x[i >> 1], x[i >> 1]);
+
+        for(uint32_t j = i - LIMBS_1024 + 1; j < LIMBS_1024; ++j)
+            mac_1024(lo, hi, m[j], n[i - j]);
+
+        t[i - LIMBS_1024] = static_cast<uint64_t>(lo);
+        next_1024(lo, hi);
+    }
+
+    final_1024(z, t, static_cast<uint64_t>(lo), n);
+}
+
+
+/* Calculate X = 2^(N-1) mod N (Fermat test) for odd N.
+ * Base 2 never needs a multiply, each set bit of the exponent is a modular doubling. */
+inline void pow2m_1024(uint64_t *x, const uint64_t *n)
+{
+    const uint64_t d = inv2adic64(n[0]);
+
+    /* The exponent is N - 1, so only the lowest bit differs from N. */
+    uint64_t e[LIMBS_1024];
+    for(uint8_t i = 0; i < LIMBS_1024; ++i)
+        e[i] = n[i];
+
+    e[0] &= ~uint64_t(1);
+
+    /* Find the most significant bit of the exponent. */
+    int16_t nBits = (LIMBS_1024 << 6) - 1;
+    while(nBits >= 0 && !(e[nBits >> 6] & (uint64_t(1) << (nBits & 63))))
+        --nBits;
+
+    /* Calculate R mod N by doubling up from the highest power of two below N. */
+    int16_t nTop = (LIMBS_1024 << 6) - 1;
+    while(nTop > 0 && !(n[nTop >> 6] & (uint64_t(1) << (nTop & 63))))
+        --nTop;
+
+    for(uint8_t i = 0; i < LIMBS_1024; ++i)
+        x[i] = 0;
+
+    x[nTop >> 6] = uint64_t(1) << (nTop & 63);
+    if(cmp_ge_1024(x, n))
+        x[nTop >> 6] = 0; //only for N = 1
+
+    for(int16_t i = nTop; i < (LIMBS_1024 << 6); ++i)
+        dbl_1024(x, x, n);
+
+    /* Square and double from the top bit down, the top bit itself is the initial doubling. */
+    if(nBits >= 0)
+        dbl_1024(x, x, n);
+
+    for(int16_t i = nBits - 1; i >= 0; --i)
+    {
+        sqrredc_1024(x, x, n, d);
+
+        if(e[i >> 6] & (uint64_t(1) << (i & 63)))
+            dbl_1024(x, x, n);
+    }
+
+    /* Convert out of montgomery form. */
+    uint64_t one[LIMBS_1024] = { 1 };
+    mulredc_1024(x, x, one, n, d);
+}
+
+
+/* Calculate the base 2 Fermat remainder of an odd candidate. */
+inline uint1024_t fermat_remainder(const uint1024_t &p)
+{
+    uint64_t n[LIMBS_1024];
+    uint64_t x[LIMBS_1024];
+
+    std::memcpy(n, p.begin(), sizeof(n));
+    pow2m_1024(x, n);
+
+    uint1024_t r;
+    std::memcpy(r.begin(), x, sizeof(x));
+
+    return r;
+}
+
+
+/* Calculate the base 2 Fermat remainders of a cluster of odd candidates without allocating. */
+inline void fermat_cluster(const uint1024_t *p, uint1024_t *r, const uint32_t nCount)
+{
+    for(uint32_t n = 0; n < nCount; ++n)
+        r[n] = fermat_remainder(p[n]);
+}
+
+#endif
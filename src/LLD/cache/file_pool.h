@@ -0,0 +1,145 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLD_CACHE_FILE_POOL_H
+#define NEXUS_LLD_CACHE_FILE_POOL_H
+
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace LLD
+{
+
+    /** FilePool
+     *
+     *  Pool of long-lived read-only file descriptors, one per sector file of a datachain.
+     *  Reads are positional (pread) so that any number of readers can share the same
+     *  descriptor without seeking, and without an open/close pair per record.
+     *
+     *  In memory-map mode, sealed sector files (files that are no longer appended to)
+     *  are mapped read-only and reads are served from the mapping through the page cache.
+     *
+     **/
+    class FilePool
+    {
+        /* Reader-writer mutex, exclusive only while a new descriptor is being opened. */
+        mutable std::shared_mutex POOL_MUTEX;
+
+
+        /* The base location of the sector files. */
+        std::string strBaseLocation;
+
+
+        /* The open descriptors indexed by file number, -1 if not opened yet. */
+        std::vector<int> vDescriptors;
+
+
+        /* The read-only mappings of sealed files indexed by file number, with their mapped lengths. */
+        std::vector<std::pair<const uint8_t*, uint64_t>> vMappings;
+
+
+        /* Flag to enable memory mapping of sealed files. */
+        const bool fMemoryMap;
+
+
+    public:
+
+
+        /** Default Constructor. **/
+        FilePool()                                 = delete;
+
+
+        /** Copy Constructor. **/
+        FilePool(const FilePool& pool)             = delete;
+
+
+        /** Move Constructor. **/
+        FilePool(FilePool&& pool)                  = delete;
+
+
+        /** Copy assignment. **/
+        FilePool& operator=(const FilePool& pool)  = delete;
+
+
+        /** Move assignment. **/
+        FilePool& operator=(FilePool&& pool)       = delete;
+
+
+        /** Class Destructor. Closes all open descriptors. **/
+        ~FilePool();
+
+
+        /** Location Constructor
+         *
+         *  @param[in] strBaseLocationIn The datachain location the sector files live in.
+         *  @param[in] fMemoryMapIn Flag to serve reads of sealed files from read-only mappings.
+         *
+         **/
+        FilePool(const std::string& strBaseLocationIn, const bool fMemoryMapIn = false);
+
+
+        /** Read
+         *
+         *  Read a range of bytes from a sector file at given position.
+         *
+         *  @param[in] nFile The sector file number to read from.
+         *  @param[in] nOffset The binary position in the file to start reading.
+         *  @param[out] vData The buffer to read into, must be sized to the expected length.
+         *  @param[in] fSealed Flag to indicate the file is no longer appended to and can be mapped.
+         *
+         *  @return True if the full buffer was read, false otherwise.
+         *
+         **/
+        bool Read(const uint32_t nFile, const uint64_t nOffset, std::vector<uint8_t>& vData, const bool fSealed = false);
+
+
+        /** Close
+         *
+         *  Close all the open descriptors and mappings, they will be re-opened on next read.
+         *  Must not be called while reads are in flight.
+         *
+         **/
+        void Close();
+
+
+    private:
+
+        /** Descriptor
+         *
+         *  Get the descriptor for a given file, opening it if not in the pool yet.
+         *
+         *  @param[in] nFile The sector file number.
+         *
+         *  @return The file descriptor, -1 if the file could not be opened.
+         *
+         **/
+        int descriptor(const uint32_t nFile);
+
+
+        /** Mapping
+         *
+         *  Get the read-only mapping for a sealed file, mapping it if not in the pool yet.
+         *
+         *  @param[in] nFile The sector file number.
+         *
+         *  @return The mapped memory and its length, nullptr if the file could not be mapped.
+         *
+         **/
+        std::pair<const uint8_t*, uint64_t> mapping(const uint32_t nFile);
+
+    };
+}
+
+#endif
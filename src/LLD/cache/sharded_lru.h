@@ -0,0 +1,159 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLD_CACHE_SHARDED_LRU_H
+#define NEXUS_LLD_CACHE_SHARDED_LRU_H
+
+#include <LLD/cache/binary_lru.h>
+
+#include <cstdint>
+#include <vector>
+
+
+namespace LLD
+{
+    class SectorKey;
+
+
+    /** ShardedLRU
+    *
+    *   Lock-striped variant of the BinaryLRU.
+    *   Holds N independent BinaryLRU shards, each with its own lock and an equal slice of the
+    *   memory budget. Keys are assigned to shards by hash, so readers of different keys no
+    *   longer serialize on one mutex. With a single shard this behaves exactly as a BinaryLRU.
+    *
+    **/
+    class ShardedLRU
+    {
+        /* The shards of this cache, each guarded by its own lock. */
+        std::vector<BinaryLRU*> vShards;
+
+
+    public:
+
+
+        /** Default Constructor. **/
+        ShardedLRU()                                   = delete;
+
+
+		/** Copy Constructor. **/
+		ShardedLRU(const ShardedLRU& cache)            = delete;
+
+
+		/** Move Constructor. **/
+		ShardedLRU(ShardedLRU&& cache)                 = delete;
+
+
+		/** Copy assignment. **/
+		ShardedLRU& operator=(const ShardedLRU& cache) = delete;
+
+
+		/** Move assignment. **/
+		ShardedLRU& operator=(ShardedLRU&& cache)      = delete;
+
+
+        /** Class Destructor. **/
+        ~ShardedLRU();
+
+
+        /** Cache Size Constructor
+         *
+         *  @param[in] nCacheSizeIn The maximum size of this Cache Pool, divided among the shards.
+         *  @param[in] nShardsIn The total shards to stripe the cache over.
+         *
+         **/
+        ShardedLRU(const uint32_t nCacheSizeIn, const uint32_t nShardsIn = 1);
+
+
+        /** Has
+         *
+         *  Check if data exists.
+         *
+         *  @param[in] vKey The binary data of the key.
+         *
+         *  @return True/False whether pool contains data by index.
+         *
+         **/
+        bool Has(const std::vector<uint8_t>& vKey) const;
+
+
+        /** Get
+         *
+         *  Get the data by index
+         *
+         *  @param[in] vKey The binary data of the key.
+         *  @param[out] vData The binary data of the cached record.
+         *
+         *  @return True if object was found, false if none found by index.
+         *
+         **/
+        bool Get(const std::vector<uint8_t>& vKey, std::vector<uint8_t>& vData);
+
+
+        /** Put
+         *
+         *  Add data in the Pool
+         *
+         *  @param[in] vKey The key in binary form.
+         *  @param[in] vData The input data in binary form.
+         *  @param[in] fReserve Flag for if item should be saved from cache eviction.
+         *
+         **/
+        void Put(const SectorKey& key, const std::vector<uint8_t>& vKey, const std::vector<uint8_t>& vData, bool fReserve = false);
+
+
+        /** Reserve
+         *
+         *  Reserve this item in the cache permanently if true, unreserve if false
+         *
+         *  @param[in] vKey The key to flag as reserved true/false
+         *  @param[in] fReserve If this object is to be reserved for disk.
+         *
+         **/
+        void Reserve(const std::vector<uint8_t>& vKey, bool fReserve = true);
+
+
+        /** Remove
+         *
+         *  Force Remove Object by Index
+         *
+         *  @param[in] vKey Binary Data of the Key
+         *
+         *  @return True on successful removal, false if it fails
+         *
+         **/
+        bool Remove(const std::vector<uint8_t>& vKey);
+
+
+        /** Shards
+         *
+         *  Get the total shards this cache is striped over.
+         *
+         **/
+        uint32_t Shards() const;
+
+
+    private:
+
+        /** Shard
+         *
+         *  Find the shard responsible for a given key.
+         *
+         *  @param[in] vKey The key to get shard for.
+         *
+         **/
+        BinaryLRU* shard(const std::vector<uint8_t>& vKey) const;
+    };
+}
+
+#endif
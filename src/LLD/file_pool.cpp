@@ -0,0 +1,218 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+____________________________________________________________________________________________*/
+
+#include <LLD/cache/file_pool.h>
+
+#include <Util/include/mutex.h>
+#include <Util/include/debug.h>
+
+#ifdef WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iomanip>
+
+namespace LLD
+{
+
+    /** Location Constructor **/
+    FilePool::FilePool(const std::string& strBaseLocationIn, const bool fMemoryMapIn)
+    : POOL_MUTEX      ( )
+    , strBaseLocation (strBaseLocationIn)
+    , vDescriptors    ( )
+    , vMappings       ( )
+    , fMemoryMap      (fMemoryMapIn)
+    {
+    }
+
+
+    /** Class Destructor. **/
+    FilePool::~FilePool()
+    {
+        Close();
+    }
+
+
+    /*  Read a range of bytes from a sector file at given position. */
+    bool FilePool::Read(const uint32_t nFile, const uint64_t nOffset, std::vector<uint8_t>& vData, const bool fSealed)
+    {
+    #ifdef WIN32
+        /* No positional reads available, fall back to a private stream. */
+        std::ifstream stream(
+            debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nFile),
+            std::ios::in | std::ios::binary);
+
+        if(!stream.is_open())
+            return debug::error(FUNCTION, "couldn't open stream file for read");
+
+        /* Seek to the position on disk. */
+        stream.seekg(nOffset, std::ios::beg);
+
+        /* Read the data into the buffer. */
+        if(!stream.read((char*) &vData[0], vData.size()))
+            return debug::error(FUNCTION, "only ", stream.gcount(), "/", vData.size(), " bytes read");
+    #else
+        /* Serve sealed files straight out of the page cache if mapped. */
+        if(fMemoryMap && fSealed)
+        {
+            const std::pair<const uint8_t*, uint64_t> pairMap = mapping(nFile);
+            if(pairMap.first && nOffset + vData.size() <= pairMap.second)
+            {
+                std::copy(pairMap.first + nOffset, pairMap.first + nOffset + vData.size(), vData.begin());
+                return true;
+            }
+        }
+
+        /* Get our descriptor from the pool. */
+        const int nFD = descriptor(nFile);
+        if(nFD == -1)
+            return debug::error(FUNCTION, "couldn't open file ", nFile, " for read: ", std::strerror(errno));
+
+        /* Loop until the full buffer is read, pread can return short counts. */
+        uint64_t nRead = 0;
+        while(nRead < vData.size())
+        {
+            /* Read from our absolute position, leaving the descriptor offset untouched. */
+            const ssize_t nBytes = pread(nFD, &vData[nRead], vData.size() - nRead, nOffset + nRead);
+            if(nBytes < 0)
+            {
+                /* Try again if we were interrupted by a signal. */
+                if(errno == EINTR)
+                    continue;
+
+                return debug::error(FUNCTION, "pread failed: ", std::strerror(errno));
+            }
+
+            /* Check for end of file. */
+            if(nBytes == 0)
+                return debug::error(FUNCTION, "only ", nRead, "/", vData.size(), " bytes read");
+
+            nRead += nBytes;
+        }
+    #endif
+
+        return true;
+    }
+
+
+    /*  Close all the open descriptors, they will be re-opened on next read. */
+    void FilePool::Close()
+    {
+        WRITE_LOCK(POOL_MUTEX);
+
+    #ifndef WIN32
+        for(const auto& pairMap : vMappings)
+            if(pairMap.first)
+                ::munmap(const_cast<uint8_t*>(pairMap.first), pairMap.second);
+
+        for(const int& nFD : vDescriptors)
+            if(nFD != -1)
+                ::close(nFD);
+    #endif
+
+        vMappings.clear();
+        vDescriptors.clear();
+    }
+
+
+    /*  Get the descriptor for a given file, opening it if not in the pool yet. */
+    int FilePool::descriptor(const uint32_t nFile)
+    {
+    #ifdef WIN32
+        return -1;
+    #else
+        /* Check for an already opened descriptor. */
+        {
+            SHARED_LOCK(POOL_MUTEX);
+
+            if(nFile < vDescriptors.size() && vDescriptors[nFile] != -1)
+                return vDescriptors[nFile];
+        }
+
+        WRITE_LOCK(POOL_MUTEX);
+
+        /* Grow our pool if this is a new file. */
+        if(nFile >= vDescriptors.size())
+            vDescriptors.resize(nFile + 1, -1);
+
+        /* Check that another reader didn't open it while we waited for the lock. */
+        if(vDescriptors[nFile] == -1)
+        {
+            const std::string strPath =
+                debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nFile);
+
+            vDescriptors[nFile] = ::open(strPath.c_str(), O_RDONLY | O_CLOEXEC);
+        }
+
+        return vDescriptors[nFile];
+    #endif
+    }
+
+
+    /*  Get the read-only mapping for a sealed file, mapping it if not in the pool yet. */
+    std::pair<const uint8_t*, uint64_t> FilePool::mapping(const uint32_t nFile)
+    {
+    #ifdef WIN32
+        return std::make_pair(nullptr, 0);
+    #else
+        /* Check for an already mapped file. */
+        {
+            SHARED_LOCK(POOL_MUTEX);
+
+            if(nFile < vMappings.size() && vMappings[nFile].first)
+                return vMappings[nFile];
+        }
+
+        /* Get the descriptor to map from. */
+        const int nFD = descriptor(nFile);
+        if(nFD == -1)
+            return std::make_pair(nullptr, 0);
+
+        WRITE_LOCK(POOL_MUTEX);
+
+        /* Grow our mappings if this is a new file. */
+        if(nFile >= vMappings.size())
+            vMappings.resize(nFile + 1, std::make_pair(nullptr, 0));
+
+        /* Check that another reader didn't map it while we waited for the lock. */
+        if(!vMappings[nFile].first)
+        {
+            /* Sealed files don't grow, so map the full current length. */
+            struct stat fileStat;
+            if(::fstat(nFD, &fileStat) != 0 || fileStat.st_size == 0)
+                return std::make_pair(nullptr, 0);
+
+            void* pMap = ::mmap(nullptr, fileStat.st_size, PROT_READ, MAP_SHARED, nFD, 0);
+            if(pMap == MAP_FAILED)
+            {
+                debug::error(FUNCTION, "failed to map file ", nFile, ": ", std::strerror(errno));
+                return std::make_pair(nullptr, 0);
+            }
+
+            /* Let the kernel know our access pattern is random record lookups. */
+            ::madvise(pMap, fileStat.st_size, MADV_RANDOM);
+
+            vMappings[nFile] = std::make_pair(static_cast<const uint8_t*>(pMap), static_cast<uint64_t>(fileStat.st_size));
+        }
+
+        return vMappings[nFile];
+    #endif
+    }
+}
@@ -46,7 +46,7 @@ namespace LLD
         /* Create the contract database instance. */
         const uint32_t nRegisterCacheSize = config::GetArg("-registercache", 2);
         Register = new RegisterDB(
-                        FLAGS::CREATE | FLAGS::FORCE,
+                        FLAGS::CREATE | FLAGS::FORCE | FLAGS::SHARDED,
                         77773,
                         nRegisterCacheSize * 1024 * 1024);
 
@@ -54,10 +54,11 @@ namespace LLD
          * Default cache raised to 64 MB for mining node workloads.
          * Blocks average 216 bytes, so 64 MB holds ~300K typical blocks in
          * BinaryLRU cache, dramatically reducing SECTOR_MUTEX contention
-         * between P2P block-serving and mining template creation. */
-        const uint32_t nLedgerCacheSize = config::GetArg("-ledgercache", 64);
+         * between P2P block-serving and mining template creation.
+         * With -lldmmap sealed files are served from the page cache, so a smaller default suffices. */
+        const uint32_t nLedgerCacheSize = config::GetArg("-ledgercache", config::GetBoolArg("-lldmmap", false) ? 16 : 64);
         Ledger    = new LedgerDB(
-                        FLAGS::CREATE | FLAGS::FORCE,
+                        FLAGS::CREATE | FLAGS::FORCE | FLAGS::SHARDED | (config::GetBoolArg("-lldcompress", false) ? FLAGS::COMPRESS : 0),
                         config::fClient.load() ? 77773 : (256 * 256 * 64),
                         nLedgerCacheSize * 1024 * 1024);
 
@@ -120,6 +121,10 @@ namespace LLD
         Register->IndexAddress();
 
 
+        /* Check for reindexing entries. */
+        Register->IndexTypes();
+
+
         /* Check for reindexing entries. */
         Ledger->IndexProofs();
     }
@@ -38,6 +38,9 @@ namespace LLD
     , HASHMAP_KEY_ALLOCATION (static_cast<uint16_t>(HASHMAP_MAX_KEY_SIZE + 13))
     , nFlags                 (nFlagsIn)
     , RECORD_MUTEX           (1024)
+    , vFilter                ( )
+    , setTouched             ( )
+    , fIndexTouched          (false)
     {
         Initialize();
     }
@@ -55,6 +58,9 @@ namespace LLD
     , HASHMAP_KEY_ALLOCATION (map.HASHMAP_KEY_ALLOCATION)
     , nFlags                 (map.nFlags)
     , RECORD_MUTEX           (map.RECORD_MUTEX.size())
+    , vFilter                (map.vFilter)
+    , setTouched             (map.setTouched)
+    , fIndexTouched          (map.fIndexTouched)
     {
         Initialize();
     }
@@ -72,6 +78,9 @@ namespace LLD
     , HASHMAP_KEY_ALLOCATION (std::move(map.HASHMAP_KEY_ALLOCATION))
     , nFlags                 (std::move(map.nFlags))
     , RECORD_MUTEX           (map.RECORD_MUTEX.size())
+    , vFilter                (std::move(map.vFilter))
+    , setTouched             (std::move(map.setTouched))
+    , fIndexTouched          (std::move(map.fIndexTouched))
     {
         Initialize();
     }
@@ -88,6 +97,9 @@ namespace LLD
         HASHMAP_MAX_KEY_SIZE   = map.HASHMAP_MAX_KEY_SIZE;
         HASHMAP_KEY_ALLOCATION = map.HASHMAP_KEY_ALLOCATION;
         nFlags                 = map.nFlags;
+        vFilter                = map.vFilter;
+        setTouched             = map.setTouched;
+        fIndexTouched          = map.fIndexTouched;
 
         Initialize();
 
@@ -106,6 +118,9 @@ namespace LLD
         HASHMAP_MAX_KEY_SIZE   = std::move(map.HASHMAP_MAX_KEY_SIZE);
         HASHMAP_KEY_ALLOCATION = std::move(map.HASHMAP_KEY_ALLOCATION);
         nFlags                 = std::move(map.nFlags);
+        vFilter                = std::move(map.vFilter);
+        setTouched             = std::move(map.setTouched);
+        fIndexTouched          = std::move(map.fIndexTouched);
 
         Initialize();
 
@@ -116,6 +131,9 @@ namespace LLD
     /* Default Destructor */
     BinaryHashMap::~BinaryHashMap()
     {
+        /* Keep our filters for the next startup. */
+        save_filter();
+
         if(fileCache)
             delete fileCache;
 
@@ -223,6 +241,10 @@ namespace LLD
 
         /* Load the stream object into the stream LRU cache. */
         fileCache->Put(0, new std::fstream(file, std::ios::in | std::ios::out | std::ios::binary));
+
+        /* Build our bucket filters if not copied from another keychain. */
+        if(vFilter.empty())
+            load_filter();
     }
 
 
@@ -244,6 +266,11 @@ namespace LLD
         std::vector<uint8_t> vKeyCompressed = vKey;
         CompressKey(vKeyCompressed, HASHMAP_MAX_KEY_SIZE);
 
+        /* Check our bucket filter so that keys that don't exist never touch the disk. */
+        const uint32_t nFingerprint = fingerprint(vKeyCompressed);
+        if((vFilter[nBucket] & nFingerprint) != nFingerprint)
+            return false;
+
         /* Reverse iterate the linked file list from hashmap to get most recent keys first. */
         std::vector<uint8_t> vBucket(HASHMAP_KEY_ALLOCATION, 0);
         for(int16_t i = hashmap[nBucket] - 1; i >= 0; --i)
@@ -322,6 +349,9 @@ namespace LLD
         std::vector<uint8_t> vKeyCompressed = cKey.vKey;
         CompressKey(vKeyCompressed, HASHMAP_MAX_KEY_SIZE);
 
+        /* Add the key to our bucket filter, erased keys leave their bits set which only costs a disk read. */
+        vFilter[nBucket] |= fingerprint(vKeyCompressed);
+
         /* Handle if not in append mode which will update the key. */
         if(!(nFlags & FLAGS::APPEND))
         {
@@ -396,6 +426,7 @@ namespace LLD
                     pstream->seekp (nFilePos, std::ios::beg);
                     pstream->write((char*)&ssKey.Bytes()[0], ssKey.size());
                     pstream->flush();
+                    setTouched.insert(i);
 
 
                     /* Debug Output of Sector Key Information. */
@@ -465,6 +496,7 @@ namespace LLD
         pstream->seekp (nFilePos, std::ios::beg);
         pstream->write((char*)&ssKey.Bytes()[0], ssKey.size());
         pstream->flush();
+        setTouched.insert(hashmap[nBucket]);
 
         /* Check index file handle is open. */
         if(!pindex->is_open())
@@ -482,6 +514,7 @@ namespace LLD
         /* Write the index into hashmap. */
         pindex->write((char*)&vBucket[0], vBucket.size());
         pindex->flush();
+        fIndexTouched = true;
 
         /* Debug Output of Sector Key Information. */
         if(config::nVerbose >= 4)
@@ -523,6 +556,24 @@ namespace LLD
     }
 
 
+    /* Get the files written since the last call, so they can be synced. */
+    void BinaryHashMap::Touched(std::set<std::string>& setFiles)
+    {
+        LOCK(KEY_MUTEX);
+
+        /* Add the hashmap files we wrote keys to. */
+        for(const auto& nFile : setTouched)
+            setFiles.insert(debug::safe_printstr(strBaseLocation, "_hashmap.", std::setfill('0'), std::setw(5), nFile));
+
+        /* Add the index if a bucket grew. */
+        if(fIndexTouched)
+            setFiles.insert(debug::safe_printstr(strBaseLocation, "_hashmap.index"));
+
+        setTouched.clear();
+        fIndexTouched = false;
+    }
+
+
     /*  Erase a key from the disk hashmaps.
      *  TODO: This should be optimized further. */
     bool BinaryHashMap::Erase(const std::vector<uint8_t> &vKey)
@@ -577,6 +628,7 @@ namespace LLD
                 std::vector<uint8_t> vEmpty(HASHMAP_KEY_ALLOCATION, 0);
                 pstream->write((char*) &vEmpty[0], vEmpty.size());
                 pstream->flush();
+                setTouched.insert(i);
 
                 /* Debug Output of Sector Key Information. */
                 if(config::nVerbose >= 4)
@@ -655,6 +707,7 @@ namespace LLD
                 std::vector<uint8_t> vReady(STATE::READY);
                 pstream->write((char*) &vReady[0], vReady.size());
                 pstream->flush();
+                setTouched.insert(i);
 
                 /* Debug Output of Sector Key Information. */
                 if(config::nVerbose >= 4)
@@ -674,4 +727,99 @@ namespace LLD
 
         return false;
     }
+
+
+    /* Calculates the filter bits a compressed key sets in its bucket's filter word. */
+    uint32_t BinaryHashMap::fingerprint(const std::vector<uint8_t>& vKeyCompressed) const
+    {
+        /* Seed differently from GetBucket so the bits are independent of bucket selection. */
+        const uint64_t nHash = XXH64(&vKeyCompressed[0], vKeyCompressed.size(), 1);
+
+        return (uint32_t(1) << (nHash & 31)) | (uint32_t(1) << ((nHash >> 8) & 31));
+    }
+
+
+    /* Loads the bucket filters written on last clean shutdown, or rebuilds them. */
+    void BinaryHashMap::load_filter()
+    {
+        vFilter.assign(HASHMAP_TOTAL_BUCKETS, 0);
+
+        /* Check for the filters from our last clean shutdown. */
+        const std::string strFilter = debug::safe_printstr(strBaseLocation, "_hashmap.filter");
+        if(filesystem::size(strFilter) == static_cast<int64_t>(HASHMAP_TOTAL_BUCKETS * 4))
+        {
+            std::ifstream stream(strFilter, std::ios::in | std::ios::binary);
+            stream.read((char*)&vFilter[0], vFilter.size() * 4);
+            stream.close();
+
+            /* Remove the file so that a crash before next shutdown forces a rebuild. */
+            filesystem::remove(strFilter);
+
+            debug::log(0, FUNCTION, "Loaded Bucket Filters of ", vFilter.size() * 4, " bytes");
+            return;
+        }
+
+        /* Find how many hashmap files we need to scan. */
+        uint16_t nFiles = 0;
+        for(const auto& nIndex : hashmap)
+            nFiles = std::max(nFiles, nIndex);
+
+        /* Scan the hashmap files sequentially in large chunks. */
+        const uint32_t nChunk = 65536;
+        uint64_t nTotalKeys = 0;
+        for(uint16_t nFile = 0; nFile < nFiles; ++nFile)
+        {
+            std::ifstream stream(debug::safe_printstr(strBaseLocation, "_hashmap.", std::setfill('0'), std::setw(5), nFile),
+                std::ios::in | std::ios::binary);
+
+            if(!stream.is_open())
+                continue;
+
+            std::vector<uint8_t> vBuffer(nChunk * HASHMAP_KEY_ALLOCATION, 0);
+            for(uint32_t nStart = 0; nStart < HASHMAP_TOTAL_BUCKETS; nStart += nChunk)
+            {
+                const uint32_t nBuckets = std::min(nChunk, HASHMAP_TOTAL_BUCKETS - nStart);
+                if(!stream.read((char*)&vBuffer[0], nBuckets * HASHMAP_KEY_ALLOCATION))
+                    break;
+
+                for(uint32_t n = 0; n < nBuckets; ++n)
+                {
+                    /* Skip buckets that don't reach this file or are empty. */
+                    const uint32_t nBucket = nStart + n;
+                    const uint8_t* pSlot   = &vBuffer[n * HASHMAP_KEY_ALLOCATION];
+                    if(nFile >= hashmap[nBucket] || pSlot[0] == STATE::EMPTY)
+                        continue;
+
+                    /* Get our key length from the serialized sector key. */
+                    uint16_t nLength = 0;
+                    std::copy(pSlot + 1, pSlot + 3, (uint8_t*)&nLength);
+
+                    /* Compressed keys are never longer than our max key size. */
+                    const std::vector<uint8_t> vKeyCompressed(pSlot + 13, pSlot + 13 + std::min(nLength, HASHMAP_MAX_KEY_SIZE));
+                    if(vKeyCompressed.empty())
+                        continue;
+
+                    vFilter[nBucket] |= fingerprint(vKeyCompressed);
+                    ++nTotalKeys;
+                }
+            }
+        }
+
+        debug::log(0, FUNCTION, "Built Bucket Filters from ", nFiles, " files and ", nTotalKeys, " keys");
+    }
+
+
+    /* Writes the bucket filters to disk so the next startup can skip the rebuild. */
+    void BinaryHashMap::save_filter()
+    {
+        LOCK(KEY_MUTEX);
+
+        /* Check that we have filters to save. */
+        if(vFilter.size() != HASHMAP_TOTAL_BUCKETS)
+            return;
+
+        std::ofstream stream(debug::safe_printstr(strBaseLocation, "_hashmap.filter"), std::ios::out | std::ios::binary | std::ios::trunc);
+        stream.write((char*)&vFilter[0], vFilter.size() * 4);
+        stream.close();
+    }
 }
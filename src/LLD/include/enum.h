@@ -29,7 +29,9 @@ namespace LLD
         READONLY      = (1 << 2),
         CREATE        = (1 << 3),
         WRITE         = (1 << 4),
-        FORCE         = (1 << 5)
+        FORCE         = (1 << 5),
+        SHARDED       = (1 << 6),
+        COMPRESS      = (1 << 7)
     };
 
 
@@ -0,0 +1,156 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLD_INCLUDE_SNAPSHOT_H
+#define NEXUS_LLD_INCLUDE_SNAPSHOT_H
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/templates/serialize.h>
+
+#include <string>
+#include <vector>
+
+namespace LLD
+{
+
+    /* The version of the snapshot format. */
+    const uint32_t SNAPSHOT_VERSION = 1;
+
+
+    /* The size of the chunks a snapshot is checksummed and verified in. */
+    const uint32_t SNAPSHOT_CHUNK_SIZE = 1024 * 1024 * 16; //16 MB Chunks
+
+
+    /** SnapshotManifest
+     *
+     *  Describes the contents of a snapshot of the consensus databases.
+     *
+     *  A snapshot file is the size of the serialized manifest as four bytes, the manifest, the SK256 hash of
+     *  the manifest, and then the contents of every file in manifest order. Each file is split into chunks of
+     *  nChunkSize bytes, the last one possibly shorter, and every chunk has its SK256 hash in the manifest.
+     *  The hash of the manifest therefore commits to the whole snapshot.
+     *
+     **/
+    class SnapshotManifest
+    {
+    public:
+
+        /** The version of the snapshot format. **/
+        uint32_t nVersion;
+
+
+        /** The height of the best chain the snapshot was taken at. **/
+        uint32_t nHeight;
+
+
+        /** The hash of the best chain the snapshot was taken at. **/
+        uint1024_t hashBlock;
+
+
+        /** The size of the chunks. **/
+        uint32_t nChunkSize;
+
+
+        /** The files relative to the data directory, with their sizes. **/
+        std::vector<std::pair<std::string, uint64_t>> vFiles;
+
+
+        /** The hashes of the chunks of every file in order. **/
+        std::vector<uint256_t> vChunks;
+
+
+        /** Serialization **/
+        IMPLEMENT_SERIALIZE
+        (
+            READWRITE(nVersion);
+            READWRITE(nHeight);
+            READWRITE(hashBlock);
+            READWRITE(nChunkSize);
+            READWRITE(vFiles);
+            READWRITE(vChunks);
+        )
+
+
+        /** Default Constructor. **/
+        SnapshotManifest();
+
+
+        /** Chunks
+         *
+         *  Get the number of chunks a file of the given size is split into.
+         *
+         *  @param[in] nSize The size of the file.
+         *
+         **/
+        uint64_t Chunks(const uint64_t nSize) const;
+    };
+
+
+    /** SnapshotExport
+     *
+     *  Write a snapshot of the consensus databases as they are on disk. This must be called at startup before
+     *  anything else can write to the databases, so the files match the best chain until it returns.
+     *
+     *  @param[in] strFile The file to write the snapshot to.
+     *  @param[in] nHeight The height of the best chain.
+     *  @param[in] hashBlock The hash of the best chain.
+     *
+     *  @return true if the snapshot was written.
+     *
+     **/
+    bool SnapshotExport(const std::string& strFile, const uint32_t nHeight, const uint1024_t& hashBlock);
+
+
+    /** SnapshotImport
+     *
+     *  Verify a snapshot and replace the consensus databases with it. This must be called before the
+     *  databases are opened. The replaced databases are kept aside until SnapshotCommit or SnapshotRollback.
+     *
+     *  @param[in] strFile The snapshot file to import.
+     *  @param[out] hashBlock The hash of the best chain the snapshot was taken at.
+     *
+     *  @return true if the snapshot was verified and imported.
+     *
+     **/
+    bool SnapshotImport(const std::string& strFile, uint1024_t& hashBlock);
+
+
+    /** SnapshotCommit
+     *
+     *  Delete the databases an import replaced, once the imported ones are known to hold the right best chain.
+     *
+     **/
+    void SnapshotCommit();
+
+
+    /** SnapshotRollback
+     *
+     *  Put back the databases an import replaced. This must be called with the databases closed.
+     *
+     **/
+    void SnapshotRollback();
+
+
+    /** SnapshotPath
+     *
+     *  Get the file a snapshot at a given height is exported to.
+     *
+     *  @param[in] nHeight The height of the snapshot.
+     *
+     **/
+    std::string SnapshotPath(const uint32_t nHeight);
+}
+
+#endif
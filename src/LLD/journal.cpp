@@ -0,0 +1,610 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLD/templates/journal.h>
+#include <LLD/include/version.h>
+#include <LLD/hash/xxh3.h>
+
+#include <Util/templates/datastream.h>
+#include <Util/include/mutex.h>
+#include <Util/include/debug.h>
+
+#ifdef WIN32
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace LLD
+{
+
+    /* Magic bytes at the start of every record. */
+    const uint32_t JOURNAL_MAGIC = 0x4a444c4c; //LLDJ
+
+
+    /* Size of the record header: magic, epoch, length, checksum. */
+    const uint32_t JOURNAL_HEADER_SIZE = 20;
+
+
+    /* Magic bytes at the start of the superblock. */
+    const uint32_t JOURNAL_EPOCH_MAGIC = 0x454c4c4c; //LLLE
+
+
+    /* Size of the superblock: magic, epoch, begin, checksum. */
+    const uint32_t JOURNAL_EPOCH_SIZE = 24;
+
+
+    /* Records start after the superblock, on their own page. */
+    const uint64_t JOURNAL_DATA_OFFSET = 4096;
+
+
+    /* The record types of the journal. */
+    const uint8_t JOURNAL_CHECKPOINT = 0x01;
+    const uint8_t JOURNAL_RELEASE    = 0x02;
+
+
+    /* The shared journals indexed by their file location. */
+    std::map<std::string, std::pair<Journal*, uint32_t>> Journal::mapJournals;
+
+
+    /* Mutex to guard the shared journals. */
+    std::mutex Journal::JOURNALS_MUTEX;
+
+
+    /* Positional write of a full buffer, looping on short writes. */
+    static bool write_at(const int nFile, const uint8_t* pData, const uint64_t nSize, const uint64_t nOffset)
+    {
+    #ifdef WIN32
+        /* Callers hold the journal lock, so a seek and write pair is safe here. */
+        if(_lseeki64(nFile, nOffset, SEEK_SET) < 0)
+            return false;
+
+        return _write(nFile, pData, static_cast<uint32_t>(nSize)) == static_cast<int>(nSize);
+    #else
+        uint64_t nWrote = 0;
+        while(nWrote < nSize)
+        {
+            const ssize_t nBytes = pwrite(nFile, pData + nWrote, nSize - nWrote, nOffset + nWrote);
+            if(nBytes < 0)
+            {
+                /* Try again if we were interrupted by a signal. */
+                if(errno == EINTR)
+                    continue;
+
+                return false;
+            }
+
+            nWrote += nBytes;
+        }
+
+        return true;
+    #endif
+    }
+
+
+    /* Positional read of a full buffer, false on end of file. */
+    static bool read_at(const int nFile, uint8_t* pData, const uint64_t nSize, const uint64_t nOffset)
+    {
+    #ifdef WIN32
+        if(_lseeki64(nFile, nOffset, SEEK_SET) < 0)
+            return false;
+
+        return _read(nFile, pData, static_cast<uint32_t>(nSize)) == static_cast<int>(nSize);
+    #else
+        uint64_t nRead = 0;
+        while(nRead < nSize)
+        {
+            const ssize_t nBytes = pread(nFile, pData + nRead, nSize - nRead, nOffset + nRead);
+            if(nBytes < 0)
+            {
+                /* Try again if we were interrupted by a signal. */
+                if(errno == EINTR)
+                    continue;
+
+                return false;
+            }
+
+            /* Check for end of file. */
+            if(nBytes == 0)
+                return false;
+
+            nRead += nBytes;
+        }
+
+        return true;
+    #endif
+    }
+
+
+    /* Flush the data of a file to disk. */
+    static bool sync_file(const int nFile)
+    {
+    #if defined(WIN32)
+        return _commit(nFile) == 0;
+    #elif defined(MAC_OSX) || defined(__APPLE__)
+        return fsync(nFile) == 0;
+    #else
+        return fdatasync(nFile) == 0;
+    #endif
+    }
+
+
+    /* Flush the data of a file given by its location to disk. */
+    static bool sync_path(const std::string& strFile)
+    {
+    #ifdef WIN32
+        const int nFile = _open(strFile.c_str(), _O_RDWR | _O_BINARY);
+    #else
+        const int nFile = ::open(strFile.c_str(), O_RDONLY | O_CLOEXEC);
+    #endif
+
+        /* A file that is gone has nothing left to sync. */
+        if(nFile == -1)
+            return errno == ENOENT;
+
+        const bool fSuccess = sync_file(nFile);
+
+    #ifdef WIN32
+        _close(nFile);
+    #else
+        ::close(nFile);
+    #endif
+
+        return fSuccess;
+    }
+
+
+    /** Location Constructor **/
+    Journal::Journal(const std::string& strPathIn)
+    : JOURNAL_MUTEX  ( )
+    , SYNC_CONDITION ( )
+    , strPath        (strPathIn)
+    , nFile          (-1)
+    , nEpoch         (0)
+    , nBegin         (JOURNAL_DATA_OFFSET)
+    , nTail          (JOURNAL_DATA_OFFSET)
+    , nWritten       (0)
+    , nSynced        (0)
+    , fSyncing       (false)
+    , setPending     ( )
+    , setDirty       ( )
+    , mapRecovery    ( )
+    {
+    #ifdef WIN32
+        nFile = _open(strPath.c_str(), _O_RDWR | _O_CREAT | _O_BINARY, _S_IREAD | _S_IWRITE);
+    #else
+        nFile = ::open(strPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    #endif
+        if(nFile == -1)
+        {
+            debug::error(FUNCTION, "failed to open journal ", strPath, ": ", std::strerror(errno));
+            return;
+        }
+
+        /* A missing or torn superblock starts the journal over, so no stale record can be replayed. */
+        const bool fEpoch = read_epoch();
+        if(!fEpoch)
+        {
+        #ifdef WIN32
+            _chsize_s(nFile, 0);
+        #else
+            if(::ftruncate(nFile, 0) != 0)
+                debug::error(FUNCTION, "failed to reset journal: ", std::strerror(errno));
+        #endif
+        }
+
+        /* Find our pending checkpoints from last run. */
+        if(fEpoch)
+            replay();
+
+        /* Preallocate with zeros so that appends within the file only touch data blocks. */
+    #ifdef WIN32
+        const int64_t nSize = _lseeki64(nFile, 0, SEEK_END);
+    #else
+        const int64_t nSize = ::lseek(nFile, 0, SEEK_END);
+    #endif
+        if(nSize >= 0 && static_cast<uint64_t>(nSize) < JOURNAL_PREALLOCATE_SIZE)
+        {
+            const std::vector<uint8_t> vZero(1024 * 1024, 0);
+            for(uint64_t nPos = nSize; nPos < JOURNAL_PREALLOCATE_SIZE; nPos += vZero.size())
+            {
+                const uint64_t nChunk = std::min<uint64_t>(vZero.size(), JOURNAL_PREALLOCATE_SIZE - nPos);
+                if(!write_at(nFile, &vZero[0], nChunk, nPos))
+                {
+                    debug::error(FUNCTION, "failed to preallocate journal: ", std::strerror(errno));
+                    break;
+                }
+            }
+
+            sync_file(nFile);
+        }
+
+        /* Start a new epoch for this run, carrying over our pending checkpoints. */
+        if(!rewind())
+            debug::error(FUNCTION, "failed to start journal epoch: ", std::strerror(errno));
+    }
+
+
+    /** Class Destructor. **/
+    Journal::~Journal()
+    {
+        if(nFile == -1)
+            return;
+
+        sync_file(nFile);
+
+    #ifdef WIN32
+        _close(nFile);
+    #else
+        ::close(nFile);
+    #endif
+    }
+
+
+    /*  Get the shared journal for a given location, opening it on first use. */
+    Journal* Journal::Open(const std::string& strPathIn)
+    {
+        LOCK(JOURNALS_MUTEX);
+
+        /* Check for an existing journal at this location. */
+        auto& pairJournal = mapJournals[strPathIn];
+        if(!pairJournal.first)
+            pairJournal.first = new Journal(strPathIn);
+
+        ++pairJournal.second;
+
+        return pairJournal.first;
+    }
+
+
+    /*  Release a shared journal, closing it once no database uses it. */
+    void Journal::Close(Journal* pJournal)
+    {
+        LOCK(JOURNALS_MUTEX);
+
+        /* Check that we know of this journal. */
+        auto it = mapJournals.find(pJournal->strPath);
+        if(it == mapJournals.end() || it->second.first != pJournal)
+            return;
+
+        /* Cleanup on the last reference. */
+        if(--it->second.second == 0)
+        {
+            delete it->second.first;
+            mapJournals.erase(it);
+        }
+    }
+
+
+    /*  Append a checkpoint record for a database. */
+    uint64_t Journal::Append(const std::string& strName, const std::vector<uint8_t>& vData)
+    {
+        LOCK(JOURNAL_MUTEX);
+
+        /* Write our checkpoint to the tail. */
+        if(!write(strName, JOURNAL_CHECKPOINT, vData))
+            return 0;
+
+        /* Track that this database has a checkpoint in flight. */
+        setPending.insert(strName);
+
+        return nWritten;
+    }
+
+
+    /*  Make all records up to given log sequence number durable. */
+    bool Journal::Sync(const uint64_t nSequence)
+    {
+        std::unique_lock<std::mutex> lk(JOURNAL_MUTEX);
+        while(nSynced < std::min(nSequence, nWritten))
+        {
+            /* Follow a sync already in flight, it may cover our records too. */
+            if(fSyncing)
+            {
+                SYNC_CONDITION.wait(lk);
+                continue;
+            }
+
+            /* Lead a sync covering everything appended so far. */
+            fSyncing = true;
+            const uint64_t nTarget = nWritten;
+
+            /* Flush without holding the lock so others can append into the next group. */
+            lk.unlock();
+            const bool fSuccess = sync_file(nFile);
+            lk.lock();
+
+            /* Wake up our followers. */
+            fSyncing = false;
+            if(fSuccess)
+                nSynced = std::max(nSynced, nTarget);
+
+            SYNC_CONDITION.notify_all();
+
+            if(!fSuccess)
+                return debug::error(FUNCTION, "failed to sync journal: ", std::strerror(errno));
+        }
+
+        return true;
+    }
+
+
+    /*  Mark the checkpoint of a database as applied. */
+    void Journal::Release(const std::string& strName, const std::set<std::string>& setFiles)
+    {
+        LOCK(JOURNAL_MUTEX);
+
+        /* Nothing to do if there was no checkpoint. */
+        if(!setPending.erase(strName))
+            return;
+
+        /* The checkpoint can only be dropped once the data it wrote is durable. */
+        setDirty.insert(setFiles.begin(), setFiles.end());
+
+        /* Check if any claimed checkpoints are still in flight. */
+        bool fPending = false;
+        for(const auto& strPending : setPending)
+        {
+            if(!mapRecovery.count(strPending))
+            {
+                fPending = true;
+                break;
+            }
+        }
+
+        /* Record the release so replay won't apply this checkpoint again, it is synced with the next group commit. */
+        if(fPending)
+        {
+            write(strName, JOURNAL_RELEASE, std::vector<uint8_t>());
+            return;
+        }
+
+        /* Sync the data files of every released checkpoint once for the whole group. */
+        for(const auto& strFile : setDirty)
+        {
+            if(!sync_path(strFile))
+            {
+                /* Keep our records, replaying them again is harmless, and retry with the next group. */
+                debug::error(FUNCTION, "failed to sync ", strFile, ": ", std::strerror(errno));
+                return;
+            }
+        }
+        setDirty.clear();
+
+        /* Rewind under a new epoch once nothing claimed is in flight, stale records are then ignored on replay. */
+        if(!rewind())
+            debug::error(FUNCTION, "failed to rewind journal: ", std::strerror(errno));
+    }
+
+
+    /*  Get the last checkpoint of a database found on replay that was never released. */
+    bool Journal::Recover(const std::string& strName, std::vector<uint8_t>& vData)
+    {
+        LOCK(JOURNAL_MUTEX);
+
+        /* Check for a checkpoint to recover. */
+        auto it = mapRecovery.find(strName);
+        if(it == mapRecovery.end())
+            return false;
+
+        /* The database owns this checkpoint now, it stays pending until released. */
+        vData = it->second;
+        mapRecovery.erase(it);
+
+        return true;
+    }
+
+
+    /*  Build a record of the current epoch. */
+    std::vector<uint8_t> Journal::record(const std::string& strName, const uint8_t nType, const std::vector<uint8_t>& vData) const
+    {
+        /* Build the payload. */
+        DataStream ssPayload(SER_LLD, DATABASE_VERSION);
+        ssPayload << strName << nType << vData;
+
+        const std::vector<uint8_t>& vPayload = ssPayload.Bytes();
+        const uint32_t nLength   = static_cast<uint32_t>(vPayload.size());
+        const uint64_t nChecksum = XXH64(&vPayload[0], vPayload.size(), nEpoch);
+
+        /* Build the full record so it is written with a single call. */
+        std::vector<uint8_t> vRecord(JOURNAL_HEADER_SIZE + vPayload.size());
+        std::copy((uint8_t*)&JOURNAL_MAGIC, (uint8_t*)&JOURNAL_MAGIC + 4, vRecord.begin());
+        std::copy((uint8_t*)&nEpoch,        (uint8_t*)&nEpoch    + 4,     vRecord.begin() + 4);
+        std::copy((uint8_t*)&nLength,       (uint8_t*)&nLength   + 4,     vRecord.begin() + 8);
+        std::copy((uint8_t*)&nChecksum,     (uint8_t*)&nChecksum + 8,     vRecord.begin() + 12);
+        std::copy(vPayload.begin(), vPayload.end(), vRecord.begin() + JOURNAL_HEADER_SIZE);
+
+        return vRecord;
+    }
+
+
+    /*  Write a record at the tail of the journal. */
+    bool Journal::write(const std::string& strName, const uint8_t nType, const std::vector<uint8_t>& vData)
+    {
+        /* Check that our journal is open. */
+        if(nFile == -1)
+            return debug::error(FUNCTION, "journal ", strPath, " is not open");
+
+        /* Write the record at our tail. */
+        const std::vector<uint8_t> vRecord = record(strName, nType, vData);
+        if(!write_at(nFile, &vRecord[0], vRecord.size(), nTail))
+            return debug::error(FUNCTION, "failed to write journal: ", std::strerror(errno));
+
+        nTail    += vRecord.size();
+        nWritten += vRecord.size();
+
+        return true;
+    }
+
+
+    /*  Start a new epoch, carrying over the checkpoints that haven't been claimed. */
+    bool Journal::rewind()
+    {
+        /* Check that our journal is open. */
+        if(nFile == -1)
+            return false;
+
+        /* Build the records we carry over under our new epoch. */
+        ++nEpoch;
+
+        uint64_t nSize = 0;
+        std::vector<std::vector<uint8_t>> vCarry;
+        for(const auto& pairRecovery : mapRecovery)
+        {
+            vCarry.push_back(record(pairRecovery.first, JOURNAL_CHECKPOINT, pairRecovery.second));
+            nSize += vCarry.back().size();
+        }
+
+        /* Carry over below the records of our last epoch if they fit, otherwise after them, so they stay intact until the swap. */
+        uint64_t nStart = JOURNAL_DATA_OFFSET;
+        if(!vCarry.empty() && nBegin < JOURNAL_DATA_OFFSET + nSize)
+            nStart = nTail;
+
+        /* Write our carried over records. */
+        uint64_t nPos = nStart;
+        for(const auto& vRecord : vCarry)
+        {
+            if(!write_at(nFile, &vRecord[0], vRecord.size(), nPos))
+                return false;
+
+            nPos     += vRecord.size();
+            nWritten += vRecord.size();
+        }
+
+        /* Make them durable before our superblock points at them. */
+        if(!vCarry.empty() && !sync_file(nFile))
+            return false;
+
+        /* Swap our superblock to the new epoch. */
+        nBegin = nStart;
+        nTail  = nPos;
+        if(!write_epoch())
+            return false;
+
+        nSynced = std::max(nSynced, nWritten);
+
+        return true;
+    }
+
+
+    /*  Read the current epoch and where its records begin from the superblock. */
+    bool Journal::read_epoch()
+    {
+        /* Read our superblock. */
+        std::vector<uint8_t> vBlock(JOURNAL_EPOCH_SIZE, 0);
+        if(!read_at(nFile, &vBlock[0], vBlock.size(), 0))
+            return false;
+
+        /* Parse our superblock. */
+        uint32_t nMagic = 0, nRecord = 0;
+        uint64_t nStart = 0, nChecksum = 0;
+        std::copy(vBlock.begin(),      vBlock.begin() + 4,  (uint8_t*)&nMagic);
+        std::copy(vBlock.begin() + 4,  vBlock.begin() + 8,  (uint8_t*)&nRecord);
+        std::copy(vBlock.begin() + 8,  vBlock.begin() + 16, (uint8_t*)&nStart);
+        std::copy(vBlock.begin() + 16, vBlock.begin() + 24, (uint8_t*)&nChecksum);
+
+        /* Check that it is ours and wasn't torn. */
+        if(nMagic != JOURNAL_EPOCH_MAGIC || nStart < JOURNAL_DATA_OFFSET || XXH64(&vBlock[0], 16, 0) != nChecksum)
+            return false;
+
+        nEpoch = nRecord;
+        nBegin = nStart;
+        nTail  = nStart;
+
+        return true;
+    }
+
+
+    /*  Write the current epoch and where its records begin to the superblock and sync it. */
+    bool Journal::write_epoch()
+    {
+        /* Build our superblock. */
+        std::vector<uint8_t> vBlock(JOURNAL_EPOCH_SIZE, 0);
+        std::copy((uint8_t*)&JOURNAL_EPOCH_MAGIC, (uint8_t*)&JOURNAL_EPOCH_MAGIC + 4, vBlock.begin());
+        std::copy((uint8_t*)&nEpoch,              (uint8_t*)&nEpoch + 4,              vBlock.begin() + 4);
+        std::copy((uint8_t*)&nBegin,              (uint8_t*)&nBegin + 8,              vBlock.begin() + 8);
+
+        const uint64_t nChecksum = XXH64(&vBlock[0], 16, 0);
+        std::copy((uint8_t*)&nChecksum, (uint8_t*)&nChecksum + 8, vBlock.begin() + 16);
+
+        /* Write and sync it, a single sector write is atomic. */
+        if(!write_at(nFile, &vBlock[0], vBlock.size(), 0))
+            return false;
+
+        return sync_file(nFile);
+    }
+
+
+    /*  Scan the journal file for the records of the current epoch. */
+    void Journal::replay()
+    {
+        std::vector<uint8_t> vHeader(JOURNAL_HEADER_SIZE, 0);
+        for(uint64_t nPos = nBegin; read_at(nFile, &vHeader[0], vHeader.size(), nPos); )
+        {
+            /* Parse our header. */
+            uint32_t nMagic = 0, nRecord = 0, nLength = 0;
+            uint64_t nChecksum = 0;
+            std::copy(vHeader.begin(),      vHeader.begin() + 4,  (uint8_t*)&nMagic);
+            std::copy(vHeader.begin() + 4,  vHeader.begin() + 8,  (uint8_t*)&nRecord);
+            std::copy(vHeader.begin() + 8,  vHeader.begin() + 12, (uint8_t*)&nLength);
+            std::copy(vHeader.begin() + 12, vHeader.begin() + 20, (uint8_t*)&nChecksum);
+
+            /* Stop at the end of our records, or at a stale record of any other epoch. */
+            if(nMagic != JOURNAL_MAGIC || nLength == 0 || nRecord != nEpoch)
+                break;
+
+            /* Read and verify the payload, a torn write ends the journal. */
+            std::vector<uint8_t> vPayload(nLength, 0);
+            if(!read_at(nFile, &vPayload[0], vPayload.size(), nPos + JOURNAL_HEADER_SIZE)
+            || XXH64(&vPayload[0], vPayload.size(), nRecord) != nChecksum)
+                break;
+
+            try
+            {
+                /* Parse the payload. */
+                const DataStream ssPayload(vPayload, SER_LLD, DATABASE_VERSION);
+
+                std::string strName;
+                uint8_t nType = 0;
+                std::vector<uint8_t> vData;
+                ssPayload >> strName >> nType >> vData;
+
+                /* Keep the last checkpoint of each database that wasn't released. */
+                if(nType == JOURNAL_CHECKPOINT)
+                    mapRecovery[strName] = vData;
+                else if(nType == JOURNAL_RELEASE)
+                    mapRecovery.erase(strName);
+            }
+            catch(const std::exception& e)
+            {
+                break;
+            }
+
+            nPos  += JOURNAL_HEADER_SIZE + nLength;
+            nTail  = nPos;
+        }
+
+        /* Our checkpoints to recover stay pending until their database releases them. */
+        for(const auto& pairRecovery : mapRecovery)
+            setPending.insert(pairRecovery.first);
+
+        if(!mapRecovery.empty())
+            debug::log(0, FUNCTION, "journal ", strPath, " has ", mapRecovery.size(), " checkpoints to recover");
+    }
+}
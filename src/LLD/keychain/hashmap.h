@@ -22,6 +22,7 @@ ________________________________________________________________________________
 #include <cstdint>
 #include <string>
 #include <fstream>
+#include <set>
 #include <vector>
 #include <mutex>
 
@@ -81,6 +82,18 @@ namespace LLD
         mutable std::vector<std::mutex> RECORD_MUTEX;
 
 
+        /** Memory resident bloom filter word per bucket, covering the keys in all hashmap files. **/
+        std::vector<uint32_t> vFilter;
+
+
+        /** The hashmap files written since they were last synced. **/
+        std::set<uint16_t> setTouched;
+
+
+        /** Flag to indicate the index was written since it was last synced. **/
+        bool fIndexTouched;
+
+
     public:
 
 
@@ -177,6 +190,16 @@ namespace LLD
         void Flush();
 
 
+        /** Touched
+         *
+         *  Get the hashmap files written since the last call, so they can be synced.
+         *
+         *  @param[out] setFiles The locations of the files written.
+         *
+         **/
+        void Touched(std::set<std::string>& setFiles);
+
+
         /** Restore
          *
          *  Restore an erased key from keychain.
@@ -200,6 +223,37 @@ namespace LLD
          *
          **/
         bool Erase(const std::vector<uint8_t> &vKey);
+
+
+    private:
+
+        /** Fingerprint
+         *
+         *  Calculates the filter bits a compressed key sets in its bucket's filter word.
+         *
+         *  @param[in] vKeyCompressed The compressed key as stored on disk.
+         *
+         *  @return The filter word with this key's bits set.
+         *
+         **/
+        uint32_t fingerprint(const std::vector<uint8_t>& vKeyCompressed) const;
+
+
+        /** Load Filter
+         *
+         *  Loads the bucket filters written on last clean shutdown, or rebuilds them
+         *  by scanning the hashmap files if they are missing.
+         *
+         **/
+        void load_filter();
+
+
+        /** Save Filter
+         *
+         *  Writes the bucket filters to disk so the next startup can skip the rebuild.
+         *
+         **/
+        void save_filter();
     };
 }
 
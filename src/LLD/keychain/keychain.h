@@ -17,6 +17,9 @@ ________________________________________________________________________________
 
 #include <LLD/templates/key.h>
 
+#include <set>
+#include <string>
+
 namespace LLD
 {
 
@@ -67,6 +70,16 @@ namespace LLD
         virtual void Flush() = 0;
 
 
+        /** Touched
+         *
+         *  Get the files written since the last call, so they can be synced.
+         *
+         *  @param[out] setFiles The locations of the files written.
+         *
+         **/
+        virtual void Touched(std::set<std::string>& setFiles) = 0;
+
+
         /** Restore
          *
          *  Restore an erased key from keychain.
@@ -255,6 +255,39 @@ namespace LLD
     }
 
 
+    /* Reads a batch of transactions from the ledger DB, coalescing the disk reads. */
+    bool LedgerDB::ReadTx(const std::vector<uint512_t>& vHashes, std::vector<TAO::Ledger::Transaction> &vTx, const uint8_t nFlags)
+    {
+        /* Memory pool and client lookups go through the single reads. */
+        if(nFlags == TAO::Ledger::FLAGS::MEMPOOL || nFlags == TAO::Ledger::FLAGS::MINER
+        || nFlags == TAO::Ledger::FLAGS::SANITIZE || config::fClient.load())
+        {
+            vTx.clear();
+            vTx.resize(vHashes.size());
+
+            /* Read every transaction in turn. */
+            bool fAll = true;
+            for(uint32_t n = 0; n < vHashes.size(); ++n)
+                fAll = ReadTx(vHashes[n], vTx[n], nFlags) && fAll;
+
+            return fAll;
+        }
+
+        /* Read the batch from disk. */
+        std::vector<bool> vFound;
+        const uint32_t nFound = ReadMany(vHashes, vTx, vFound);
+
+        /* Set the internal transaction hashes. */
+        for(uint32_t n = 0; n < vHashes.size(); ++n)
+        {
+            if(vFound[n])
+                vTx[n].hashCache = vHashes[n];
+        }
+
+        return nFound == vHashes.size();
+    }
+
+
     /* Reads a transaction from the ledger DB. */
     bool LedgerDB::ReadTx(const uint512_t& hashTx, TAO::API::Transaction &tx, const uint8_t nFlags)
     {
@@ -1210,8 +1243,8 @@ namespace LLD
     }
 
 
-    /* Reads a block state object from disk for an atomic object. */
-    bool LedgerDB::ReadBlock(const uint1024_t& hashBlock, memory::atomic<TAO::Ledger::BlockState> &atomicState)
+    /* Reads a block state object from disk and publishes it to a snapshot. */
+    bool LedgerDB::ReadBlock(const uint1024_t& hashBlock, memory::snapshot<TAO::Ledger::BlockState> &atomicState)
     {
         /* Check for client mode. */
         if(config::fClient.load())
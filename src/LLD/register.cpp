@@ -33,6 +33,7 @@ namespace LLD
     , nCacheIn)
 
     , MEMORY    ( )
+    , TYPES     ( )
     , pMemory   (nullptr)
     , pMiner    (nullptr)
     , pSanitize (nullptr)
@@ -171,6 +172,10 @@ namespace LLD
         /* Trigger that a register state was written to disk here. */
         TAO::API::nRegisterCounter++;
 
+        /* Keep our type index current with the owner being written, a failure only costs a rebuild of the index. */
+        if(!index_type(hashRegister, state))
+            stale_types(hashRegister);
+
         /* Check for register address index. */
         if(config::fIndexAddress.load())
         {
@@ -271,6 +276,56 @@ namespace LLD
     }
 
 
+    /* Read a batch of state registers from the register database, coalescing the disk reads. */
+    bool RegisterDB::ReadState(const std::vector<uint256_t>& vRegisters, std::vector<TAO::Register::State>& vStates, const uint8_t nFlags)
+    {
+        vStates.clear();
+        vStates.resize(vRegisters.size());
+
+        /* Track which registers were found. */
+        std::vector<bool> vFound(vRegisters.size(), false);
+
+        /* Memory states take precedence over disk for these flags, so only batch on-disk reads. */
+        if(nFlags != TAO::Ledger::FLAGS::MEMPOOL && nFlags != TAO::Ledger::FLAGS::LOOKUP &&
+           nFlags != TAO::Ledger::FLAGS::FORCED  && nFlags != TAO::Ledger::FLAGS::MINER  &&
+           nFlags != TAO::Ledger::FLAGS::SANITIZE)
+        {
+            /* Build our keys. */
+            std::vector<std::pair<std::string, uint256_t>> vKeys;
+            vKeys.reserve(vRegisters.size());
+
+            for(const auto& hashRegister : vRegisters)
+                vKeys.push_back(std::make_pair(std::string("state"), hashRegister));
+
+            /* Special case for indexed addresses. */
+            if(config::fIndexAddress.load())
+            {
+                /* Records are stored with their address when indexed. */
+                std::vector<std::pair<uint256_t, TAO::Register::State>> vPairs;
+                ReadMany(vKeys, vPairs, vFound);
+
+                for(uint32_t n = 0; n < vPairs.size(); ++n)
+                {
+                    if(vFound[n])
+                        vStates[n] = std::move(vPairs[n].second);
+                }
+            }
+            else
+                ReadMany(vKeys, vStates, vFound);
+        }
+
+        /* Fall back to single reads for anything not found in the batch. */
+        bool fAll = true;
+        for(uint32_t n = 0; n < vRegisters.size(); ++n)
+        {
+            if(!vFound[n])
+                fAll = ReadState(vRegisters[n], vStates[n], nFlags) && fAll;
+        }
+
+        return fAll;
+    }
+
+
     /* Erase a state register from the register database. */
     bool RegisterDB::EraseState(const uint256_t& hashRegister, const uint8_t nFlags)
     {
@@ -315,6 +370,10 @@ namespace LLD
                 return true;
         }
 
+        /* Remove the register from our type index, a failure only costs a rebuild of the index. */
+        if(!erase_type(hashRegister))
+            stale_types(hashRegister);
+
         /* Special case for indexed addresses. */
         if(config::fIndexAddress.load())
             return Erase(std::make_pair(std::string("state"), hashRegister));
@@ -635,6 +694,169 @@ namespace LLD
     }
 
 
+    /* Build the type index for registers written before it was maintained. */
+    void RegisterDB::IndexTypes()
+    {
+        /* Not allowed in -client mode. */
+        if(config::fClient.load())
+            return;
+
+        /* Check if our index has already been built. */
+        if(HasTypes())
+            return;
+
+        /* Start a timer to track. */
+        runtime::timer timer;
+        timer.Start();
+
+        /* Get our starting hash. */
+        uint1024_t hashBegin = TAO::Ledger::hashTritium;
+
+        /* Check for hybrid mode. */
+        if(config::fHybrid.load())
+            LLD::Ledger->ReadHybridGenesis(hashBegin);
+
+        /* Read the first tritium block. */
+        TAO::Ledger::BlockState state;
+        if(!LLD::Ledger->ReadBlock(hashBegin, state))
+        {
+            Write(std::string("types.indexed"));
+
+            debug::warning(FUNCTION, "No tritium blocks available ", hashBegin.SubString());
+            return;
+        }
+
+        /* Keep track of our total count. */
+        uint32_t nScannedCount = 0;
+
+        /* Keep track of already processed addresses. */
+        std::set<uint256_t> setScanned;
+
+        /* Start our scan. */
+        debug::notice(FUNCTION, "Building type indexes from block ", state.GetHash().SubString());
+        while(!config::fShutdown.load())
+        {
+            /* Loop through found transactions. */
+            for(uint32_t nIndex = 0; nIndex < state.vtx.size(); ++nIndex)
+            {
+                /* We only care about tritium transactions. */
+                if(state.vtx[nIndex].first != TAO::Ledger::TRANSACTION::TRITIUM)
+                    continue;
+
+                /* Read the transaction from disk. */
+                TAO::Ledger::Transaction tx;
+                if(!LLD::Ledger->ReadTx(state.vtx[nIndex].second, tx))
+                    continue;
+
+                /* Iterate the transaction contracts. */
+                for(uint32_t nContract = 0; nContract < tx.Size(); ++nContract)
+                {
+                    /* Unpack the address we will be working on. */
+                    uint256_t hashAddress;
+                    if(!TAO::Register::Unpack(tx[nContract], hashAddress))
+                        continue;
+
+                    /* Check if already in set. */
+                    if(setScanned.count(hashAddress))
+                        continue;
+
+                    /* Index the register by its current owner if it is still on disk. */
+                    TAO::Register::State rState;
+                    if(ReadState(hashAddress, rState) && !index_type(hashAddress, rState))
+                        continue;
+
+                    /* Add to completed set. */
+                    setScanned.insert(hashAddress);
+                }
+
+                /* Update the scanned count for meters. */
+                ++nScannedCount;
+
+                /* Meter for output. */
+                if(nScannedCount % 100000 == 0)
+                {
+                    /* Get the time it took to rescan. */
+                    uint32_t nElapsedSeconds = timer.Elapsed();
+                    debug::log(0, FUNCTION, "Built ", nScannedCount, " type indexes in ", nElapsedSeconds, " seconds (",
+                        std::fixed, (double)(nScannedCount / (nElapsedSeconds > 0 ? nElapsedSeconds : 1 )), " tx/s)");
+                }
+            }
+
+            /* Iterate to the next block in the queue. */
+            state = state.Next();
+            if(!state)
+            {
+                /* Write our last index now. */
+                Write(std::string("types.indexed"));
+
+                debug::notice(FUNCTION, "Completed scanning ", nScannedCount, " tx with ", setScanned.size(), " registers in ", timer.Elapsed(), " seconds");
+
+                break;
+            }
+        }
+    }
+
+
+    /* Check that the type index has been built, so it holds every register on disk. */
+    bool RegisterDB::HasTypes()
+    {
+        return Exists(std::string("types.indexed"));
+    }
+
+
+    /* List the addresses of registers of a standard from the type index, reading a page from a cursor. */
+    bool RegisterDB::ListTypes(const std::string& strType, const uint256_t& hashOwner, std::vector<uint256_t> &vRegisters,
+                               uint32_t &nCursor, const uint32_t nLimit)
+    {
+        vRegisters.clear();
+
+        /* Owners have their own lists, zero lists every owner. */
+        const std::string strList = (hashOwner == 0) ? "types.all" : "types.owner";
+
+        /* Get the number of registers in our list. */
+        uint32_t nCount = 0;
+        if(!Read(std::make_tuple(strList + ".count", strType, hashOwner), nCount) || nCursor >= nCount)
+            return false;
+
+        /* Build the keys of our page. */
+        std::vector<std::tuple<std::string, std::string, uint256_t, uint32_t>> vKeys;
+        for(uint32_t nSequence = nCursor; nSequence < nCount && vKeys.size() < nLimit; ++nSequence)
+            vKeys.push_back(std::make_tuple(strList, strType, hashOwner, nSequence));
+
+        /* Read our page together, coalescing the disk reads. */
+        std::vector<bool> vFound;
+        ReadMany(vKeys, vRegisters, vFound);
+
+        /* Drop any entries that were missing. */
+        uint32_t nFound = 0;
+        for(uint32_t n = 0; n < vRegisters.size(); ++n)
+        {
+            if(vFound[n])
+                vRegisters[nFound++] = vRegisters[n];
+        }
+        vRegisters.resize(nFound);
+
+        /* Move our cursor past our page, which may be empty if every entry of it was missing. */
+        nCursor += vKeys.size();
+
+        return true;
+    }
+
+
+    /* Count the registers of a standard in the type index. */
+    uint32_t RegisterDB::CountTypes(const std::string& strType, const uint256_t& hashOwner)
+    {
+        /* Owners have their own lists, zero counts every owner. */
+        const std::string strList = (hashOwner == 0) ? "types.all" : "types.owner";
+
+        /* Read our count, which is zero if nothing has been indexed. */
+        uint32_t nCount = 0;
+        Read(std::make_tuple(strList + ".count", strType, hashOwner), nCount);
+
+        return nCount;
+    }
+
+
     /* Begin a memory transaction following ACID properties. */
     void RegisterDB::MemoryBegin(const uint8_t nFlags)
     {
@@ -853,4 +1075,124 @@ namespace LLD
 
         return "NONE";
     }
+
+
+    /* Add a register to the type index, or move it to the list of its new owner. */
+    bool RegisterDB::index_type(const uint256_t& hashRegister, const TAO::Register::State& state)
+    {
+        LOCK(TYPES);
+
+        /* Get the standard of our register. */
+        const std::string strType = get_address_type(hashRegister);
+
+        /* Check the owner we have the register indexed by. */
+        std::pair<uint256_t, uint32_t> pairPosition;
+        if(Read(std::make_pair(std::string("types.owner.position"), hashRegister), pairPosition))
+        {
+            /* Most writes don't change the owner, so there is nothing to do. */
+            if(pairPosition.first == state.hashOwner)
+                return true;
+
+            /* Remove from the list of our previous owner. */
+            if(!pop_type("types.owner", strType, hashRegister))
+                return false;
+        }
+
+        /* New registers are added to the list of every register. */
+        else if(!push_type("types.all", strType, 0, hashRegister))
+            return false;
+
+        return push_type("types.owner", strType, state.hashOwner, hashRegister);
+    }
+
+
+    /* Remove a register from the type index. */
+    bool RegisterDB::erase_type(const uint256_t& hashRegister)
+    {
+        LOCK(TYPES);
+
+        /* Get the standard of our register. */
+        const std::string strType = get_address_type(hashRegister);
+
+        /* Remove from both of our lists. */
+        if(!pop_type("types.all", strType, hashRegister))
+            return false;
+
+        return pop_type("types.owner", strType, hashRegister);
+    }
+
+
+    /* Mark the type index as stale so listing falls back to a scan until it is rebuilt on the next startup. */
+    void RegisterDB::stale_types(const uint256_t& hashRegister)
+    {
+        debug::error(FUNCTION, "type index failed for ", hashRegister.SubString(), ", rebuilding on next startup");
+
+        Erase(std::string("types.indexed"));
+    }
+
+
+    /* Append a register to the end of a list of the type index. */
+    bool RegisterDB::push_type(const std::string& strList, const std::string& strType,
+                               const uint256_t& hashOwner, const uint256_t& hashRegister)
+    {
+        /* Get the number of registers in our list. */
+        uint32_t nCount = 0;
+        Read(std::make_tuple(strList + ".count", strType, hashOwner), nCount);
+
+        /* Write our register at the end of the list. */
+        if(!Write(std::make_tuple(strList, strType, hashOwner, nCount), hashRegister))
+            return false;
+
+        /* Write where our register is so it can be removed. */
+        if(!Write(std::make_pair(strList + ".position", hashRegister), std::make_pair(hashOwner, nCount)))
+            return false;
+
+        return Write(std::make_tuple(strList + ".count", strType, hashOwner), ++nCount);
+    }
+
+
+    /* Remove a register from a list of the type index, moving the last register of the list into its place. */
+    bool RegisterDB::pop_type(const std::string& strList, const std::string& strType, const uint256_t& hashRegister)
+    {
+        /* Check where our register is, registers written before the index was built may not have one. */
+        std::pair<uint256_t, uint32_t> pairPosition;
+        if(!Read(std::make_pair(strList + ".position", hashRegister), pairPosition))
+            return true;
+
+        /* Get a reference of the owner of our list. */
+        const uint256_t& hashOwner = pairPosition.first;
+
+        /* Get the number of registers in our list. */
+        uint32_t nCount = 0;
+        if(!Read(std::make_tuple(strList + ".count", strType, hashOwner), nCount) || nCount == 0)
+            return debug::error(FUNCTION, strList, " has no count for ", hashRegister.SubString());
+
+        /* Move the last register of the list into our place. */
+        const uint32_t nLast = nCount - 1;
+        if(pairPosition.second != nLast)
+        {
+            /* Read the last register. */
+            uint256_t hashLast;
+            if(!Read(std::make_tuple(strList, strType, hashOwner, nLast), hashLast))
+                return debug::error(FUNCTION, strList, " is missing entry ", nLast);
+
+            /* Write it where our register was. */
+            if(!Write(std::make_tuple(strList, strType, hashOwner, pairPosition.second), hashLast))
+                return false;
+
+            /* Update its position. */
+            if(!Write(std::make_pair(strList + ".position", hashLast), pairPosition))
+                return false;
+        }
+
+        /* Remove the end of our list. */
+        if(!Erase(std::make_tuple(strList, strType, hashOwner, nLast)))
+            return false;
+
+        /* Remove our position. */
+        if(!Erase(std::make_pair(strList + ".position", hashRegister)))
+            return false;
+
+        return Write(std::make_tuple(strList + ".count", strType, hashOwner), nLast);
+    }
 }
@@ -15,10 +15,13 @@ ________________________________________________________________________________
 
 #include <LLD/cache/binary_lfu.h>
 #include <LLD/cache/binary_lru.h>
+#include <LLD/cache/sharded_lru.h>
 
 #include <LLD/keychain/filemap.h>
 #include <LLD/keychain/hashmap.h>
 
+#include <LLD/compress/lz4.h>
+
 #include <Util/include/filesystem.h>
 #include <Util/include/hex.h>
 
@@ -28,6 +31,22 @@ ________________________________________________________________________________
 namespace LLD
 {
 
+    /* Create the cache of a database, a single lock cache has no shards to configure. */
+    template<class CacheType>
+    static CacheType* new_cache(const uint32_t nCacheIn, const uint8_t nFlagsIn)
+    {
+        return new CacheType(nCacheIn);
+    }
+
+
+    /* Create a sharded cache, striped over -lldshards locks when the database asks for it. */
+    template<>
+    ShardedLRU* new_cache<ShardedLRU>(const uint32_t nCacheIn, const uint8_t nFlagsIn)
+    {
+        return new ShardedLRU(nCacheIn, (nFlagsIn & FLAGS::SHARDED) ? config::GetArg("-lldshards", 16) : 1);
+    }
+
+
     /* The Database Constructor. To determine file location and the Bytes per Record. */
     template<class KeychainType, class CacheType>
     SectorDatabase<KeychainType, CacheType>::SectorDatabase(const std::string& strNameIn,
@@ -43,10 +62,14 @@ namespace LLD
     , runtime()
     , pTransaction(nullptr)
     , pSectorKeys(new KeychainType((config::GetDataDir() + strName + "/keychain/"), nFlagsIn, nBucketsIn))
-    , cachePool(new CacheType(nCacheIn))
+    , cachePool(new_cache<CacheType>(nCacheIn, nFlagsIn))
     , fileCache(new TemplateLRU<uint32_t, std::fstream*>(8))
+    , readPool(new FilePool(strBaseLocation, config::GetBoolArg("-lldmmap", false)))
+    , pJournal(Journal::Open(config::GetDataDir() + "journal.dat"))
+    , nCheckpoint(0)
     , nCurrentFile(0)
     , nCurrentFileSize(0)
+    , setTouched()
     , CacheWriterThread()
     , MeterThread()
     , vDiskBuffer()
@@ -54,6 +77,8 @@ namespace LLD
     , nBytesRead(0)
     , nBytesWrote(0)
     , nRecordsFlushed(0)
+    , nBytesUncompressed(0)
+    , nBytesCompressed(0)
     , fDestruct(false)
     , fInitialized(false)
     , nFlags(nFlagsIn)
@@ -98,6 +123,12 @@ namespace LLD
         if(fileCache)
             delete fileCache;
 
+        if(readPool)
+            delete readPool;
+
+        if(pJournal)
+            Journal::Close(pJournal);
+
         if(pSectorKeys)
             delete pSectorKeys;
     }
@@ -165,30 +196,21 @@ namespace LLD
             {
                 SHARED_LOCK(SECTOR_MUTEX);
 
-                /* Use a private read-only stream so that multiple readers can
-                 * proceed concurrently under the shared_lock without racing on
-                 * the shared fileCache's fstream seek/read state. */
-                std::ifstream stream(
-                    debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), cKey.nSectorFile),
-                    std::ios::in | std::ios::binary);
-
-                if(!stream.is_open())
-                    return debug::error(FUNCTION, "couldn't open stream file for read");
-
                 /* Get compact size from record. */
-                uint64_t nSize = GetSizeOfCompactSize(cKey.nSectorSize);
-
-                /* Seek to the Sector Position on Disk. */
-                stream.seekg(cKey.nSectorStart + nSize, std::ios::beg);
+                const uint64_t nSize = GetSizeOfCompactSize(cKey.nSectorSize);
 
                 /* Resize for proper record length. */
                 vData.resize(cKey.nSectorSize - nSize);
 
-                /* Read the State and Size of Sector Header. */
-                if(!stream.read((char*) &vData[0], vData.size()))
-                    return debug::error(FUNCTION, "only ", stream.gcount(), "/", vData.size(), " bytes read");
+                /* Positional read from the shared descriptor, or the mapping if the file is sealed. */
+                if(!readPool->Read(cKey.nSectorFile, cKey.nSectorStart + nSize, vData, cKey.nSectorFile < nCurrentFile))
+                    return debug::error(FUNCTION, "failed to read sector from file ", cKey.nSectorFile);
             }
 
+            /* Expand the record if it was written compressed. */
+            if(!Decompress(vData))
+                return debug::error(FUNCTION, "failed to decompress sector from file ", cKey.nSectorFile);
+
             /* Add to cache */
             cachePool->Put(cKey, vKey, vData);
 
@@ -218,28 +240,19 @@ namespace LLD
             if(cachePool->Get(cKey.vKey, vData))
                 return true;
 
-            /* Use a private read-only stream so that multiple readers can
-             * proceed concurrently under the shared_lock without racing on
-             * the shared fileCache's fstream seek/read state. */
-            std::ifstream stream(
-                debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), cKey.nSectorFile),
-                std::ios::in | std::ios::binary);
-
-            if(!stream.is_open())
-                return false;
-
             /* Get compact size from record. */
-            uint64_t nSize = GetSizeOfCompactSize(cKey.nSectorSize);
-
-            /* Seek to the Sector Position on Disk. */
-            stream.seekg(cKey.nSectorStart + nSize, std::ios::beg);
+            const uint64_t nSize = GetSizeOfCompactSize(cKey.nSectorSize);
 
             /* Resize for proper record length. */
             vData.resize(cKey.nSectorSize - nSize);
 
-            /* Read the State and Size of Sector Header. */
-            if(!stream.read((char*) &vData[0], vData.size()))
-                return debug::error(FUNCTION, "only ", stream.gcount(), "/", vData.size(), " bytes read");
+            /* Positional read from the shared descriptor, or the mapping if the file is sealed. */
+            if(!readPool->Read(cKey.nSectorFile, cKey.nSectorStart + nSize, vData, cKey.nSectorFile < nCurrentFile))
+                return false;
+
+            /* Expand the record if it was written compressed. */
+            if(!Decompress(vData))
+                return debug::error(FUNCTION, "failed to decompress sector from file ", cKey.nSectorFile);
 
             /* Verbose output. */
             if(config::nVerbose >= 5)
@@ -251,6 +264,121 @@ namespace LLD
     }
 
 
+    /*  Get a batch of records from cache or from disk, coalescing adjacent disk reads. */
+    template<class KeychainType, class CacheType>
+    uint32_t SectorDatabase<KeychainType, CacheType>::GetMany(const std::vector<std::vector<uint8_t>>& vKeys,
+        const std::vector<bool>& vSkip, std::vector<std::vector<uint8_t>>& vData)
+    {
+        /* Resolve all of our sector keys first, keeping the batch index of each. */
+        std::vector<std::pair<SectorKey, uint32_t>> vSectors;
+        vSectors.reserve(vKeys.size());
+
+        uint32_t nTotal = 0;
+        for(uint32_t n = 0; n < vKeys.size(); ++n)
+        {
+            /* Skip over keys that were resolved by the caller. */
+            if(vSkip[n])
+                continue;
+
+            /* Iterate if meters are enabled. */
+            nBytesRead += static_cast<uint32_t>(vKeys[n].size());
+
+            /* Check the cache pool for key first. */
+            if(cachePool->Get(vKeys[n], vData[n]))
+            {
+                ++nTotal;
+                continue;
+            }
+
+            /* Get the key from the keychain. */
+            SectorKey cKey;
+            if(pSectorKeys->Get(vKeys[n], cKey))
+                vSectors.push_back(std::make_pair(cKey, n));
+        }
+
+        /* Sort our reads by their position on disk. */
+        std::sort(vSectors.begin(), vSectors.end(),
+            [](const std::pair<SectorKey, uint32_t>& a, const std::pair<SectorKey, uint32_t>& b)
+            {
+                if(a.first.nSectorFile != b.first.nSectorFile)
+                    return a.first.nSectorFile < b.first.nSectorFile;
+
+                return a.first.nSectorStart < b.first.nSectorStart;
+            });
+
+        /* Read our records, merging records that sit close together into one read. */
+        std::vector<uint8_t> vBuffer;
+        for(uint32_t nBegin = 0; nBegin < vSectors.size(); )
+        {
+            /* Get the range of the first record. */
+            const SectorKey& cFirst = vSectors[nBegin].first;
+            const uint64_t nStart   = cFirst.nSectorStart;
+            uint64_t nEnd           = nStart + cFirst.nSectorSize;
+
+            /* Extend the range while the next record is in the same file and close enough. */
+            uint32_t nNext = nBegin + 1;
+            for( ; nNext < vSectors.size(); ++nNext)
+            {
+                const SectorKey& cKey = vSectors[nNext].first;
+                if(cKey.nSectorFile != cFirst.nSectorFile
+                || cKey.nSectorStart > nEnd + MAX_SECTOR_COALESCE_GAP
+                || cKey.nSectorStart + cKey.nSectorSize - nStart > MAX_SECTOR_COALESCE_SIZE)
+                    break;
+
+                nEnd = std::max<uint64_t>(nEnd, cKey.nSectorStart + cKey.nSectorSize);
+            }
+
+            /* Read the whole range at once. */
+            {
+                SHARED_LOCK(SECTOR_MUTEX);
+
+                vBuffer.resize(nEnd - nStart);
+                if(!readPool->Read(cFirst.nSectorFile, nStart, vBuffer, cFirst.nSectorFile < nCurrentFile))
+                {
+                    debug::error(FUNCTION, "failed to read sector from file ", cFirst.nSectorFile);
+
+                    nBegin = nNext;
+                    continue;
+                }
+            }
+
+            /* Slice our records out of the range. */
+            for(uint32_t n = nBegin; n < nNext; ++n)
+            {
+                const SectorKey& cKey = vSectors[n].first;
+                const uint32_t nIndex = vSectors[n].second;
+
+                /* Get compact size from record. */
+                const uint64_t nSize   = GetSizeOfCompactSize(cKey.nSectorSize);
+                const uint64_t nOffset = cKey.nSectorStart - nStart + nSize;
+
+                /* Copy the record from our buffer. */
+                vData[nIndex].assign(vBuffer.begin() + nOffset, vBuffer.begin() + nOffset + (cKey.nSectorSize - nSize));
+
+                /* Expand the record if it was written compressed. */
+                if(!Decompress(vData[nIndex]))
+                {
+                    debug::error(FUNCTION, "failed to decompress sector from file ", cKey.nSectorFile);
+                    vData[nIndex].clear();
+
+                    continue;
+                }
+
+                /* Add to cache */
+                cachePool->Put(cKey, vKeys[nIndex], vData[nIndex]);
+
+                /* Iterate if meters are enabled. */
+                nBytesRead += static_cast<uint32_t>(vData[nIndex].size());
+                ++nTotal;
+            }
+
+            nBegin = nNext;
+        }
+
+        return nTotal;
+    }
+
+
     /*  Update a record on disk. */
     template<class KeychainType, class CacheType>
     bool SectorDatabase<KeychainType, CacheType>::Update(const std::vector<uint8_t>& vKey, const std::vector<uint8_t>& vData)
@@ -260,8 +388,15 @@ namespace LLD
         if(!pSectorKeys->Get(vKey, key))
             return false;
 
+        /* Compress the record for disk if enabled. */
+        std::vector<uint8_t> vCompressed;
+        const bool fCompressed = (nFlags & FLAGS::COMPRESS) && Compress(vData, vCompressed);
+
+        /* Get the bytes that go to disk. */
+        const std::vector<uint8_t>& vDisk = (fCompressed ? vCompressed : vData);
+
         /* Get current size */
-        uint64_t nSize = vData.size() + GetSizeOfCompactSize(vData.size());
+        uint64_t nSize = vDisk.size() + GetSizeOfCompactSize(vDisk.size());
 
         /* Check data size constraints. */
         if(nSize != key.nSectorSize)
@@ -297,17 +432,25 @@ namespace LLD
             pstream->seekp(key.nSectorStart, std::ios::beg);
 
             /* Write the size of record. */
-            WriteCompactSize(*pstream, vData.size());
+            WriteCompactSize(*pstream, vDisk.size());
 
             /* Write the data record. */
-            if(!pstream->write((char*) &vData[0], vData.size()))
-                return debug::error(FUNCTION, "only ", pstream->gcount(), "/", vData.size(), " bytes written");
+            if(!pstream->write((char*) &vDisk[0], vDisk.size()))
+                return debug::error(FUNCTION, "only ", pstream->gcount(), "/", vDisk.size(), " bytes written");
 
             pstream->flush();
+            setTouched.insert(key.nSectorFile);
 
             /* Records flushed indicator. */
             ++nRecordsFlushed;
-            nBytesWrote += static_cast<uint32_t>(vData.size());
+            nBytesWrote += static_cast<uint32_t>(vDisk.size());
+
+            /* Track our compression for the meter. */
+            if(nFlags & FLAGS::COMPRESS)
+            {
+                nBytesUncompressed += vData.size();
+                nBytesCompressed   += vDisk.size();
+            }
 
             /* Verbose output. */
             if(config::nVerbose >= 5)
@@ -325,6 +468,13 @@ namespace LLD
     {
         if(nFlags & FLAGS::APPEND || !Update(vKey, vData))
         {
+            /* Compress the record for disk if enabled. */
+            std::vector<uint8_t> vCompressed;
+            const bool fCompressed = (nFlags & FLAGS::COMPRESS) && Compress(vData, vCompressed);
+
+            /* Get the bytes that go to disk. */
+            const std::vector<uint8_t>& vDisk = (fCompressed ? vCompressed : vData);
+
             /* Sector key built inside the lock so that nCurrentFile and
              * nCurrentFileSize are read and updated atomically. */
             SectorKey key;
@@ -372,17 +522,18 @@ namespace LLD
                 pstream->seekp(nCurrentFileSize, std::ios::beg);
 
                 /* Write the size of record. */
-                WriteCompactSize(*pstream, vData.size());
+                WriteCompactSize(*pstream, vDisk.size());
 
                 /* Write the data record. */
-                if(!pstream->write((char*) &vData[0], vData.size()))
-                    return debug::error(FUNCTION, "only ", pstream->gcount(), "/", vData.size(), " bytes written");
+                if(!pstream->write((char*) &vDisk[0], vDisk.size()))
+                    return debug::error(FUNCTION, "only ", pstream->gcount(), "/", vDisk.size(), " bytes written");
 
                 pstream->flush();
+                setTouched.insert(nCurrentFile);
 
                 /* Get current size */
                 const uint64_t nSize =
-                    (vData.size() + GetSizeOfCompactSize(vData.size()));
+                    (vDisk.size() + GetSizeOfCompactSize(vDisk.size()));
 
                 /* Create the Sector Key while still holding the lock so that
                  * nCurrentFile and nCurrentFileSize are consistent. */
@@ -395,6 +546,13 @@ namespace LLD
                 /* Records flushed indicator. */
                 ++nRecordsFlushed;
                 nBytesWrote += static_cast<uint32_t>(nSize);
+
+                /* Track our compression for the meter. */
+                if(nFlags & FLAGS::COMPRESS)
+                {
+                    nBytesUncompressed += vData.size();
+                    nBytesCompressed   += vDisk.size();
+                }
             }
 
             /* Assign the Key to Keychain (has its own internal synchronization). */
@@ -509,6 +667,72 @@ namespace LLD
     }
 
 
+    /*  Compress a record for disk with LZ4 if it would save space. */
+    template<class KeychainType, class CacheType>
+    bool SectorDatabase<KeychainType, CacheType>::Compress(const std::vector<uint8_t>& vData, std::vector<uint8_t>& vCompressed) const
+    {
+        /* Small records don't gain anything over the header. */
+        if(vData.size() < 64)
+            return false;
+
+        /* Allocate our worst case with room for the marker and the uncompressed size. */
+        const int32_t nBound = LZ4_compressBound(static_cast<int32_t>(vData.size()));
+        vCompressed.resize(5 + nBound);
+
+        /* Write our header. */
+        const uint32_t nSize = static_cast<uint32_t>(vData.size());
+        vCompressed[0] = SECTOR_RECORD_COMPRESSED;
+        std::copy((uint8_t*)&nSize, (uint8_t*)&nSize + 4, vCompressed.begin() + 1);
+
+        /* Compress the record after the header. */
+        const int32_t nCompressed =
+            LZ4_compress_default((const char*)&vData[0], (char*)&vCompressed[5], static_cast<int32_t>(vData.size()), nBound);
+
+        /* Only keep compressed records that are smaller on disk. */
+        if(nCompressed <= 0 || uint64_t(nCompressed + 5) >= vData.size())
+            return false;
+
+        vCompressed.resize(5 + nCompressed);
+
+        return true;
+    }
+
+
+    /*  Decompress a record read from disk in place, leaving uncompressed records untouched. */
+    template<class KeychainType, class CacheType>
+    bool SectorDatabase<KeychainType, CacheType>::Decompress(std::vector<uint8_t>& vData) const
+    {
+        /* Check for our compressed marker. */
+        if(vData.empty() || vData[0] != SECTOR_RECORD_COMPRESSED)
+            return true;
+
+        /* Check for a complete header. */
+        if(vData.size() < 5)
+            return false;
+
+        /* Read the uncompressed size from the header. */
+        uint32_t nSize = 0;
+        std::copy(vData.begin() + 1, vData.begin() + 5, (uint8_t*)&nSize);
+
+        /* Sanity check so that corrupted headers can't exhaust memory. */
+        if(nSize > MAX_SECTOR_FILE_SIZE)
+            return false;
+
+        /* Expand the record. */
+        std::vector<uint8_t> vExpanded(nSize, 0);
+        const int32_t nExpanded =
+            LZ4_decompress_safe((const char*)&vData[5], (char*)&vExpanded[0], static_cast<int32_t>(vData.size() - 5), nSize);
+
+        /* Check that we got the full record back. */
+        if(nExpanded < 0 || static_cast<uint32_t>(nExpanded) != nSize)
+            return false;
+
+        vData.swap(vExpanded);
+
+        return true;
+    }
+
+
     /*  Flushes periodically data from the cache buffer to disk. */
     template<class KeychainType, class CacheType>
     void SectorDatabase<KeychainType, CacheType>::CacheWriter()
@@ -621,6 +845,15 @@ namespace LLD
                 "Reading ", RPS, " Kb/s | ",
                 "Records ", nRecordsFlushed.load());
 
+            /* Compression output, totals are kept since startup. */
+            if(nFlags & FLAGS::COMPRESS && nBytesUncompressed.load() > 0)
+            {
+                debug::log(0,
+                    ANSI_COLOR_FUNCTION, strName, " LLD : ", ANSI_COLOR_RESET,
+                    "Compression Ratio ", double(nBytesCompressed.load()) / nBytesUncompressed.load(), " | ",
+                    "Saved ", (nBytesUncompressed.load() - nBytesCompressed.load()) / 1024.0, " Kb");
+            }
+
             TIMER.Reset();
             nBytesWrote.store(0);
             nBytesRead.store(0);
@@ -657,15 +890,10 @@ namespace LLD
         /* Set commit message into journal. */
         pTransaction->ssJournal << std::string("commit");
 
-        /* Create an append only stream. */
-        std::ofstream stream = std::ofstream(debug::safe_printstr(config::GetDataDir(), strName, "/journal.dat"), std::ios::app | std::ios::binary);
-        if(!stream.is_open())
-            return debug::error(FUNCTION, "failed to open journal file");
-
-        /* Write to the file.  */
-        const std::vector<uint8_t>& vBytes = pTransaction->ssJournal.Bytes();
-        stream.write((char*)&vBytes[0], vBytes.size());
-        stream.close();
+        /* Append to the shared journal, the sync is deferred to commit so that it can be grouped. */
+        nCheckpoint = pJournal->Append(strName, pTransaction->ssJournal.Bytes());
+        if(nCheckpoint == 0)
+            return debug::error(FUNCTION, "failed to write journal checkpoint");
 
         return true;
     }
@@ -684,9 +912,21 @@ namespace LLD
         /** Set the transaction pointer to null also acting like a flag **/
         pTransaction = nullptr;
 
-        /* Delete the transaction journal file. */
-        std::ofstream stream(debug::safe_printstr(config::GetDataDir(), strName, "/journal.dat"), std::ios::trunc);
-        stream.close();
+        /* Gather the files we wrote, the journal syncs them before it drops our checkpoint. */
+        std::set<std::string> setFiles;
+        pSectorKeys->Touched(setFiles);
+        {
+            WRITE_LOCK(SECTOR_MUTEX);
+
+            for(const auto& nFile : setTouched)
+                setFiles.insert(debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nFile));
+
+            setTouched.clear();
+        }
+
+        /* Release our checkpoint from the journal. */
+        pJournal->Release(strName, setFiles);
+        nCheckpoint = 0;
     }
 
 
@@ -700,6 +940,10 @@ namespace LLD
         if(!pTransaction)
             return false;
 
+        /* Make sure our checkpoint is durable before touching the datachain. */
+        if(nCheckpoint != 0 && !pJournal->Sync(nCheckpoint))
+            return debug::error(FUNCTION, "failed to sync journal checkpoint");
+
         /* Erase data set to be removed. */
         for(const auto& item : pTransaction->setErasedData)
             if(!pSectorKeys->Erase(item))
@@ -753,30 +997,49 @@ namespace LLD
     template<class KeychainType, class CacheType>
     bool SectorDatabase<KeychainType, CacheType>::TxnRecovery()
     {
-        /* Create an append only stream. */
-        std::ifstream stream(debug::safe_printstr(config::GetDataDir(), strName, "/journal.dat"), std::ios::in | std::ios::out | std::ios::binary);
-        if(!stream.is_open())
-            return false;
+        /* Get our checkpoint from the shared journal. */
+        std::vector<uint8_t> vBuffer;
+        if(!pJournal->Recover(strName, vBuffer))
+        {
+            /* Check for a journal file of the previous per-database format. */
+            const std::string strLegacy = debug::safe_printstr(config::GetDataDir(), strName, "/journal.dat");
 
-        /* Get the Binary Size. */
-        stream.ignore(std::numeric_limits<std::streamsize>::max());
+            std::ifstream stream(strLegacy, std::ios::in | std::ios::binary);
+            if(!stream.is_open())
+                return false;
 
-        /* Get the data buffer. */
-        const uint32_t nSize = static_cast<uint32_t>(stream.gcount());
+            /* Get the Binary Size. */
+            stream.ignore(std::numeric_limits<std::streamsize>::max());
 
-        /* Check journal size for 0. */
-        if(nSize == 0)
-            return false;
+            /* Get the data buffer. */
+            const uint32_t nSize = static_cast<uint32_t>(stream.gcount());
 
-        /* Create buffer to read into. */
-        std::vector<uint8_t> vBuffer(nSize, 0);
+            /* Read the journal file. */
+            vBuffer.resize(nSize);
+            if(nSize > 0)
+            {
+                stream.clear();
+                stream.seekg (0, std::ios::beg);
+                stream.read((char*) &vBuffer[0], vBuffer.size());
+            }
+            stream.close();
+
+            /* Move the checkpoint into the shared journal before removing the old file. */
+            if(nSize > 0)
+            {
+                nCheckpoint = pJournal->Append(strName, vBuffer);
+                if(nCheckpoint == 0 || !pJournal->Sync(nCheckpoint))
+                    return debug::error(FUNCTION, strName, " failed to migrate transaction journal");
+            }
+
+            filesystem::remove(strLegacy);
 
-        /* Read the journal file. */
-        stream.seekg (0, std::ios::beg);
-        stream.read((char*) &vBuffer[0], vBuffer.size());
-        stream.close();
+            /* Check journal size for 0. */
+            if(nSize == 0)
+                return false;
+        }
 
-        debug::log(0, FUNCTION, strName, " transaction journal detected of ", nSize, " bytes");
+        debug::log(0, FUNCTION, strName, " transaction journal detected of ", vBuffer.size(), " bytes");
 
         /* Create the transaction object. */
         TxnBegin();
@@ -860,5 +1123,6 @@ namespace LLD
 
     /* Explicity instantiate all template instances needed for compiler. */
     template class SectorDatabase<BinaryHashMap,  BinaryLRU>;
+    template class SectorDatabase<BinaryHashMap,  ShardedLRU>;
 
 }
@@ -0,0 +1,96 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+____________________________________________________________________________________________*/
+
+#include <LLD/cache/sharded_lru.h>
+#include <LLD/templates/key.h>
+#include <LLD/hash/xxh3.h>
+
+namespace LLD
+{
+
+    /** Cache Size Constructor **/
+    ShardedLRU::ShardedLRU(const uint32_t nCacheSizeIn, const uint32_t nShardsIn)
+    : vShards ( )
+    {
+        /* Always keep at least one shard. */
+        const uint32_t nShards = (nShardsIn == 0 ? 1 : nShardsIn);
+
+        /* Give every shard an equal slice of the memory budget. */
+        vShards.reserve(nShards);
+        for(uint32_t n = 0; n < nShards; ++n)
+            vShards.push_back(new BinaryLRU(nCacheSizeIn / nShards));
+    }
+
+
+    /** Class Destructor. **/
+    ShardedLRU::~ShardedLRU()
+    {
+        for(auto& pShard : vShards)
+            delete pShard;
+    }
+
+
+    /*  Check if data exists. */
+    bool ShardedLRU::Has(const std::vector<uint8_t>& vKey) const
+    {
+        return shard(vKey)->Has(vKey);
+    }
+
+
+    /*  Get the data by index */
+    bool ShardedLRU::Get(const std::vector<uint8_t>& vKey, std::vector<uint8_t>& vData)
+    {
+        return shard(vKey)->Get(vKey, vData);
+    }
+
+
+    /*  Add data in the Pool. */
+    void ShardedLRU::Put(const SectorKey& key, const std::vector<uint8_t>& vKey, const std::vector<uint8_t>& vData, bool fReserve)
+    {
+        shard(vKey)->Put(key, vKey, vData, fReserve);
+    }
+
+
+    /*  Reserve this item in the cache permanently if true, unreserve if false. */
+    void ShardedLRU::Reserve(const std::vector<uint8_t>& vKey, bool fReserve)
+    {
+        shard(vKey)->Reserve(vKey, fReserve);
+    }
+
+
+    /*  Force Remove Object by Index. */
+    bool ShardedLRU::Remove(const std::vector<uint8_t>& vKey)
+    {
+        return shard(vKey)->Remove(vKey);
+    }
+
+
+    /*  Get the total shards this cache is striped over. */
+    uint32_t ShardedLRU::Shards() const
+    {
+        return static_cast<uint32_t>(vShards.size());
+    }
+
+
+    /*  Find the shard responsible for a given key. */
+    BinaryLRU* ShardedLRU::shard(const std::vector<uint8_t>& vKey) const
+    {
+        /* Skip hashing when not striped. */
+        if(vShards.size() == 1)
+            return vShards[0];
+
+        /* Use the upper bits, the shard's own buckets are selected by the lower bits of this same hash. */
+        const uint64_t nHash = XXH64(&vKey[0], vKey.size(), 0);
+
+        return vShards[(nHash >> 32) % vShards.size()];
+    }
+}
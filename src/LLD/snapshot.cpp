@@ -0,0 +1,597 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLD/include/snapshot.h>
+#include <LLD/include/version.h>
+
+#include <LLC/hash/SK/skein.h>
+#include <LLC/hash/SK/KeccakHash.h>
+
+#include <Util/include/config.h>
+#include <Util/include/debug.h>
+#include <Util/include/filesystem.h>
+#include <Util/include/mutex.h>
+#include <Util/include/runtime.h>
+#include <Util/templates/datastream.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace LLD
+{
+
+    /* The consensus databases that go into a snapshot, relative to the data directory. */
+    const std::vector<std::string> SNAPSHOT_DATABASES = { "_CONTRACT", "_REGISTER", "_LEDGER", "_TRUST", "_LEGACY" };
+
+
+    /* The largest manifest we will read from a snapshot file. */
+    const uint32_t MAX_SNAPSHOT_MANIFEST_SIZE = 1024 * 1024 * 64; //64 MB Max Manifest
+
+
+    namespace
+    {
+        /* SK256 of a chunk, hashed directly as the LLC caches are meant for small values. */
+        uint256_t checksum(const uint8_t* pData, const uint64_t nSize)
+        {
+            uint256_t hashSkein = 0;
+            Skein_256_Ctxt_t ctxSkein;
+            Skein_256_Init  (&ctxSkein, 256);
+            Skein_256_Update(&ctxSkein, pData, nSize);
+            Skein_256_Final (&ctxSkein, hashSkein.begin());
+
+            uint256_t hashKeccak = 0;
+            Keccak_HashInstance ctxKeccak;
+            Keccak_HashInitialize_SHA3_256(&ctxKeccak);
+            Keccak_HashUpdate(&ctxKeccak, hashSkein.begin(), 256);
+            Keccak_HashFinal (&ctxKeccak, hashKeccak.begin());
+
+            return hashKeccak;
+        }
+
+
+        /* The number of threads to hash chunks with. */
+        uint32_t threads()
+        {
+            return std::min(8u, std::max(1u, std::thread::hardware_concurrency()));
+        }
+
+
+        /* Check that a file of a snapshot belongs to one of our databases. */
+        bool allowed(const std::string& strPath)
+        {
+            /* Never allow a path to climb out of the data directory. */
+            if(strPath.find("..") != std::string::npos || strPath.find('\\') != std::string::npos)
+                return false;
+
+            for(const auto& strDatabase : SNAPSHOT_DATABASES)
+                if(strPath.compare(0, strDatabase.size() + 1, strDatabase + "/") == 0)
+                    return true;
+
+            return false;
+        }
+
+
+        /* The directory the databases replaced by an import are kept in until the import is committed. */
+        std::string previous()
+        {
+            return config::GetDataDir() + "snapshot.old/";
+        }
+
+
+        /* Put back the databases kept aside by an import, removing the ones that replaced them. */
+        void restore()
+        {
+            const std::string strDataDir  = config::GetDataDir();
+            const std::string strPrevious = previous();
+
+            for(const auto& strDatabase : SNAPSHOT_DATABASES)
+            {
+                if(filesystem::exists(strDataDir + strDatabase))
+                    filesystem::remove_directories(strDataDir + strDatabase);
+
+                if(filesystem::exists(strPrevious + strDatabase) && !filesystem::rename(strPrevious + strDatabase, strDataDir + strDatabase))
+                {
+                    debug::error(FUNCTION, "failed to restore ", strDatabase, ", it remains in ", strPrevious);
+                    return;
+                }
+            }
+
+            if(filesystem::exists(strPrevious + "journal.dat"))
+                filesystem::rename(strPrevious + "journal.dat", strDataDir + "journal.dat");
+
+            filesystem::remove_directories(strPrevious);
+        }
+    }
+
+
+    /* Default Constructor. */
+    SnapshotManifest::SnapshotManifest()
+    : nVersion   (SNAPSHOT_VERSION)
+    , nHeight    (0)
+    , hashBlock  (0)
+    , nChunkSize (SNAPSHOT_CHUNK_SIZE)
+    , vFiles     ( )
+    , vChunks    ( )
+    {
+    }
+
+
+    /* Get the number of chunks a file of the given size is split into. */
+    uint64_t SnapshotManifest::Chunks(const uint64_t nSize) const
+    {
+        return (nSize + nChunkSize - 1) / nChunkSize;
+    }
+
+
+    /* Write a snapshot of the consensus databases as they are on disk. */
+    bool SnapshotExport(const std::string& strFile, const uint32_t nHeight, const uint1024_t& hashBlock)
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        debug::log(0, FUNCTION, "Exporting snapshot at height ", nHeight, " hash ", hashBlock.SubString(), " to ", strFile);
+
+        /* Build the list of files of our databases. */
+        SnapshotManifest manifest;
+        manifest.nHeight   = nHeight;
+        manifest.hashBlock = hashBlock;
+
+        const std::string strDataDir = config::GetDataDir();
+        try
+        {
+            for(const auto& strDatabase : SNAPSHOT_DATABASES)
+            {
+                /* Skip the databases that were never created. */
+                if(!filesystem::exists(strDataDir + strDatabase))
+                    continue;
+
+                std::vector<std::string> vPaths;
+                for(const auto& entry : std::filesystem::recursive_directory_iterator(strDataDir + strDatabase))
+                {
+                    if(!entry.is_regular_file())
+                        continue;
+
+                    /* The bucket filters only exist while a database is closed, and are rebuilt on startup. */
+                    if(entry.path().filename() == "_hashmap.filter")
+                        continue;
+
+                    vPaths.push_back(std::filesystem::relative(entry.path(), strDataDir).generic_string());
+                }
+
+                std::sort(vPaths.begin(), vPaths.end());
+                for(const auto& strPath : vPaths)
+                    manifest.vFiles.push_back(std::make_pair(strPath, static_cast<uint64_t>(filesystem::size(strDataDir + strPath))));
+            }
+        }
+        catch(const std::filesystem::filesystem_error& e)
+        {
+            return debug::error(FUNCTION, "failed to list databases: ", e.what());
+        }
+
+        /* Reserve the hashes so the manifest has its final size. */
+        uint64_t nChunks = 0;
+        for(const auto& file : manifest.vFiles)
+            nChunks += manifest.Chunks(file.second);
+
+        manifest.vChunks.assign(nChunks, uint256_t(0));
+
+        DataStream ssManifest(SER_DISK, DATABASE_VERSION);
+        ssManifest << manifest;
+
+        const uint64_t nHeader = 4 + ssManifest.size() + 32;
+
+        /* Write to a temporary file so a partial snapshot is never mistaken for a complete one. */
+        const std::string strParent = std::filesystem::path(strFile).parent_path().string() + "/";
+        if(!filesystem::exists(strParent))
+            filesystem::create_directories(strParent);
+
+        const std::string strTemp = strFile + ".tmp";
+        std::ofstream stream(strTemp, std::ios::out | std::ios::binary | std::ios::trunc);
+        if(!stream.is_open())
+            return debug::error(FUNCTION, "failed to create ", strTemp);
+
+        /* Leave space for the manifest, it is written last once the chunks are hashed. */
+        const std::vector<uint8_t> vHeader(nHeader, 0);
+        stream.write((char*)&vHeader[0], vHeader.size());
+
+        /* Read the chunks sequentially, hashing a batch of them in parallel before writing them out. */
+        const uint32_t nThreads = threads();
+        std::vector<std::vector<uint8_t>> vBatch;
+
+        uint64_t nChunk = 0;
+        uint64_t nBytes = 0;
+        auto flush = [&]()
+        {
+            std::vector<std::thread> vThreads;
+            for(uint32_t n = 0; n < vBatch.size(); ++n)
+                vThreads.emplace_back([&, n]{ manifest.vChunks[nChunk + n] = checksum(&vBatch[n][0], vBatch[n].size()); });
+
+            for(auto& thread : vThreads)
+                thread.join();
+
+            for(const auto& vData : vBatch)
+            {
+                stream.write((char*)&vData[0], vData.size());
+                nBytes += vData.size();
+            }
+
+            nChunk += vBatch.size();
+            vBatch.clear();
+        };
+
+        for(const auto& file : manifest.vFiles)
+        {
+            std::ifstream input(strDataDir + file.first, std::ios::in | std::ios::binary);
+            if(!input.is_open())
+            {
+                filesystem::remove(strTemp);
+                return debug::error(FUNCTION, "failed to open ", file.first);
+            }
+
+            for(uint64_t nOffset = 0; nOffset < file.second; nOffset += manifest.nChunkSize)
+            {
+                std::vector<uint8_t> vData(std::min(static_cast<uint64_t>(manifest.nChunkSize), file.second - nOffset));
+                if(!input.read((char*)&vData[0], vData.size()))
+                {
+                    filesystem::remove(strTemp);
+                    return debug::error(FUNCTION, "failed to read ", file.first, " at ", nOffset);
+                }
+
+                vBatch.push_back(std::move(vData));
+                if(vBatch.size() == nThreads)
+                    flush();
+            }
+        }
+        flush();
+
+        /* Write the manifest with its hashes and checksum. */
+        ssManifest.clear();
+        ssManifest << manifest;
+
+        const uint32_t nManifestSize  = static_cast<uint32_t>(ssManifest.size());
+        const uint256_t hashManifest  = checksum(ssManifest.data(), ssManifest.size());
+
+        stream.seekp(0, std::ios::beg);
+        stream.write((char*)&nManifestSize, sizeof(nManifestSize));
+        stream.write((char*)ssManifest.data(), ssManifest.size());
+        stream.write((char*)hashManifest.begin(), 32);
+        stream.close();
+
+        if(stream.fail())
+        {
+            filesystem::remove(strTemp);
+            return debug::error(FUNCTION, "failed to write ", strTemp);
+        }
+
+        /* Move the finished snapshot into place. */
+        filesystem::remove(strFile);
+        if(!filesystem::rename(strTemp, strFile))
+            return debug::error(FUNCTION, "failed to rename ", strTemp);
+
+        debug::log(0, FUNCTION, "Exported snapshot of ", manifest.vFiles.size(), " files and ", nBytes, " bytes in ",
+            timer.ElapsedMilliseconds(), " ms with manifest hash ", hashManifest.ToString());
+
+        return true;
+    }
+
+
+    /* Verify a snapshot and replace the consensus databases with it. */
+    bool SnapshotImport(const std::string& strFile, uint1024_t& hashBlock)
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        debug::log(0, FUNCTION, "Importing snapshot from ", strFile);
+
+        std::ifstream stream(strFile, std::ios::in | std::ios::binary);
+        if(!stream.is_open())
+            return debug::error(FUNCTION, "failed to open ", strFile);
+
+        /* Read the manifest and check it against its hash. */
+        uint32_t nManifestSize = 0;
+        if(!stream.read((char*)&nManifestSize, sizeof(nManifestSize)) || nManifestSize == 0 || nManifestSize > MAX_SNAPSHOT_MANIFEST_SIZE)
+            return debug::error(FUNCTION, strFile, " is not a snapshot");
+
+        std::vector<uint8_t> vManifest(nManifestSize, 0);
+        uint256_t hashManifest = 0;
+        if(!stream.read((char*)&vManifest[0], vManifest.size()) || !stream.read((char*)hashManifest.begin(), 32))
+            return debug::error(FUNCTION, "failed to read manifest");
+
+        if(checksum(&vManifest[0], vManifest.size()) != hashManifest)
+            return debug::error(FUNCTION, "manifest checksum mismatch");
+
+        SnapshotManifest manifest;
+        try
+        {
+            DataStream ssManifest(vManifest, SER_DISK, DATABASE_VERSION);
+            ssManifest >> manifest;
+        }
+        catch(const std::exception& e)
+        {
+            return debug::error(FUNCTION, "failed to deserialize manifest: ", e.what());
+        }
+
+        /* Check the manifest describes a snapshot we can import. */
+        if(manifest.nVersion != SNAPSHOT_VERSION)
+            return debug::error(FUNCTION, "unsupported snapshot version ", manifest.nVersion);
+
+        if(manifest.nChunkSize == 0)
+            return debug::error(FUNCTION, "invalid chunk size");
+
+        uint64_t nChunks = 0;
+        uint64_t nBytes  = 0;
+        for(const auto& file : manifest.vFiles)
+        {
+            if(!allowed(file.first))
+                return debug::error(FUNCTION, "snapshot file outside of databases: ", file.first);
+
+            nChunks += manifest.Chunks(file.second);
+            nBytes  += file.second;
+        }
+
+        if(nChunks != manifest.vChunks.size())
+            return debug::error(FUNCTION, "manifest has ", manifest.vChunks.size(), " hashes for ", nChunks, " chunks");
+
+        /* Catch a truncated download before reading through all of it. */
+        const uint64_t nHeader = 4 + nManifestSize + 32;
+        if(filesystem::size(strFile) != static_cast<int64_t>(nHeader + nBytes))
+            return debug::error(FUNCTION, "snapshot size ", filesystem::size(strFile), " expected ", nHeader + nBytes);
+
+        debug::log(0, FUNCTION, "Snapshot at height ", manifest.nHeight, " hash ", manifest.hashBlock.SubString(),
+            " with ", manifest.vFiles.size(), " files and ", nBytes, " bytes");
+
+        /* Never overwrite the databases an earlier import kept aside, they may be the only good copy. */
+        const std::string strPrevious = previous();
+        if(filesystem::exists(strPrevious))
+            return debug::error(FUNCTION, "databases replaced by an earlier import are still in ", strPrevious);
+
+        /* Build the databases in a staging directory, so a failed import leaves the current ones alone. */
+        const std::string strDataDir = config::GetDataDir();
+        const std::string strStaging = strDataDir + "snapshot.import/";
+        if(filesystem::exists(strStaging))
+            filesystem::remove_directories(strStaging);
+
+        std::vector<int> vDescriptors;
+        auto cleanup = [&]()
+        {
+            for(const int nFile : vDescriptors)
+                ::close(nFile);
+
+            filesystem::remove_directories(strStaging);
+        };
+
+        for(const auto& file : manifest.vFiles)
+        {
+            const std::string strPath   = strStaging + file.first;
+            const std::string strParent = std::filesystem::path(strPath).parent_path().string() + "/";
+            if(!filesystem::exists(strParent))
+                filesystem::create_directories(strParent);
+
+            const int nFile = ::open(strPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if(nFile < 0)
+            {
+                cleanup();
+                return debug::error(FUNCTION, "failed to create ", strPath);
+            }
+
+            vDescriptors.push_back(nFile);
+            if(::ftruncate(nFile, file.second) != 0)
+            {
+                cleanup();
+                return debug::error(FUNCTION, "failed to allocate ", strPath);
+            }
+        }
+
+        /* A chunk read from the snapshot, waiting to be verified and written. */
+        struct Chunk
+        {
+            uint32_t nFile;
+            uint64_t nOffset;
+            uint64_t nIndex;
+            std::vector<uint8_t> vData;
+        };
+
+        std::mutex MUTEX;
+        std::condition_variable CONDITION;
+        std::deque<Chunk> queueChunks;
+        std::atomic<bool> fFailed(false);
+        bool fDone = false;
+
+        /* Verify and write the chunks in parallel as they are read. */
+        const uint32_t nThreads = threads();
+        std::vector<std::thread> vThreads;
+        for(uint32_t n = 0; n < nThreads; ++n)
+        {
+            vThreads.emplace_back([&]
+            {
+                while(!fFailed.load())
+                {
+                    Chunk chunk;
+                    {
+                        LOCK(MUTEX);
+                        CONDITION.wait(lk, [&]{ return !queueChunks.empty() || fDone || fFailed.load(); });
+
+                        if(queueChunks.empty())
+                            return;
+
+                        chunk = std::move(queueChunks.front());
+                        queueChunks.pop_front();
+                    }
+                    CONDITION.notify_all();
+
+                    /* Check the chunk against the manifest. */
+                    if(checksum(&chunk.vData[0], chunk.vData.size()) != manifest.vChunks[chunk.nIndex])
+                    {
+                        debug::error(FUNCTION, "checksum mismatch in ", manifest.vFiles[chunk.nFile].first, " at ", chunk.nOffset);
+
+                        fFailed.store(true);
+                        CONDITION.notify_all();
+
+                        return;
+                    }
+
+                    /* Write the chunk into its file. */
+                    uint64_t nWritten = 0;
+                    while(nWritten < chunk.vData.size())
+                    {
+                        const ssize_t nWrite = ::pwrite(vDescriptors[chunk.nFile], &chunk.vData[nWritten],
+                            chunk.vData.size() - nWritten, chunk.nOffset + nWritten);
+
+                        if(nWrite <= 0)
+                        {
+                            debug::error(FUNCTION, "failed to write ", manifest.vFiles[chunk.nFile].first, " at ", chunk.nOffset);
+
+                            fFailed.store(true);
+                            CONDITION.notify_all();
+
+                            return;
+                        }
+
+                        nWritten += nWrite;
+                    }
+                }
+            });
+        }
+
+        /* Read the chunks sequentially, keeping a few per thread queued. */
+        uint64_t nIndex = 0;
+        for(uint32_t nFile = 0; nFile < manifest.vFiles.size() && !fFailed.load(); ++nFile)
+        {
+            const uint64_t nSize = manifest.vFiles[nFile].second;
+            for(uint64_t nOffset = 0; nOffset < nSize && !fFailed.load(); nOffset += manifest.nChunkSize)
+            {
+                Chunk chunk;
+                chunk.nFile   = nFile;
+                chunk.nOffset = nOffset;
+                chunk.nIndex  = nIndex++;
+                chunk.vData.resize(std::min(static_cast<uint64_t>(manifest.nChunkSize), nSize - nOffset));
+
+                if(!stream.read((char*)&chunk.vData[0], chunk.vData.size()))
+                {
+                    debug::error(FUNCTION, "failed to read ", manifest.vFiles[nFile].first, " at ", nOffset);
+
+                    fFailed.store(true);
+                    break;
+                }
+
+                LOCK(MUTEX);
+                CONDITION.wait(lk, [&]{ return queueChunks.size() < nThreads * 2 || fFailed.load(); });
+
+                queueChunks.push_back(std::move(chunk));
+                CONDITION.notify_all();
+            }
+        }
+
+        {
+            LOCK(MUTEX);
+            fDone = true;
+        }
+        CONDITION.notify_all();
+
+        for(auto& thread : vThreads)
+            thread.join();
+
+        if(fFailed.load())
+        {
+            cleanup();
+            return debug::error(FUNCTION, "snapshot failed verification");
+        }
+
+        /* Make the staged files durable before they replace anything. */
+        for(const int nFile : vDescriptors)
+            ::fdatasync(nFile);
+
+        for(const int nFile : vDescriptors)
+            ::close(nFile);
+
+        vDescriptors.clear();
+
+        /* Move the current databases aside first, so they can be put back if anything after this fails. */
+        if(!filesystem::create_directories(strPrevious))
+        {
+            cleanup();
+            return debug::error(FUNCTION, "failed to create ", strPrevious);
+        }
+
+        for(const auto& strDatabase : SNAPSHOT_DATABASES)
+        {
+            if(filesystem::exists(strDataDir + strDatabase) && !filesystem::rename(strDataDir + strDatabase, strPrevious + strDatabase))
+            {
+                restore();
+                cleanup();
+                return debug::error(FUNCTION, "failed to move ", strDatabase, " aside");
+            }
+        }
+
+        /* The journal holds records of the databases that were replaced, which must never be replayed on top of the snapshot. */
+        if(filesystem::exists(strDataDir + "journal.dat") && !filesystem::rename(strDataDir + "journal.dat", strPrevious + "journal.dat"))
+        {
+            restore();
+            cleanup();
+            return debug::error(FUNCTION, "failed to move journal.dat aside");
+        }
+
+        /* Swap in the new databases, their bucket filters are rebuilt from the new keychains. */
+        for(const auto& strDatabase : SNAPSHOT_DATABASES)
+        {
+            if(filesystem::exists(strStaging + strDatabase) && !filesystem::rename(strStaging + strDatabase, strDataDir + strDatabase))
+            {
+                restore();
+                cleanup();
+                return debug::error(FUNCTION, "failed to move ", strDatabase, " into place");
+            }
+        }
+
+        filesystem::remove_directories(strStaging);
+
+        debug::log(0, FUNCTION, "Imported snapshot at height ", manifest.nHeight, " in ", timer.ElapsedMilliseconds(), " ms");
+
+        hashBlock = manifest.hashBlock;
+        return true;
+    }
+
+
+    /* Delete the databases an import replaced. */
+    void SnapshotCommit()
+    {
+        if(filesystem::exists(previous()))
+            filesystem::remove_directories(previous());
+    }
+
+
+    /* Put back the databases an import replaced. */
+    void SnapshotRollback()
+    {
+        if(!filesystem::exists(previous()))
+            return;
+
+        debug::log(0, FUNCTION, "Restoring the databases replaced by the snapshot");
+        restore();
+    }
+
+
+    /* Get the file a snapshot at a given height is exported to. */
+    std::string SnapshotPath(const uint32_t nHeight)
+    {
+        return debug::safe_printstr(config::GetDataDir(), "snapshots/snapshot.", nHeight, ".lld");
+    }
+}
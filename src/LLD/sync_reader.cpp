@@ -0,0 +1,321 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLD/include/global.h>
+#include <LLD/types/sync_reader.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+#include <TAO/Ledger/include/enum.h>
+#include <TAO/Ledger/types/state.h>
+
+#include <Legacy/types/transaction.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/mutex.h>
+#include <Util/include/runtime.h>
+
+namespace LLD
+{
+    /* The number of block states read from disk at a time. */
+    const uint32_t SYNC_READER_BATCH = 64;
+
+
+    /* The number of blocks read ahead of the connection. */
+    const uint32_t SYNC_READER_BLOCKS = 512;
+
+
+    /* The number of transaction bytes read ahead of the connection. */
+    const uint64_t SYNC_READER_BYTES = 16 * 1024 * 1024;
+
+
+    /* The number of blocks handed out that a list can start again from. */
+    const uint32_t SYNC_READER_HISTORY = 2;
+
+
+    /* Seconds without a block handed out before the reader thread stops. */
+    const uint64_t SYNC_READER_IDLE = 60;
+
+
+    /* Constructor, starting to read from the given block. */
+    SyncReader::SyncReader(const uint1024_t& hashStart)
+    : MUTEX        ( )
+    , CONDITION    ( )
+    , queueBlocks  ( )
+    , queueHistory ( )
+    , nQueueBytes  (0)
+    , nLastAccess  (runtime::timestamp())
+    , fStop        (false)
+    , fDone        (false)
+    , fIdle        (false)
+    , THREAD       (&SyncReader::Prefetch, this, hashStart)
+    {
+    }
+
+
+    /* Default Destructor, stopping the reader thread. */
+    SyncReader::~SyncReader()
+    {
+        fStop.store(true);
+        CONDITION.notify_all();
+
+        if(THREAD.joinable())
+            THREAD.join();
+    }
+
+
+    /* Check if the reader can continue from a block, moving back to it if it was just handed out. */
+    bool SyncReader::Seek(const uint1024_t& hashStart)
+    {
+        LOCK(MUTEX);
+
+        /* A reader that stopped early or at an older end of the chain has nothing more to give. */
+        if(fIdle.load() || (fDone.load() && queueBlocks.empty()))
+            return false;
+
+        /* Check if the list starts where we are. */
+        if(!queueBlocks.empty() && queueBlocks.front().first == hashStart)
+            return true;
+
+        /* Lists usually start from the last block of the previous one, so move back to it. */
+        for(auto it = queueHistory.rbegin(); it != queueHistory.rend(); ++it)
+        {
+            if(it->first != hashStart)
+                continue;
+
+            /* Put the blocks after it back on the queue in order. */
+            const uint32_t nBack = static_cast<uint32_t>(it - queueHistory.rbegin()) + 1;
+            for(uint32_t n = 0; n < nBack; ++n)
+            {
+                for(const auto& tx : queueHistory.back().second.vtx)
+                    nQueueBytes += tx.second.size();
+
+                queueBlocks.push_front(std::move(queueHistory.back()));
+                queueHistory.pop_back();
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+
+    /* Get the next block of the main chain, waiting for the reader thread if it is behind. */
+    bool SyncReader::Next(TAO::Ledger::SyncBlock &block, uint1024_t &hashBlock)
+    {
+        LOCK(MUTEX);
+        CONDITION.wait(lk, [this]{ return !queueBlocks.empty() || fDone.load() || fStop.load(); });
+
+        /* Check for the end of the chain. */
+        if(queueBlocks.empty())
+            return false;
+
+        /* Hand out the next block, keeping a copy in our history. */
+        hashBlock = queueBlocks.front().first;
+        block     = queueBlocks.front().second;
+
+        for(const auto& tx : block.vtx)
+            nQueueBytes -= tx.second.size();
+
+        queueHistory.push_back(std::move(queueBlocks.front()));
+        queueBlocks.pop_front();
+
+        if(queueHistory.size() > SYNC_READER_HISTORY)
+            queueHistory.pop_front();
+
+        nLastAccess = runtime::timestamp();
+
+        /* Let the reader thread know there is space. */
+        CONDITION.notify_all();
+
+        return true;
+    }
+
+
+    /* Thread walking the chain and reading the blocks. */
+    void SyncReader::Prefetch(const uint1024_t hashStart)
+    {
+        try
+        {
+            /* Read the block before our start, the first block read is the start itself. */
+            TAO::Ledger::BlockState stateLast;
+            if(!LLD::Ledger->ReadBlock(hashStart, stateLast))
+                throw debug::exception(FUNCTION, "failed to read starting block");
+
+            if(hashStart != TAO::Ledger::ChainState::Genesis())
+                stateLast = stateLast.Prev();
+
+            /* Track our sequential block index to read the next batch. */
+            uint1024_t hashLastRead = stateLast.GetHash();
+            uint1024_t hashLast     = hashLastRead;
+
+            std::vector<TAO::Ledger::BlockState> vStates;
+            std::vector<uint1024_t> vHashes;
+
+            std::vector<TAO::Ledger::BlockState> vChain;
+            std::vector<uint1024_t> vChainHashes;
+
+            bool fEnd = false;
+            while(!fStop.load() && !fEnd && !config::fShutdown.load())
+            {
+                /* Do a sequential read of the states following our last one on disk. */
+                if(!LLD::Ledger->BatchRead(hashLastRead, "block", vStates, SYNC_READER_BATCH, true))
+                    break;
+
+                /* Hash the whole batch of headers at once. */
+                TAO::Ledger::BlockState::GetHashes(vStates, vHashes);
+
+                /* Follow the main chain through the batch. */
+                vChain.clear();
+                vChainHashes.clear();
+                for(uint32_t nIndex = 0; nIndex < vStates.size(); ++nIndex)
+                {
+                    auto& state = vStates[nIndex];
+
+                    /* Keep this iterating so we can track our sequential reads. */
+                    hashLastRead = vHashes[nIndex];
+
+                    /* Check if in main chain. */
+                    if(!state.IsInMainChain())
+                        continue;
+
+                    /* Read the next block by index when the disk order doesn't follow the chain. */
+                    if(state.hashPrevBlock != hashLast)
+                    {
+                        if(!LLD::Ledger->ReadBlock(stateLast.hashNextBlock, state))
+                        {
+                            fEnd = true;
+                            break;
+                        }
+
+                        hashLastRead = state.GetHash();
+                    }
+
+                    vChain.push_back(state);
+                    vChainHashes.push_back(hashLastRead);
+
+                    stateLast = state;
+                    hashLast  = hashLastRead;
+                }
+
+                /* Read the tritium transactions of the whole batch at once. */
+                std::vector<uint512_t> vTxHashes;
+                for(const auto& state : vChain)
+                    for(const auto& proof : state.vtx)
+                        if(proof.first == TAO::Ledger::TRANSACTION::TRITIUM)
+                            vTxHashes.push_back(proof.second);
+
+                std::vector<TAO::Ledger::Transaction> vTx;
+                const bool fBatch = LLD::Ledger->ReadTx(vTxHashes, vTx);
+
+                /* Build the sync blocks in chain order. */
+                uint32_t nTx = 0;
+                for(uint32_t nIndex = 0; nIndex < vChain.size(); ++nIndex)
+                {
+                    const TAO::Ledger::BlockState& state = vChain[nIndex];
+
+                    TAO::Ledger::SyncBlock block(state, false);
+                    for(const auto& proof : state.vtx)
+                    {
+                        DataStream ssData(SER_DISK, LLD::DATABASE_VERSION);
+                        switch(proof.first)
+                        {
+                            /* Check for tritium. */
+                            case TAO::Ledger::TRANSACTION::TRITIUM:
+                            {
+                                /* Read the transactions the batch missed one by one, checking the mempool too. */
+                                TAO::Ledger::Transaction& tx = vTx[nTx++];
+                                if(!fBatch && !LLD::Ledger->ReadTx(proof.second, tx, TAO::Ledger::FLAGS::MEMPOOL))
+                                    throw debug::exception(FUNCTION, "failed to read tx ", proof.second.SubString());
+
+                                ssData << tx;
+                                break;
+                            }
+
+                            /* Check for legacy. */
+                            case TAO::Ledger::TRANSACTION::LEGACY:
+                            {
+                                Legacy::Transaction tx;
+                                if(!LLD::Legacy->ReadTx(proof.second, tx, TAO::Ledger::FLAGS::MEMPOOL))
+                                    throw debug::exception(FUNCTION, "failed to read tx ", proof.second.SubString());
+
+                                ssData << tx;
+                                break;
+                            }
+
+                            /* Check for checkpoint. */
+                            case TAO::Ledger::TRANSACTION::CHECKPOINT:
+                            {
+                                ssData << proof.second;
+                                break;
+                            }
+
+                            default:
+                                continue;
+                        }
+
+                        block.vtx.push_back(std::make_pair(proof.first, ssData.Bytes()));
+                    }
+
+                    /* Stop once nobody is taking our blocks. */
+                    if(!push(vChainHashes[nIndex], std::move(block)))
+                    {
+                        fEnd = true;
+                        break;
+                    }
+                }
+
+                /* Check for the end of the chain. */
+                if(hashLast == TAO::Ledger::ChainState::hashBestChain.load())
+                    break;
+            }
+        }
+        catch(const std::exception& e)
+        {
+            debug::error(FUNCTION, e.what());
+        }
+
+        fDone.store(true);
+        CONDITION.notify_all();
+    }
+
+
+    /* Add a block to the queue, waiting for space. */
+    bool SyncReader::push(const uint1024_t& hashBlock, TAO::Ledger::SyncBlock&& block)
+    {
+        LOCK(MUTEX);
+
+        /* Wait for the connection to catch up. */
+        while(queueBlocks.size() >= SYNC_READER_BLOCKS || nQueueBytes >= SYNC_READER_BYTES)
+        {
+            CONDITION.wait_for(lk, std::chrono::seconds(1));
+            if(fStop.load() || config::fShutdown.load())
+                return false;
+
+            /* Stop reading for a connection that went quiet. */
+            if(nLastAccess + SYNC_READER_IDLE < runtime::timestamp())
+            {
+                fIdle.store(true);
+                return false;
+            }
+        }
+
+        for(const auto& tx : block.vtx)
+            nQueueBytes += tx.second.size();
+
+        queueBlocks.emplace_back(hashBlock, std::move(block));
+        CONDITION.notify_all();
+
+        return !fStop.load();
+    }
+}
@@ -0,0 +1,295 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLD_TEMPLATES_JOURNAL_H
+#define NEXUS_LLD_TEMPLATES_JOURNAL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace LLD
+{
+
+    /* Size the journal file is preallocated to, so appends don't change file metadata. */
+    const uint64_t JOURNAL_PREALLOCATE_SIZE = 1024 * 1024 * 16; //16 MB Journal
+
+
+    /** Journal
+     *
+     *  Write-ahead journal shared by all the sector databases of a process.
+     *
+     *  The journal file is preallocated, kept open for the lifetime of the process, and only
+     *  ever appended to. Every record carries a checksum and the epoch of the journal, so that
+     *  replay stops at the first torn or stale record without needing to truncate the file.
+     *  The current epoch and where its records begin are kept in a superblock at the start of
+     *  the file, so an epoch is never reused across restarts.
+     *
+     *  Appends never sync by themselves. Sync is a group commit: the first caller flushes
+     *  everything appended so far with one fdatasync, and callers whose records were covered
+     *  by that flush return without syncing again. A block connect that checkpoints several
+     *  databases is therefore made durable by a single flush.
+     *
+     **/
+    class Journal
+    {
+        /* Mutex to guard the file tail and the sync state. */
+        std::mutex JOURNAL_MUTEX;
+
+
+        /* Condition for followers to wait on an in-flight sync. */
+        std::condition_variable SYNC_CONDITION;
+
+
+        /* The location of the journal file. */
+        std::string strPath;
+
+
+        /* The descriptor of the journal file, kept open for the lifetime of the journal. */
+        int nFile;
+
+
+        /* The current epoch, records of previous epochs are ignored on replay. */
+        uint32_t nEpoch;
+
+
+        /* The binary position in the file the records of the current epoch begin at. */
+        uint64_t nBegin;
+
+
+        /* The binary position in the file the next record is appended to. */
+        uint64_t nTail;
+
+
+        /* The total bytes appended over the lifetime of the journal, used as the log sequence number. */
+        uint64_t nWritten;
+
+
+        /* The log sequence number that is known to be durable. */
+        uint64_t nSynced;
+
+
+        /* Flag to indicate a sync is in flight. */
+        bool fSyncing;
+
+
+        /* The databases that have checkpointed records not released yet. */
+        std::set<std::string> setPending;
+
+
+        /* The data files written under released checkpoints, synced before the journal is rewound. */
+        std::set<std::string> setDirty;
+
+
+        /* The records found on replay that haven't been claimed by their database yet. */
+        std::map<std::string, std::vector<uint8_t>> mapRecovery;
+
+
+        /* The shared journals indexed by their file location, with their reference counts. */
+        static std::map<std::string, std::pair<Journal*, uint32_t>> mapJournals;
+
+
+        /* Mutex to guard the shared journals. */
+        static std::mutex JOURNALS_MUTEX;
+
+
+    public:
+
+
+        /** Default Constructor. **/
+        Journal()                                = delete;
+
+
+        /** Copy Constructor. **/
+        Journal(const Journal& journal)          = delete;
+
+
+        /** Move Constructor. **/
+        Journal(Journal&& journal)               = delete;
+
+
+        /** Copy assignment. **/
+        Journal& operator=(const Journal& journal) = delete;
+
+
+        /** Move assignment. **/
+        Journal& operator=(Journal&& journal)    = delete;
+
+
+        /** Class Destructor. Syncs and closes the journal file. **/
+        ~Journal();
+
+
+        /** Location Constructor
+         *
+         *  Opens the journal file, preallocating it if needed, and replays its records.
+         *
+         *  @param[in] strPathIn The location of the journal file.
+         *
+         **/
+        Journal(const std::string& strPathIn);
+
+
+        /** Open
+         *
+         *  Get the shared journal for a given location, opening it on first use.
+         *
+         *  @param[in] strPathIn The location of the journal file.
+         *
+         *  @return The shared journal.
+         *
+         **/
+        static Journal* Open(const std::string& strPathIn);
+
+
+        /** Close
+         *
+         *  Release a shared journal, closing it once no database uses it.
+         *
+         *  @param[in] pJournal The shared journal to release.
+         *
+         **/
+        static void Close(Journal* pJournal);
+
+
+        /** Append
+         *
+         *  Append a checkpoint record for a database. The record is not durable until synced.
+         *
+         *  @param[in] strName The name of the database the record belongs to.
+         *  @param[in] vData The binary data of the checkpoint.
+         *
+         *  @return The log sequence number to pass to Sync, 0 on failure.
+         *
+         **/
+        uint64_t Append(const std::string& strName, const std::vector<uint8_t>& vData);
+
+
+        /** Sync
+         *
+         *  Make all records up to given log sequence number durable, batching concurrent
+         *  callers into a single flush.
+         *
+         *  @param[in] nSequence The log sequence number returned from Append.
+         *
+         *  @return True if the records are durable, false otherwise.
+         *
+         **/
+        bool Sync(const uint64_t nSequence);
+
+
+        /** Release
+         *
+         *  Mark the checkpoint of a database as applied. Once no database has a pending
+         *  checkpoint, the data files written under every released checkpoint are synced
+         *  together and the journal is rewound under a new epoch. The release record itself
+         *  isn't synced, since replaying an applied checkpoint writes the same data again.
+         *
+         *  @param[in] strName The name of the database to release.
+         *  @param[in] setFiles The data files the database wrote applying its checkpoint.
+         *
+         **/
+        void Release(const std::string& strName, const std::set<std::string>& setFiles);
+
+
+        /** Recover
+         *
+         *  Get the last checkpoint of a database found on replay that was never released.
+         *
+         *  @param[in] strName The name of the database to recover.
+         *  @param[out] vData The binary data of the checkpoint.
+         *
+         *  @return True if there is a checkpoint to recover, false otherwise.
+         *
+         **/
+        bool Recover(const std::string& strName, std::vector<uint8_t>& vData);
+
+
+    private:
+
+        /** Record
+         *
+         *  Build a record of the current epoch.
+         *
+         *  @param[in] strName The name of the database the record belongs to.
+         *  @param[in] nType The type of record.
+         *  @param[in] vData The binary data of the record.
+         *
+         *  @return The binary record with its header.
+         *
+         **/
+        std::vector<uint8_t> record(const std::string& strName, const uint8_t nType, const std::vector<uint8_t>& vData) const;
+
+
+        /** Write
+         *
+         *  Write a record at the tail of the journal, must be called with the journal locked.
+         *
+         *  @param[in] strName The name of the database the record belongs to.
+         *  @param[in] nType The type of record.
+         *  @param[in] vData The binary data of the record.
+         *
+         *  @return True if the record was written, false otherwise.
+         *
+         **/
+        bool write(const std::string& strName, const uint8_t nType, const std::vector<uint8_t>& vData);
+
+
+        /** Rewind
+         *
+         *  Start a new epoch, carrying over the checkpoints that haven't been claimed. The carried
+         *  over records are synced before the superblock is swapped to them, so a crash in between
+         *  still replays the previous epoch. Must be called with the journal locked.
+         *
+         *  @return True if the new epoch is durable, false otherwise.
+         *
+         **/
+        bool rewind();
+
+
+        /** Read Epoch
+         *
+         *  Read the current epoch and where its records begin from the superblock.
+         *
+         *  @return True if the superblock is valid, false if missing or torn.
+         *
+         **/
+        bool read_epoch();
+
+
+        /** Write Epoch
+         *
+         *  Write the current epoch and where its records begin to the superblock and sync it.
+         *
+         *  @return True if the superblock is durable, false otherwise.
+         *
+         **/
+        bool write_epoch();
+
+
+        /** Replay
+         *
+         *  Scan the journal file for the records of the current epoch.
+         *
+         **/
+        void replay();
+
+    };
+}
+
+#endif
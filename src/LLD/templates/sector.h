@@ -20,14 +20,20 @@ ________________________________________________________________________________
 #include <LLD/include/version.h>
 #include <LLD/templates/key.h>
 #include <LLD/templates/transaction.h>
+#include <LLD/templates/journal.h>
 
 #include <LLD/cache/template_lru.h>
+#include <LLD/cache/file_pool.h>
+
+#include <LLP/include/validation_thread_pool.h>
 
 #include <Util/templates/datastream.h>
 #include <Util/include/runtime.h>
 #include <Util/include/debug.h>
 #include <Util/include/filesystem.h>
 
+#include <algorithm>
+#include <set>
 #include <string>
 #include <cstdint>
 #include <atomic>
@@ -35,6 +41,8 @@ ________________________________________________________________________________
 #include <mutex>
 #include <shared_mutex>
 #include <condition_variable>
+#include <functional>
+#include <memory>
 
 namespace LLD
 {
@@ -51,6 +59,23 @@ namespace LLD
     const uint32_t MAX_SECTOR_BUFFER_SIZE = 1024 * 1024 * 4; //32 MB Max Disk Buffer
 
 
+    /* Maximum gap between two records for their reads to be merged into one. */
+    const uint32_t MAX_SECTOR_COALESCE_GAP = 1024 * 4; //4 KB Max Gap
+
+
+    /* Records of a batch read deserialized per task on the validation pool. */
+    const uint32_t SECTOR_READ_SLICE = 64;
+
+
+    /* Maximum span of a single merged read. */
+    const uint32_t MAX_SECTOR_COALESCE_SIZE = 1024 * 1024; //1 MB Max Read
+
+
+    /* Marker byte for compressed records. Uncompressed records start with the compact size of
+     * their type string, which never takes this value, so both kinds can share a datachain. */
+    const uint8_t SECTOR_RECORD_COMPRESSED = 0xff;
+
+
     /** SectorDatabase
      *
      *  Base Template Class for a Sector Database.
@@ -123,11 +148,27 @@ namespace LLD
         mutable TemplateLRU<uint32_t, std::fstream*>* fileCache;
 
 
+        /* Read-only descriptor pool for positional reads. */
+        FilePool* readPool;
+
+
+        /* Write-ahead journal shared with the other databases. */
+        Journal* pJournal;
+
+
+        /* The log sequence number of our last checkpoint. */
+        uint64_t nCheckpoint;
+
+
         /* The current File Position. */
         mutable uint32_t nCurrentFile;
         mutable uint32_t nCurrentFileSize;
 
 
+        /* The sector files written since they were last synced. */
+        std::set<uint32_t> setTouched;
+
+
         /* Cache Writer Thread. */
         std::thread CacheWriterThread;
 
@@ -147,6 +188,8 @@ namespace LLD
         std::atomic<uint32_t> nBytesRead;
         std::atomic<uint32_t> nBytesWrote;
         std::atomic<uint32_t> nRecordsFlushed;
+        std::atomic<uint64_t> nBytesUncompressed;
+        std::atomic<uint64_t> nBytesCompressed;
 
         /* Destructor Flag. */
         std::atomic<bool> fDestruct;
@@ -324,6 +367,24 @@ namespace LLD
         }
 
 
+        /** BatchRead
+         *
+         *  Sequential read from beginning of datachain, handing each record to a function rather than collecting them,
+         *  so that callers can filter records as they are read and stop once they have what they need.
+         *
+         *  @param[in] strType The type specifier to read records from
+         *  @param[in] fnRecord The function called with each record, returning false to stop reading.
+         *
+         *  @return True if any entries were read, false otherwise.
+         *
+         **/
+        template<typename Type>
+        bool BatchRead(const std::string& strType, const std::function<bool(Type&)>& fnRecord)
+        {
+            return ScanBatch(0, 0, strType, fnRecord, false);
+        }
+
+
         /** GetBatch
          *
          *  Sequential read from a specified binary position.
@@ -343,9 +404,46 @@ namespace LLD
         {
             /* Clear any remaining data. */
             vValues.clear();
+            if(nLimit == 0)
+                return false;
+
+            /* Collect our values until limit is reached. */
+            const std::function<bool(Type&)> fnCollect = [&](Type& value)
+            {
+                /* Push next value. */
+                vValues.push_back(std::move(value));
+
+                /* Check limits. */
+                return (nLimit == -1 || --nLimit > 0);
+            };
+
+            /* Unlimited reads take each file in one buffer. */
+            return ScanBatch(nFilePos, nFile, strType, fnCollect, (nLimit == -1));
+        }
+
+
+        /** ScanBatch
+         *
+         *  Sequential read from a specified binary position, passing every record of given type to a function.
+         *
+         *  @param[in] nFilePos The starting binary position
+         *  @param[in] nFile The starting file
+         *  @param[in] strType The type specifier to read records from
+         *  @param[in] fnRecord The function called with each record, returning false to stop reading.
+         *  @param[in] fWholeFile Flag to read each file in one buffer rather than 1 MB at a time.
+         *
+         *  @return True if any entries were read, false otherwise.
+         *
+         **/
+        template<typename Type>
+        bool ScanBatch(uint64_t nFilePos, uint32_t nFile, const std::string& strType,
+            const std::function<bool(Type&)>& fnRecord, const bool fWholeFile)
+        {
+            /* Track if we passed any records to our function. */
+            bool fFound = false;
 
-            /* Scan until limit is reached. */
-            while(nLimit == -1 || nLimit > 0)
+            /* Scan until we run out of files. */
+            while(true)
             {
                 /* Get our path to use. */
                 const std::string strPath =
@@ -355,17 +453,16 @@ namespace LLD
                 const int64_t nFileSize =
                     filesystem::size(strPath);
 
-                /* Get filestream object. */
-                std::ifstream stream = std::ifstream(strPath, std::ios::in | std::ios::binary);
-                if(!stream || nFileSize == -1)
+                /* Check that the file exists. */
+                if(nFileSize == -1)
                     break;
 
                 /* Calculate our buffer sizes. */
                 uint64_t nBufferSize =
-                    (nLimit == -1) ? nFileSize : (1024 * 1024); //1 MB read buffer
+                    fWholeFile ? nFileSize : (1024 * 1024); //1 MB read buffer
 
-                /* Loop until stream encounters exceptions. */
-                while(stream)
+                /* Loop until we reach the end of the file. */
+                while(true)
                 {
                     /* Check that we aren't seeking past end of file. */
                     if(nFilePos >= nFileSize)
@@ -373,23 +470,17 @@ namespace LLD
 
                     /* Read into serialize stream. */
                     DataStream ssData(SER_LLD, DATABASE_VERSION);
-                    ssData.resize(nBufferSize);
+
+                    /* Clamp our read to the end of the file. */
+                    const uint64_t nBufferRead =
+                        std::min(nBufferSize, static_cast<uint64_t>(nFileSize - nFilePos));
 
                     {
                         SHARED_LOCK(SECTOR_MUTEX);
 
-                        /* Seek stream to beginning. */
-                        stream.seekg(nFilePos, std::ios::beg);
-
-                        /* Read the data into the buffer. */
-                        if(!stream.read((char*)ssData.data(), nBufferSize))
-                            ssData.resize(stream.gcount()); //resize buffer to read size if incomplete read
-
-                        /* Iterate if meters are enabled. */
-                        const uint64_t nBufferRead = stream.gcount();
-
-                        /* Exit if we read zero bytes. */
-                        if(nBufferRead == 0)
+                        /* Read the data into the buffer from descriptor pool or mapping. */
+                        ssData.resize(nBufferRead);
+                        if(!readPool->Read(nFile, nFilePos, ssData.Bytes(), nFile < nCurrentFile))
                             break;
 
                         /* Otherwise iterate our bytes read. */
@@ -399,6 +490,10 @@ namespace LLD
                     /* Read records. */
                     while(!ssData.End())
                     {
+                        /* The record to hand over, read outside of our function so its exceptions aren't taken as truncation. */
+                        Type value;
+                        bool fValue = false;
+
                         try
                         {
                             /* Get the current stream position. */
@@ -417,25 +512,40 @@ namespace LLD
                                 continue;
                             }
 
+                            /* Compressed records are read whole and expanded into their own stream. */
+                            DataStream ssRecord(SER_LLD, DATABASE_VERSION);
+                            const bool fCompressed =
+                                (ssData.GetPos() < ssData.size() && ssData.Bytes()[ssData.GetPos()] == SECTOR_RECORD_COMPRESSED);
+
+                            if(fCompressed)
+                            {
+                                /* Read the full record, this throws to grow our buffer if incomplete. */
+                                ssRecord.resize(nSize);
+                                ssData.read((char*)ssRecord.data(), nSize);
+
+                                /* Skip over records that fail to decompress. */
+                                if(!Decompress(ssRecord.Bytes()))
+                                {
+                                    nFilePos += nSize + GetSizeOfCompactSize(nSize);
+                                    continue;
+                                }
+                            }
+
+                            /* Get the stream our record lives in. */
+                            const DataStream& ssThis = (fCompressed ? ssRecord : ssData);
+
                             /* Deserialize the String. */
                             std::string strThis;
-                            ssData >> strThis;
+                            ssThis >> strThis;
 
                             /* Check the type. */
                             if(strType == strThis)
                             {
                                 /* Get the value. */
-                                Type value;
-                                ssData >> value;
-
-                                /* Push next value. */
-                                vValues.push_back(value);
-
-                                /* Check limits. */
-                                if(nLimit != -1 && --nLimit == 0)
-                                    return (vValues.size() > 0);
+                                ssThis >> value;
+                                fValue = true;
                             }
-                            else
+                            else if(!fCompressed)
                             {
                                 try { ssData.SetPos(nPos + nSize + GetSizeOfCompactSize(nSize)); }
                                 catch(const std::exception& e){ break; }
@@ -447,11 +557,23 @@ namespace LLD
                         }
                         catch(const std::exception& e)
                         {
+                            /* Skip to the next file if the remaining record is truncated at end of file. */
+                            if(nBufferRead < nBufferSize)
+                                nFilePos = nFileSize;
+
                             /* Allocate a larger buffer if full record exceeds default buffer. */
                             nBufferSize *= 2;
 
                             break;
                         }
+
+                        /* Hand the value over, stopping if our function has all it needs. */
+                        if(fValue)
+                        {
+                            fFound = true;
+                            if(!fnRecord(value))
+                                return true;
+                        }
                     }
                 }
 
@@ -462,7 +584,7 @@ namespace LLD
                 nFilePos = 0;
             }
 
-            return (vValues.size() > 0);
+            return fFound;
         }
 
 
@@ -548,6 +670,184 @@ namespace LLD
         }
 
 
+        /** ReadMany
+         *
+         *  Read a batch of database entries identified by the given keys. All sector keys are
+         *  resolved first, disk reads are sorted by file and offset and merged where adjacent,
+         *  and values are deserialized over multiple threads for large batches.
+         *
+         *  @param[in] vKeys The keys to the database entries to read.
+         *  @param[out] vValues The database entry values to read out, in the order of the keys.
+         *  @param[out] vFound Flags for which of the entries were read.
+         *
+         *  @return The total entries that were read.
+         *
+         **/
+        template<typename Key, typename Type>
+        uint32_t ReadMany(const std::vector<Key>& vKeys, std::vector<Type>& vValues, std::vector<bool>& vFound)
+        {
+            /* Set our outputs to the size of the batch. */
+            vValues.clear();
+            vValues.resize(vKeys.size());
+            vFound.assign(vKeys.size(), false);
+
+            /* Serialize the keys into bytes. */
+            std::vector<std::vector<uint8_t>> vBinary(vKeys.size());
+            for(uint32_t n = 0; n < vKeys.size(); ++n)
+            {
+                DataStream ssKey(SER_LLD, DATABASE_VERSION);
+                ssKey << vKeys[n];
+
+                vBinary[n] = ssKey.Bytes();
+            }
+
+            /* The records of the batch, empty if not found. */
+            std::vector<std::vector<uint8_t>> vData(vKeys.size());
+
+            /* Check for keys that are pending in a transaction. */
+            std::vector<bool> vPending(vKeys.size(), false);
+            {
+                LOCK(TRANSACTION_MUTEX);
+                if(pTransaction)
+                {
+                    for(uint32_t n = 0; n < vBinary.size(); ++n)
+                    {
+                        /* Check if in erase queue. */
+                        if(pTransaction->setErasedData.count(vBinary[n]))
+                        {
+                            vPending[n] = true;
+                            continue;
+                        }
+
+                        /* Check for indexes. */
+                        if(pTransaction->mapIndex.count(vBinary[n]))
+                            vBinary[n] = pTransaction->mapIndex[vBinary[n]];
+
+                        /* Get the data from the transaction object. */
+                        if(pTransaction->mapTransactions.count(vBinary[n]))
+                        {
+                            vData[n]    = pTransaction->mapTransactions[vBinary[n]];
+                            vPending[n] = true;
+                        }
+                    }
+                }
+            }
+
+            /* Get the rest of the records from the database. */
+            GetMany(vBinary, vPending, vData);
+
+            /* Flags for deserialized records, kept as bytes so that threads never share a word. */
+            std::vector<uint8_t> vRead(vKeys.size(), 0);
+
+            /* Deserialize a range of the batch. */
+            const auto deserialize = [&](const uint32_t nBegin, const uint32_t nEnd)
+            {
+                for(uint32_t n = nBegin; n < nEnd; ++n)
+                {
+                    /* Skip over missing records. */
+                    if(vData[n].empty())
+                        continue;
+
+                    try
+                    {
+                        /* Deserialize Value. */
+                        DataStream ssValue(vData[n], SER_LLD, DATABASE_VERSION);
+
+                        /* Deserialize the String. */
+                        std::string strType;
+                        ssValue >> strType;
+
+                        /* Deseriazlie the Value. */
+                        ssValue >> vValues[n];
+
+                        vRead[n] = 1;
+                    }
+                    catch(const std::exception& e) { }
+                }
+            };
+
+            /* Small batches are deserialized on this thread. */
+            const uint32_t nSlices = static_cast<uint32_t>((vKeys.size() + SECTOR_READ_SLICE - 1) / SECTOR_READ_SLICE);
+
+            LLP::ValidationThreadPool* pPool = LLP::GetValidationPool();
+            if(!pPool || nSlices <= 1)
+                deserialize(0, vKeys.size());
+            else
+            {
+                /* Counters shared with the pool tasks, which may outlive this call. */
+                struct Batch
+                {
+                    std::atomic<uint32_t> nNext;
+                    std::atomic<uint32_t> nDone;
+                    std::mutex MUTEX;
+                    std::condition_variable CONDITION;
+
+                    Batch() : nNext(0), nDone(0), MUTEX(), CONDITION() { }
+                };
+
+                std::shared_ptr<Batch> pBatch = std::make_shared<Batch>();
+
+                /* Claim and deserialize slices until none are left, a worker that starts late never touches the batch. */
+                const uint32_t nTotal = static_cast<uint32_t>(vKeys.size());
+                const auto fnWork = [pBatch, nSlices, nTotal, &deserialize]()
+                {
+                    for(uint32_t n = pBatch->nNext++; n < nSlices; n = pBatch->nNext++)
+                    {
+                        deserialize(n * SECTOR_READ_SLICE, std::min(n * SECTOR_READ_SLICE + SECTOR_READ_SLICE, nTotal));
+
+                        /* Wake the caller on the last slice. */
+                        if(++pBatch->nDone == nSlices)
+                        {
+                            std::lock_guard<std::mutex> lock(pBatch->MUTEX);
+                            pBatch->CONDITION.notify_all();
+                        }
+                    }
+
+                    return true;
+                };
+
+                /* Hand out a task per worker, keeping a slice for ourselves. */
+                const uint32_t nTasks = std::min(pPool->GetThreadCount(), nSlices - 1);
+                for(uint32_t n = 0; n < nTasks; ++n)
+                    pPool->Submit(0, 0, 0, fnWork);
+
+                /* Work on our own slices, then wait for any still in flight. */
+                fnWork();
+
+                std::unique_lock<std::mutex> lock(pBatch->MUTEX);
+                pBatch->CONDITION.wait(lock, [pBatch, nSlices]{ return pBatch->nDone.load() == nSlices; });
+            }
+
+            /* Set our found flags. */
+            uint32_t nTotal = 0;
+            for(uint32_t n = 0; n < vRead.size(); ++n)
+            {
+                vFound[n] = (vRead[n] == 1);
+                nTotal   += vRead[n];
+            }
+
+            return nTotal;
+        }
+
+
+        /** ReadMany
+         *
+         *  Read a batch of database entries identified by the given keys.
+         *
+         *  @param[in] vKeys The keys to the database entries to read.
+         *  @param[out] vValues The database entry values to read out, in the order of the keys.
+         *
+         *  @return True if all of the entries were read, false otherwise.
+         *
+         **/
+        template<typename Key, typename Type>
+        bool ReadMany(const std::vector<Key>& vKeys, std::vector<Type>& vValues)
+        {
+            std::vector<bool> vFound;
+            return ReadMany(vKeys, vValues, vFound) == vKeys.size();
+        }
+
+
         /** Index
          *
          *  Indexes a key into memory.
@@ -732,6 +1032,22 @@ namespace LLD
         bool Get(const SectorKey& cKey, std::vector<uint8_t>& vData);
 
 
+        /** GetMany
+         *
+         *  Get a batch of records from cache or from disk. Disk reads are sorted by file and
+         *  offset, and records that sit close together are fetched with a single read.
+         *
+         *  @param[in] vKeys The binary data of the keys to get.
+         *  @param[in] vSkip Flags for keys that are already resolved and should not be read.
+         *  @param[out] vData The binary data of the records, left empty if not found.
+         *
+         *  @return The total records that were read.
+         *
+         **/
+        uint32_t GetMany(const std::vector<std::vector<uint8_t>>& vKeys, const std::vector<bool>& vSkip,
+                         std::vector<std::vector<uint8_t>>& vData);
+
+
         /** Update
          *
          *  Update a record on disk.
@@ -784,6 +1100,31 @@ namespace LLD
         bool Delete(const std::vector<uint8_t>& vKey);
 
 
+        /** Compress
+         *
+         *  Compress a record for disk with LZ4 if it would save space.
+         *
+         *  @param[in] vData The binary data of the record.
+         *  @param[out] vCompressed The compressed record including its header.
+         *
+         *  @return True if the record was compressed, false if it should be written as is.
+         *
+         **/
+        bool Compress(const std::vector<uint8_t>& vData, std::vector<uint8_t>& vCompressed) const;
+
+
+        /** Decompress
+         *
+         *  Decompress a record read from disk in place, leaving uncompressed records untouched.
+         *
+         *  @param[out] vData The binary data of the record.
+         *
+         *  @return True if the record is ready for use, false if it failed to decompress.
+         *
+         **/
+        bool Decompress(std::vector<uint8_t>& vData) const;
+
+
         /** CacheWriter
          *
          *  Flushes periodically data from the cache buffer to disk.
@@ -810,7 +1151,8 @@ namespace LLD
 
         /** TxnCheckpoint
          *
-         *  Write the transaction commitment message.
+         *  Write the transaction commitment message. The checkpoint is appended to the
+         *  journal and made durable by the first database to commit.
          *
          **/
         bool TxnCheckpoint();
@@ -826,7 +1168,8 @@ namespace LLD
 
         /** TxnCommit
          *
-         *  Commit data from transaction object.
+         *  Commit data from transaction object, syncing the journal first if our
+         *  checkpoint wasn't covered by another database's sync already.
          *
          *  @return True, if commit is successful, false otherwise.
          *
@@ -16,7 +16,7 @@ ________________________________________________________________________________
 #define NEXUS_LLD_INCLUDE_ADDRESS_H
 
 #include <LLD/templates/sector.h>
-#include <LLD/cache/binary_lru.h>
+#include <LLD/cache/sharded_lru.h>
 #include <LLD/keychain/hashmap.h>
 
 #include <LLP/include/trust_address.h>
@@ -29,7 +29,7 @@ namespace LLD
      *  The database class for peer addresses to determine trust relationships.
      *
      **/
-    class AddressDB : public SectorDatabase<BinaryHashMap, BinaryLRU>
+    class AddressDB : public SectorDatabase<BinaryHashMap, ShardedLRU>
     {
     public:
 
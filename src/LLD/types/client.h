@@ -18,7 +18,7 @@ ________________________________________________________________________________
 #include <LLC/types/uint1024.h>
 
 #include <LLD/templates/sector.h>
-#include <LLD/cache/binary_lru.h>
+#include <LLD/cache/sharded_lru.h>
 #include <LLD/keychain/hashmap.h>
 
 #include <TAO/Ledger/include/enum.h>
@@ -45,7 +45,7 @@ namespace LLD
    *  Database class for storing local wallet transactions.
    *
    **/
-    class ClientDB : public SectorDatabase<BinaryHashMap, BinaryLRU>
+    class ClientDB : public SectorDatabase<BinaryHashMap, ShardedLRU>
     {
     public:
 
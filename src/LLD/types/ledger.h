@@ -18,7 +18,7 @@ ________________________________________________________________________________
 #include <LLC/types/uint1024.h>
 
 #include <LLD/templates/sector.h>
-#include <LLD/cache/binary_lru.h>
+#include <LLD/cache/sharded_lru.h>
 #include <LLD/keychain/hashmap.h>
 
 #include <TAO/Operation/types/contract.h>
@@ -74,7 +74,7 @@ namespace LLD
      *  The database class for the Ledger Layer.
      *
      **/
-    class LedgerDB : public SectorDatabase<BinaryHashMap, BinaryLRU>
+    class LedgerDB : public SectorDatabase<BinaryHashMap, ShardedLRU>
     {
 
         /** Mutex to lock internall when accessing memory mode. **/
@@ -225,6 +225,21 @@ namespace LLD
         bool ReadTx(const uint512_t& hashTx, TAO::Ledger::Transaction &tx, const uint8_t nFlags = TAO::Ledger::FLAGS::BLOCK);
 
 
+        /** ReadTx
+         *
+         *  Reads a batch of transactions from the ledger DB, coalescing the disk reads.
+         *
+         *  @param[in] vHashes The txids of transactions to read.
+         *  @param[out] vTx The transaction objects read, in the order of the txids.
+         *  @param[in] nFlags The flags to determine memory pool or disk
+         *
+         *  @return True if all of the transactions were successfully read, false otherwise.
+         *
+         **/
+        bool ReadTx(const std::vector<uint512_t>& vHashes, std::vector<TAO::Ledger::Transaction> &vTx,
+                    const uint8_t nFlags = TAO::Ledger::FLAGS::BLOCK);
+
+
         /** ReadTx
          *
          *  Reads a transaction from the ledger DB and casts it to an API::Transaction type.
@@ -763,15 +778,15 @@ namespace LLD
 
         /** ReadBlock
          *
-         *  Reads a block state object from disk for an atomic object.
+         *  Reads a block state object from disk and publishes it to a snapshot.
          *
          *  @param[in] hashBlock The block hash to read.
-         *  @param[out] atomicState The block state object to read in atomic form.
+         *  @param[out] atomicState The snapshot to publish the block state to.
          *
          *  @return True if the read was successful, false otherwise.
          *
          **/
-        bool ReadBlock(const uint1024_t& hashBlock, memory::atomic<TAO::Ledger::BlockState> &atomicState);
+        bool ReadBlock(const uint1024_t& hashBlock, memory::snapshot<TAO::Ledger::BlockState> &atomicState);
 
 
         /** HasBlock
@@ -18,7 +18,7 @@ ________________________________________________________________________________
 #include <LLC/types/uint1024.h>
 
 #include <LLD/templates/sector.h>
-#include <LLD/cache/binary_lru.h>
+#include <LLD/cache/sharded_lru.h>
 #include <LLD/keychain/hashmap.h>
 
 #include <Legacy/types/transaction.h>
@@ -33,7 +33,7 @@ namespace LLD
      *  Database class for storing legacy transactions.
      *
      **/
-    class LegacyDB : public SectorDatabase<BinaryHashMap, BinaryLRU>
+    class LegacyDB : public SectorDatabase<BinaryHashMap, ShardedLRU>
     {
     public:
 
@@ -16,7 +16,7 @@ ________________________________________________________________________________
 #include <LLC/types/uint1024.h>
 
 #include <LLD/templates/sector.h>
-#include <LLD/cache/binary_lru.h>
+#include <LLD/cache/sharded_lru.h>
 #include <LLD/keychain/hashmap.h>
 
 namespace TAO::API       { class Transaction; }
@@ -30,7 +30,7 @@ namespace LLD
     *  Database class for storing local wallet transactions.
     *
     **/
-    class LogicalDB : public SectorDatabase<BinaryHashMap, BinaryLRU>
+    class LogicalDB : public SectorDatabase<BinaryHashMap, ShardedLRU>
     {
     public:
 
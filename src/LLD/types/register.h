@@ -18,7 +18,7 @@ ________________________________________________________________________________
 #include <LLC/types/uint1024.h>
 
 #include <LLD/templates/sector.h>
-#include <LLD/cache/binary_lru.h>
+#include <LLD/cache/sharded_lru.h>
 #include <LLD/keychain/hashmap.h>
 
 #include <TAO/Register/types/object.h>
@@ -57,13 +57,17 @@ namespace LLD
      *  The database class for the Register Layer.
      *
      **/
-    class RegisterDB : public SectorDatabase<BinaryHashMap, BinaryLRU>
+    class RegisterDB : public SectorDatabase<BinaryHashMap, ShardedLRU>
     {
 
         /** Memory mutex to lock when accessing internal memory states. **/
         std::mutex MEMORY;
 
 
+        /** Types mutex to lock when updating the type index. **/
+        std::mutex TYPES;
+
+
         /** Register transaction to track current open transaction. **/
         RegisterTransaction* pMemory;
 
@@ -128,6 +132,20 @@ namespace LLD
         bool ReadState(const uint256_t& hashRegister, TAO::Register::State& state, const uint8_t nFlags = TAO::Ledger::FLAGS::BLOCK);
 
 
+        /** ReadState
+         *
+         *  Read a batch of state registers from the register database, coalescing the disk reads.
+         *
+         *  @param[in] vRegisters The register addresses.
+         *  @param[out] vStates The state registers read, in the order of the addresses.
+         *
+         *  @return True if all of the registers were read, false otherwise.
+         *
+         **/
+        bool ReadState(const std::vector<uint256_t>& vRegisters, std::vector<TAO::Register::State>& vStates,
+                       const uint8_t nFlags = TAO::Ledger::FLAGS::BLOCK);
+
+
         /** EraseState
          *
          *  Erase a state register from the register database.
@@ -241,6 +259,57 @@ namespace LLD
         void IndexAddress();
 
 
+        /** IndexTypes
+         *
+         *  Build the type index for registers written before it was maintained, so listing by standard doesn't need
+         *  to scan the whole database.
+         *
+         **/
+        void IndexTypes();
+
+
+        /** HasTypes
+         *
+         *  Check that the type index has been built, so it holds every register on disk.
+         *
+         *  @return true if the type index can be used for listing.
+         *
+         **/
+        bool HasTypes();
+
+
+        /** ListTypes
+         *
+         *  List the addresses of registers of a standard from the type index, reading a page from a cursor. Addresses
+         *  are kept in the order they were indexed, except that erasing a register moves the last address into its
+         *  place, so a cursor held across blocks may see a moved address twice or not at all.
+         *
+         *  @param[in] strType The standard of the registers, as used for sequential keys.
+         *  @param[in] hashOwner The owner of the registers, zero to list registers of every owner.
+         *  @param[out] vRegisters The addresses read.
+         *  @param[in,out] nCursor The position to read from, moved past the addresses read.
+         *  @param[in] nLimit The most addresses to read.
+         *
+         *  @return true if a page was read, which may be empty, false once the cursor is at the end of the list.
+         *
+         **/
+        bool ListTypes(const std::string& strType, const uint256_t& hashOwner, std::vector<uint256_t> &vRegisters,
+                       uint32_t &nCursor, const uint32_t nLimit = 1000);
+
+
+        /** CountTypes
+         *
+         *  Count the registers of a standard in the type index.
+         *
+         *  @param[in] strType The standard of the registers, as used for sequential keys.
+         *  @param[in] hashOwner The owner of the registers, zero to count registers of every owner.
+         *
+         *  @return the number of registers indexed.
+         *
+         **/
+        uint32_t CountTypes(const std::string& strType, const uint256_t& hashOwner = 0);
+
+
         /** MemoryBegin
          *
          *  Begin a memory transaction following ACID properties.
@@ -291,6 +360,72 @@ namespace LLD
          **/
         std::string get_address_type(const uint256_t& hashAddress);
 
+
+        /** index_type
+         *
+         *  Add a register to the type index, or move it to the list of its new owner.
+         *
+         *  @param[in] hashRegister The register address.
+         *  @param[in] state The state register being written.
+         *
+         *  @return true if the index was updated.
+         *
+         **/
+        bool index_type(const uint256_t& hashRegister, const TAO::Register::State& state);
+
+
+        /** erase_type
+         *
+         *  Remove a register from the type index.
+         *
+         *  @param[in] hashRegister The register address.
+         *
+         *  @return true if the index was updated.
+         *
+         **/
+        bool erase_type(const uint256_t& hashRegister);
+
+
+        /** stale_types
+         *
+         *  Mark the type index as stale after a failed update, so listing falls back to a scan until the index is
+         *  rebuilt on the next startup.
+         *
+         *  @param[in] hashRegister The register that failed to update.
+         *
+         **/
+        void stale_types(const uint256_t& hashRegister);
+
+
+        /** push_type
+         *
+         *  Append a register to the end of a list of the type index.
+         *
+         *  @param[in] strList The list to append to, either all registers or registers by owner.
+         *  @param[in] strType The standard of the register.
+         *  @param[in] hashOwner The owner the list is for, zero for the list of all registers.
+         *  @param[in] hashRegister The register address.
+         *
+         *  @return true if the register was appended.
+         *
+         **/
+        bool push_type(const std::string& strList, const std::string& strType,
+                       const uint256_t& hashOwner, const uint256_t& hashRegister);
+
+
+        /** pop_type
+         *
+         *  Remove a register from a list of the type index, moving the last register of the list into its place.
+         *
+         *  @param[in] strList The list to remove from, either all registers or registers by owner.
+         *  @param[in] strType The standard of the register.
+         *  @param[in] hashRegister The register address.
+         *
+         *  @return true if the register was removed or wasn't in the list.
+         *
+         **/
+        bool pop_type(const std::string& strList, const std::string& strType, const uint256_t& hashRegister);
+
     };
 
 }
@@ -0,0 +1,129 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+
+#include <LLC/types/uint1024.h>
+
+#include <TAO/Ledger/types/syncblock.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace LLD
+{
+
+   /** SyncReader
+    *
+    *  Streams the main chain forward out of the ledger database as sync blocks, for nodes that are syncing from us.
+    *
+    *  A background thread walks the block states in disk order and reads their transactions in batches, keeping
+    *  a bounded queue of finished blocks ahead of the connection that sends them. A reader lives across the list
+    *  requests of a connection, so the next list usually starts from blocks that were already read.
+    *
+    **/
+    class SyncReader
+    {
+        /** Mutex protecting the queue of blocks. **/
+        std::mutex MUTEX;
+
+
+        /** Condition to wake the reader or the connection waiting on the queue. **/
+        std::condition_variable CONDITION;
+
+
+        /** The blocks read ahead, with their hashes. **/
+        std::deque<std::pair<uint1024_t, TAO::Ledger::SyncBlock>> queueBlocks;
+
+
+        /** The last blocks handed out, kept so a list can start again from them. **/
+        std::deque<std::pair<uint1024_t, TAO::Ledger::SyncBlock>> queueHistory;
+
+
+        /** The number of transaction bytes in the queue. **/
+        uint64_t nQueueBytes;
+
+
+        /** Timestamp of the last block handed out. **/
+        uint64_t nLastAccess;
+
+
+        /** Flag to tell the reader thread to stop. **/
+        std::atomic<bool> fStop;
+
+
+        /** Flag set once the reader thread has no more blocks to add. **/
+        std::atomic<bool> fDone;
+
+
+        /** Flag set if the reader thread stopped before the end of the chain. **/
+        std::atomic<bool> fIdle;
+
+
+        /** The reader thread. **/
+        std::thread THREAD;
+
+
+    public:
+
+        /** Constructor, starting to read from the given block.
+         *
+         *  @param[in] hashStart The first block to stream.
+         *
+         **/
+        SyncReader(const uint1024_t& hashStart);
+
+
+        /** Default Destructor, stopping the reader thread. **/
+        ~SyncReader();
+
+
+        /** Seek
+         *
+         *  Check if the reader can continue from a block, moving back to it if it was just handed out.
+         *
+         *  @param[in] hashStart The block the next list starts from.
+         *
+         *  @return true if the next block handed out will be the one given.
+         *
+         **/
+        bool Seek(const uint1024_t& hashStart);
+
+
+        /** Next
+         *
+         *  Get the next block of the main chain, waiting for the reader thread if it is behind.
+         *
+         *  @param[out] block The sync block with its transactions.
+         *  @param[out] hashBlock The hash of the block.
+         *
+         *  @return false once the end of the chain is reached.
+         *
+         **/
+        bool Next(TAO::Ledger::SyncBlock &block, uint1024_t &hashBlock);
+
+
+    private:
+
+        /** Thread walking the chain and reading the blocks. **/
+        void Prefetch(const uint1024_t hashStart);
+
+
+        /** Add a block to the queue, waiting for space. **/
+        bool push(const uint1024_t& hashBlock, TAO::Ledger::SyncBlock&& block);
+
+    };
+}
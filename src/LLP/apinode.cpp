@@ -11,6 +11,7 @@
 
 ____________________________________________________________________________________________*/
 
+#include <LLP/include/command_pool.h>
 #include <LLP/include/global.h>
 
 #include <LLP/types/apinode.h>
@@ -134,12 +135,87 @@ namespace LLP
             return false;
         }
 
+        /* Answer CORS preflight requests without running a command. */
+        if(INCOMING.strType == "OPTIONS")
+        {
+            /* Build packet. */
+            HTTPPacket RESPONSE(204);
+            if(INCOMING.mapHeaders.count("origin"))
+                RESPONSE.mapHeaders["Access-Control-Allow-Origin"] = INCOMING.mapHeaders["origin"];;
+
+            /* Check for access methods. */
+            if(INCOMING.mapHeaders.count("access-control-request-method"))
+                RESPONSE.mapHeaders["Access-Control-Allow-Methods"] = "POST, GET, OPTIONS";
+
+            /* Check for access headers. */
+            if(INCOMING.mapHeaders.count("access-control-request-headers"))
+                RESPONSE.mapHeaders["Access-Control-Allow-Headers"] = INCOMING.mapHeaders["access-control-request-headers"];
+
+            /* Set conneciton headers. */
+            RESPONSE.mapHeaders["Connection"]             = "keep-alive";
+            RESPONSE.mapHeaders["Access-Control-Max-Age"] = "86400";
+            //RESPONSE.mapHeaders["Content-Length"]         = "0";
+            RESPONSE.mapHeaders["Accept"]                 = "*/*";
+
+            /* Add content, behind the responses still pending. */
+            return Respond(shared_from_this(), RESPONSE);
+        }
+
+
+        /* Run the command on the command pool so this data thread can go on serving other connections. */
+        CommandPool& pool = CommandPool::Get();
+        if(pool.Running())
+        {
+            /* The data thread reads the next request into INCOMING, so the command gets its own copy. */
+            std::shared_ptr<APINode> pNode = shared_from_this();
+            const std::string strAddress   = this->addr.ToString();
+
+            /* Get the endpoint without the leading slash or the query string. */
+            const std::string strEndpoint = INCOMING.strRequest.substr(1, INCOMING.strRequest.find('?') - 1);
+
+            ++nPending;
+            const bool fQueued = pool.Submit(this, strEndpoint, [pNode, REQUEST = INCOMING, strAddress]() mutable
+            {
+                /* Skip commands of clients that went away while they were waiting. */
+                if(pNode->Connected())
+                {
+                    /* Reset this thread's errors for the new command. */
+                    debug::GetLastError();
+
+                    /* Write the response into the send buffer of the connection. */
+                    pNode->WritePacket(pNode->Execute(REQUEST, strAddress));
+                }
+
+                --pNode->nPending;
+            });
+
+            /* Tell the client to come back later when the queues are full. */
+            if(!fQueued)
+            {
+                --nPending;
+                return Respond(pNode, HTTPPacket(503));
+            }
+
+            return true;
+        }
+
+        /* Write the response */
+        this->WritePacket(Execute(INCOMING, this->addr.ToString()));
+
+        return true; //XXX: assess if we can return false here, if my memory serves we had issues here a couple years ago
+        //because if we disconnect immediately, we break the pipe. We need to wait for buffer to clear before disconnect
+    }
+
+
+    /* Execute the command of a request and build its response. */
+    HTTPPacket APINode::Execute(HTTPPacket& REQUEST, const std::string& strAddress)
+    {
         /* Parse the packet request. */
-        const std::string::size_type nPos = INCOMING.strRequest.find('/', 1);
+        const std::string::size_type nPos = REQUEST.strRequest.find('/', 1);
 
         /* Extract the API requested. */
-        std::string strCommands = INCOMING.strRequest.substr(1, nPos - 1);
-        std::string strMethod   = INCOMING.strRequest.substr(nPos + 1);
+        std::string strCommands = REQUEST.strRequest.substr(1, nPos - 1);
+        std::string strMethod   = REQUEST.strRequest.substr(nPos + 1);
 
         /* The JSON response */
         encoding::json jRet;
@@ -156,34 +232,34 @@ namespace LLP
         try
         {
             /* Handle for the POST call. */
-            if(INCOMING.strType == "POST")
+            if(REQUEST.strType == "POST")
             {
                 /* Only parse content if some has been provided */
-                if(!INCOMING.strContent.empty())
+                if(!REQUEST.strContent.empty())
                 {
                     /* Handle different content types. */
-                    if(!INCOMING.mapHeaders.count("content-type"))
+                    if(!REQUEST.mapHeaders.count("content-type"))
                         throw TAO::API::Exception(-5, "content-type [null or misisng] not supported");
 
                     /* Form encoding. */
-                    if(INCOMING.mapHeaders["content-type"] == "application/x-www-form-urlencoded")
+                    if(REQUEST.mapHeaders["content-type"] == "application/x-www-form-urlencoded")
                     {
                         /* Decode if url-form-encoded. */
-                        INCOMING.strContent = encoding::urldecode(INCOMING.strContent);
+                        REQUEST.strContent = encoding::urldecode(REQUEST.strContent);
 
                         /* Split by delimiter. */
                         std::vector<std::string> vParams;
-                        ParseString(INCOMING.strContent, '&', vParams);
+                        ParseString(REQUEST.strContent, '&', vParams);
 
                         /* Grab our parameters. */
                         jParams = TAO::API::ParamsToJSON(vParams);
                     }
 
                     /* JSON encoding. */
-                    else if(INCOMING.mapHeaders["content-type"] == "application/json")
+                    else if(REQUEST.mapHeaders["content-type"] == "application/json")
                     {
                         /* Parse JSON like normal. */
-                        jParams = encoding::json::parse(INCOMING.strContent);
+                        jParams = encoding::json::parse(REQUEST.strContent);
 
                         /* Loop through all params and process the variables. */
                         for(auto jItem = jParams.begin(); jItem != jParams.end(); ++jItem)
@@ -195,10 +271,10 @@ namespace LLP
 
                     }
                     else
-                        throw TAO::API::Exception(-5, "content-type [", INCOMING.mapHeaders["content-type"], "] not supported");
+                        throw TAO::API::Exception(-5, "content-type [", REQUEST.mapHeaders["content-type"], "] not supported");
                 }
             }
-            else if(INCOMING.strType == "GET")
+            else if(REQUEST.strType == "GET")
             {
                 /* Detect if it is url form encoding. */
                 const auto nPos = strMethod.find("?");
@@ -215,32 +291,6 @@ namespace LLP
                     jParams = TAO::API::ParamsToJSON(vParams);
                 }
             }
-            else if(INCOMING.strType == "OPTIONS")
-            {
-                /* Build packet. */
-                HTTPPacket RESPONSE(204);
-                if(INCOMING.mapHeaders.count("origin"))
-                    RESPONSE.mapHeaders["Access-Control-Allow-Origin"] = INCOMING.mapHeaders["origin"];;
-
-                /* Check for access methods. */
-                if(INCOMING.mapHeaders.count("access-control-request-method"))
-                    RESPONSE.mapHeaders["Access-Control-Allow-Methods"] = "POST, GET, OPTIONS";
-
-                /* Check for access headers. */
-                if(INCOMING.mapHeaders.count("access-control-request-headers"))
-                    RESPONSE.mapHeaders["Access-Control-Allow-Headers"] = INCOMING.mapHeaders["access-control-request-headers"];
-
-                /* Set conneciton headers. */
-                RESPONSE.mapHeaders["Connection"]             = "keep-alive";
-                RESPONSE.mapHeaders["Access-Control-Max-Age"] = "86400";
-                //RESPONSE.mapHeaders["Content-Length"]         = "0";
-                RESPONSE.mapHeaders["Accept"]                 = "*/*";
-
-                /* Add content. */
-                this->WritePacket(RESPONSE);
-
-                return true;
-            }
 
             /* Handle the HTTP body argument. */
             if(config::GetBoolArg("-httpbody", false))
@@ -269,8 +319,8 @@ namespace LLP
             encoding::json jError = e.ToJSON();
 
             /* Check to see if the caller has specified an error code to use for general API errors */
-            if(INCOMING.mapHeaders.count("api-error-code"))
-                nStatus = std::stoi(INCOMING.mapHeaders["api-error-code"]);
+            if(REQUEST.mapHeaders.count("api-error-code"))
+                nStatus = std::stoi(REQUEST.mapHeaders["api-error-code"]);
             else
                 /* Default error status code is 400. */
                 nStatus = 400;
@@ -314,11 +364,11 @@ namespace LLP
         HTTPPacket RESPONSE(nStatus);
 
         /* Add the origin header if supplied in the request */
-        if(INCOMING.mapHeaders.count("origin"))
-            RESPONSE.mapHeaders["Access-Control-Allow-Origin"] = INCOMING.mapHeaders["origin"];
+        if(REQUEST.mapHeaders.count("origin"))
+            RESPONSE.mapHeaders["Access-Control-Allow-Origin"] = REQUEST.mapHeaders["origin"];
 
         /* Add the connection header */
-        if(INCOMING.mapHeaders.count("connection") && INCOMING.mapHeaders["connection"] == "keep-alive")
+        if(REQUEST.mapHeaders.count("connection") && REQUEST.mapHeaders["connection"] == "keep-alive")
             RESPONSE.mapHeaders["Connection"] = "keep-alive";
         else
             RESPONSE.mapHeaders["Connection"] = "close";
@@ -332,7 +382,7 @@ namespace LLP
         {
             {"method",    strCommands + "/" + strMethod                      },
             {"status",    TAO::API::Commands::Status(strCommands, strMethod) },
-            {"address",   this->addr.ToString()                              },
+            {"address",   strAddress                                         },
             {"latency",   debug::safe_printstr(std::fixed, nLatency, " ms")  }
         };
 
@@ -343,14 +393,12 @@ namespace LLP
         /* Add content. */
         RESPONSE.strContent = jRet.dump();
 
-        /* Write the response */
-        this->WritePacket(RESPONSE);
-
-        return true; //XXX: assess if we can return false here, if my memory serves we had issues here a couple years ago
-        //because if we disconnect immediately, we break the pipe. We need to wait for buffer to clear before disconnect
+        return RESPONSE;
     }
 
 
+
+
     bool APINode::Authorized(std::map<std::string, std::string>& mapHeaders)
     {
         /* Make a local cache of our authorization header. */
@@ -242,23 +242,11 @@ namespace LLP
     template <class PacketType>
     void BaseConnection<PacketType>::WritePacket(const PacketType& PACKET, bool fPriority)
     {
-        /* Per-connection buffer limit — mining connections return a larger value
-         * (15 MB) so push notifications are never dropped due to buffer pressure.
-         * Virtual dispatch; no mutex, minimal overhead on the hot path. */
-        const uint64_t nMaxSendBuffer = GetMaxSendBuffer();
-
         /* Get the bytes of the packet. */
         const std::vector<uint8_t> vBytes = PACKET.GetBytes();
 
-        /* Reserve space for critical control messages (keepalive ACK, session
-         * status, round state).  Proportional to buffer size: 1% of max,
-         * minimum 1 KB.  For 3 MB P2P: ~30 KB.  For 15 MB mining: ~150 KB.
-         * The old hardcoded 1 KB was meaningless for large mining buffers. */
-        const uint64_t nReserve = std::max(uint64_t(1024), nMaxSendBuffer / 100);
-
         /* Stop sending packets if send buffer is full. */
-        if(Buffered() + vBytes.size() + nReserve < nMaxSendBuffer
-        || (fBufferFull.load() && Buffered() + vBytes.size() < nMaxSendBuffer)) //catch for critical messages (< reserve)
+        if(admit(vBytes.size()))
         {
             /* Debug dump of message type. */
             debug::log(4, NODE, "sent packet (", vBytes.size(), " bytes)");
@@ -273,25 +261,32 @@ namespace LLP
             /* Update packet count. */
             ++PACKETS;
         }
-        else
+
+        /* Notify condition if available. */
+        if(FLUSH_CONDITION && Buffered())
+            FLUSH_CONDITION->notify_all();
+    }
+
+
+    /*  Write an encoded frame shared with other connections to the TCP stream. */
+    template <class PacketType>
+    void BaseConnection<PacketType>::WriteFrame(const std::shared_ptr<const std::vector<uint8_t>>& pFrame)
+    {
+        /* Stop sending packets if send buffer is full. */
+        if(admit(pFrame->size()))
         {
-            /* For authenticated mining connections, packet drops are critical — push
-             * notifications are the primary mechanism for delivering fresh work.
-             * Log at level 0 so operators can see buffer pressure issues.
-             * For P2P connections, keep the existing level 4 to avoid log spam. */
-            if(IsTimeoutExempt())
-            {
-                debug::log(0, NODE, "WARNING: Socket buffer full — packet DROPPED for authenticated miner."
-                    " Packet size: ", vBytes.size(), " bytes.  Buffered: ", Buffered(),
-                    " bytes.  MaxSendBuffer: ", nMaxSendBuffer, " bytes");
-            }
-            else
-            {
-                debug::log(4, NODE, "Socket buffer full. Packet size: ", vBytes.size(), " bytes.  Buffered: ", Buffered(), " bytes");
-            }
+            /* Debug dump of message type. */
+            debug::log(4, NODE, "sent shared packet (", pFrame->size(), " bytes)");
+
+            /* Debug dump of packet data. */
+            if(config::nVerbose >= 5)
+                PrintHex(*pFrame);
 
-            /* set buffer to full */
-            fBufferFull.store(true);
+            /* Queue a reference to the frame rather than a copy. */
+            WriteShared(pFrame);
+
+            /* Update packet count. */
+            ++PACKETS;
         }
 
         /* Notify condition if available. */
@@ -300,6 +295,48 @@ namespace LLP
     }
 
 
+    /*  Check if the send buffer has room for a packet, flagging the buffer as full if not. */
+    template <class PacketType>
+    bool BaseConnection<PacketType>::admit(const uint64_t nBytes)
+    {
+        /* Per-connection buffer limit — mining connections return a larger value
+         * (15 MB) so push notifications are never dropped due to buffer pressure.
+         * Virtual dispatch; no mutex, minimal overhead on the hot path. */
+        const uint64_t nMaxSendBuffer = GetMaxSendBuffer();
+
+        /* Reserve space for critical control messages (keepalive ACK, session
+         * status, round state).  Proportional to buffer size: 1% of max,
+         * minimum 1 KB.  For 3 MB P2P: ~30 KB.  For 15 MB mining: ~150 KB.
+         * The old hardcoded 1 KB was meaningless for large mining buffers. */
+        const uint64_t nReserve = std::max(uint64_t(1024), nMaxSendBuffer / 100);
+
+        /* Check for room, with a catch for critical messages (< reserve). */
+        if(Buffered() + nBytes + nReserve < nMaxSendBuffer
+        || (fBufferFull.load() && Buffered() + nBytes < nMaxSendBuffer))
+            return true;
+
+        /* For authenticated mining connections, packet drops are critical — push
+         * notifications are the primary mechanism for delivering fresh work.
+         * Log at level 0 so operators can see buffer pressure issues.
+         * For P2P connections, keep the existing level 4 to avoid log spam. */
+        if(IsTimeoutExempt())
+        {
+            debug::log(0, NODE, "WARNING: Socket buffer full — packet DROPPED for authenticated miner."
+                " Packet size: ", nBytes, " bytes.  Buffered: ", Buffered(),
+                " bytes.  MaxSendBuffer: ", nMaxSendBuffer, " bytes");
+        }
+        else
+        {
+            debug::log(4, NODE, "Socket buffer full. Packet size: ", nBytes, " bytes.  Buffered: ", Buffered(), " bytes");
+        }
+
+        /* set buffer to full */
+        fBufferFull.store(true);
+
+        return false;
+    }
+
+
     /*  Connect Socket to a Remote Endpoint. */
     template <class PacketType>
     bool BaseConnection<PacketType>::Connect(const BaseAddress &addrConnect)
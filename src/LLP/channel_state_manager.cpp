@@ -82,7 +82,8 @@ namespace LLP
     bool ChannelStateManager::SyncWithBlockchain()
     {
         /* Get current best block state atomically */
-        TAO::Ledger::BlockState tStateBest = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& tStateBest = *pStateBest;
         
         /* Get current unified height */
         uint32_t nCurrentUnified = tStateBest.nHeight;
@@ -159,7 +160,8 @@ namespace LLP
             return false;
         
         /* Get current best block for unified height */
-        TAO::Ledger::BlockState tStateBest = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& tStateBest = *pStateBest;
         
         /* VALIDATION 1: Check unified height (Block::Accept logic)
          * Template should be for next block:
@@ -240,7 +242,8 @@ namespace LLP
         HeightInfo info;
         
         /* Get current best block */
-        TAO::Ledger::BlockState tStateBest = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& tStateBest = *pStateBest;
         
         /* Fill in height information with mutex protection for cache access */
         uint32_t nCachedChannelHeight;
@@ -442,7 +445,8 @@ namespace LLP
         nHash = GetHashManager().GetChannelHeight();
         
         /* Get unified height from blockchain state (all managers see same unified height) */
-        TAO::Ledger::BlockState tStateBest = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& tStateBest = *pStateBest;
         nUnified = tStateBest.nHeight;
         
         return true;
@@ -453,7 +457,8 @@ namespace LLP
     bool ChannelStateManager::VerifyAllChannels(uint32_t nCheckInterval)
     {
         /* Get current unified height for interval check */
-        TAO::Ledger::BlockState tStateBest = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& tStateBest = *pStateBest;
         uint32_t nUnifiedHeight = tStateBest.nHeight;
         
         /* Skip during initial sync */
@@ -599,7 +604,8 @@ namespace LLP
     uint32_t ChannelStateManager::FindOrphanedBlocks(uint32_t nMaxDepth)
     {
         /* Get current best block */
-        TAO::Ledger::BlockState tStateBest = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& tStateBest = *pStateBest;
         uint32_t nCurrentHeight = tStateBest.nHeight;
         
         /* Limit scan depth */
@@ -0,0 +1,284 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLP/include/command_pool.h>
+
+#include <Util/include/args.h>
+#include <Util/include/debug.h>
+#include <Util/include/mutex.h>
+
+namespace LLP
+{
+    /* The number of endpoints tracked before the rest are counted together, as clients choose the names. */
+    const uint32_t MAX_ENDPOINTS = 256;
+
+
+    /* Default Constructor. */
+    CommandPool::CommandPool()
+    : MUTEX        ( )
+    , CONDITION    ( )
+    , mapClients   ( )
+    , queueReady   ( )
+    , mapEndpoints ( )
+    , nQueued      (0)
+    , nMaxQueued   (0)
+    , nMaxClient   (0)
+    , fRunning     (false)
+    , vWorkers     ( )
+    {
+    }
+
+
+    /* Get the pool instance. */
+    CommandPool& CommandPool::Get()
+    {
+        static CommandPool POOL;
+        return POOL;
+    }
+
+
+    /* Start the worker threads. */
+    void CommandPool::Start()
+    {
+        const uint32_t nThreads = config::GetArg("-apiworkers", 4);
+        if(nThreads == 0 || fRunning.load())
+            return;
+
+        {
+            LOCK(MUTEX);
+
+            nMaxQueued = std::max(1u, static_cast<uint32_t>(config::GetArg("-apiqueue", 1024)));
+            nMaxClient = std::max(1u, static_cast<uint32_t>(config::GetArg("-apiclientqueue", 16)));
+        }
+
+        fRunning.store(true);
+        for(uint32_t n = 0; n < nThreads; ++n)
+            vWorkers.push_back(std::thread(&CommandPool::Worker, this));
+
+        debug::log(0, FUNCTION, "Started ", nThreads, " command workers");
+    }
+
+
+    /* Stop the worker threads once their current commands finish. */
+    void CommandPool::Shutdown()
+    {
+        {
+            LOCK(MUTEX);
+            fRunning.store(false);
+        }
+        CONDITION.notify_all();
+
+        for(auto& tWorker : vWorkers)
+            if(tWorker.joinable())
+                tWorker.join();
+
+        vWorkers.clear();
+
+        /* Drop the commands that didn't get to run, releasing their connections. */
+        LOCK(MUTEX);
+        mapClients.clear();
+        queueReady.clear();
+        nQueued = 0;
+    }
+
+
+    /* Check if commands should be submitted to the pool rather than run inline. */
+    bool CommandPool::Running() const
+    {
+        return fRunning.load();
+    }
+
+
+    /* Queue a command for a connection. */
+    bool CommandPool::Submit(const void* pClient, const std::string& strEndpoint, std::function<void()>&& fnExecute)
+    {
+        LOCK(MUTEX);
+
+        if(!fRunning.load())
+            return false;
+
+        /* Count endpoints we don't have room for together. */
+        const std::string strName =
+            (mapEndpoints.size() < MAX_ENDPOINTS || mapEndpoints.count(strEndpoint)) ? strEndpoint : "other";
+
+        Endpoint& endpoint = mapEndpoints[strName];
+
+        /* Turn the command away rather than let the queues grow without bound. */
+        auto it = mapClients.find(pClient);
+        if(nQueued >= nMaxQueued || (it != mapClients.end() && it->second.queueJobs.size() >= nMaxClient))
+        {
+            ++endpoint.nRejected;
+            return false;
+        }
+
+        /* Add the command to the queue of its connection. */
+        queue(pClient, strName, std::move(fnExecute));
+
+        return true;
+    }
+
+
+    /* Queue a response that runs no command behind the commands a connection has waiting. */
+    bool CommandPool::Reply(const void* pClient, std::function<void()>&& fnReply)
+    {
+        LOCK(MUTEX);
+
+        if(!fRunning.load())
+            return false;
+
+        /* A client that keeps sending while being turned away still can't grow its queue without bound. */
+        auto it = mapClients.find(pClient);
+        if(it != mapClients.end() && it->second.queueJobs.size() >= 2 * nMaxClient)
+            return false;
+
+        queue(pClient, "reply", std::move(fnReply));
+
+        return true;
+    }
+
+
+    /* Get the queue depths and latency histograms of the pool and every endpoint. */
+    encoding::json CommandPool::Status() const
+    {
+        LOCK(MUTEX);
+
+        encoding::json jEndpoints = encoding::json::array();
+        for(const auto& rEndpoint : mapEndpoints)
+        {
+            const Endpoint& endpoint = rEndpoint.second;
+
+            /* Build the latency histogram. */
+            encoding::json jLatency = encoding::json::object();
+            for(uint32_t n = 0; n < LATENCY_BUCKETS.size(); ++n)
+                jLatency[debug::safe_printstr("<", LATENCY_BUCKETS[n], "ms")] = endpoint.vLatency[n];
+
+            jLatency[debug::safe_printstr(">=", LATENCY_BUCKETS.back(), "ms")] = endpoint.vLatency.back();
+
+            jEndpoints.push_back(
+            {
+                { "endpoint",  rEndpoint.first     },
+                { "queued",    endpoint.nQueued    },
+                { "completed", endpoint.nCompleted },
+                { "rejected",  endpoint.nRejected  },
+                { "wait",      endpoint.nCompleted > 0 ? double(endpoint.nWaitMS) / endpoint.nCompleted : 0.0 },
+                { "latency",   jLatency            }
+            });
+        }
+
+        return
+        {
+            { "workers",   vWorkers.size() },
+            { "clients",   mapClients.size() },
+            { "queued",    nQueued         },
+            { "maxqueued", nMaxQueued      },
+            { "endpoints", jEndpoints      }
+        };
+    }
+
+
+    /* Add a job to the queue of a connection, giving it a turn if it has none. */
+    void CommandPool::queue(const void* pClient, const std::string& strEndpoint, std::function<void()>&& fnExecute)
+    {
+        Client& client = mapClients[pClient];
+        client.queueJobs.push_back(Job{strEndpoint, std::move(fnExecute), std::chrono::steady_clock::now()});
+
+        ++mapEndpoints[strEndpoint].nQueued;
+        ++nQueued;
+
+        /* A connection with nothing running joins the back of the line for a worker. */
+        if(!client.fRunning && client.queueJobs.size() == 1)
+        {
+            queueReady.push_back(pClient);
+            CONDITION.notify_one();
+        }
+    }
+
+
+    /* Thread executing the commands. */
+    void CommandPool::Worker()
+    {
+        while(true)
+        {
+            const void* pClient = nullptr;
+            Job job;
+
+            /* Take the first command of the connection whose turn it is. */
+            {
+                LOCK(MUTEX);
+                CONDITION.wait(lk, [this]{ return !fRunning.load() || !queueReady.empty(); });
+
+                if(!fRunning.load())
+                    return;
+
+                pClient = queueReady.front();
+                queueReady.pop_front();
+
+                Client& client = mapClients[pClient];
+                job = std::move(client.queueJobs.front());
+                client.queueJobs.pop_front();
+                client.fRunning = true;
+
+                --mapEndpoints[job.strEndpoint].nQueued;
+                --nQueued;
+            }
+
+            const auto tStart = std::chrono::steady_clock::now();
+
+            /* Execute the command, which writes its own response. */
+            try
+            {
+                job.fnExecute();
+            }
+            catch(const std::exception& e)
+            {
+                debug::error(FUNCTION, job.strEndpoint, ": ", e.what());
+            }
+
+            /* Release the connection before taking the lock, the command may hold the last reference to it. */
+            job.fnExecute = nullptr;
+
+            const auto tEnd = std::chrono::steady_clock::now();
+            const uint64_t nWaitMS    = std::chrono::duration_cast<std::chrono::milliseconds>(tStart - job.tQueued).count();
+            const uint64_t nLatencyMS = std::chrono::duration_cast<std::chrono::milliseconds>(tEnd   - job.tQueued).count();
+
+            {
+                LOCK(MUTEX);
+
+                /* Record the latency in its bucket. */
+                Endpoint& endpoint = mapEndpoints[job.strEndpoint];
+                ++endpoint.nCompleted;
+                endpoint.nWaitMS += nWaitMS;
+
+                uint32_t nBucket = 0;
+                while(nBucket < LATENCY_BUCKETS.size() && nLatencyMS >= LATENCY_BUCKETS[nBucket])
+                    ++nBucket;
+
+                ++endpoint.vLatency[nBucket];
+
+                /* Give the connection another turn at the back of the line if it has more waiting. */
+                auto it = mapClients.find(pClient);
+                if(it == mapClients.end())
+                    continue;
+
+                it->second.fRunning = false;
+                if(it->second.queueJobs.empty())
+                    mapClients.erase(it);
+                else
+                {
+                    queueReady.push_back(pClient);
+                    CONDITION.notify_one();
+                }
+            }
+        }
+    }
+}
@@ -19,6 +19,8 @@ ________________________________________________________________________________
 #include <LLP/templates/socket.h>
 
 #include <chrono>
+#include <map>
+#include <memory>
 #include <sstream>
 
 #include <LLP/types/tritium.h>
@@ -152,23 +154,20 @@ namespace LLP
 #endif
     {
 #ifdef __linux__
-        /* Create a dedicated epoll instance for mining DataThreads.
-         * This gives mining I/O complete isolation from the poll()-based
-         * loop used by P2P/API/RPC DataThreads.  epoll_wait() is called
-         * with a 1ms timeout (vs 100ms poll) and only returns fds with
-         * pending events, giving O(ready) instead of O(all) per iteration. */
-        if constexpr (is_mining_data_thread_v<ProtocolType>)
+        /* Create a dedicated epoll instance for this DataThread.  epoll_wait()
+         * only returns fds with pending events, giving O(ready) instead of
+         * O(all) per iteration, which matters for seed nodes with thousands of
+         * mostly idle peers and API clients.  Mining DataThreads additionally
+         * wait with a 1ms timeout (vs 100ms) for isolation from P2P traffic. */
+        m_nEpollFd = ::epoll_create1(EPOLL_CLOEXEC);
+        if(m_nEpollFd < 0)
         {
-            m_nEpollFd = ::epoll_create1(EPOLL_CLOEXEC);
-            if(m_nEpollFd < 0)
-            {
-                const int nSavedErrno = errno;
-                debug::error(FUNCTION, "epoll_create1 failed for mining DataThread ", nID, " errno=", nSavedErrno,
-                             " — falling back to poll()");
-            }
-            else
-                debug::log(1, FUNCTION, "Mining DataThread ", nID, " using epoll fd=", m_nEpollFd);
+            const int nSavedErrno = errno;
+            debug::error(FUNCTION, "epoll_create1 failed for ", ProtocolType::Name(), " DataThread ", nID, " errno=", nSavedErrno,
+                         " — falling back to poll()");
         }
+        else
+            debug::log(1, FUNCTION, ProtocolType::Name(), " DataThread ", nID, " using epoll fd=", m_nEpollFd);
 #endif
     }
 
@@ -208,7 +207,7 @@ namespace LLP
         join_thread(FLUSH_THREAD, "FLUSH_THREAD");
 
 #ifdef __linux__
-        /* Close the epoll file descriptor for mining DataThreads. */
+        /* Close the epoll file descriptor. */
         if(m_nEpollFd >= 0)
         {
             ::close(m_nEpollFd);
@@ -325,20 +324,17 @@ namespace LLP
     void DataThread<ProtocolType>::Thread()
     {
 #ifdef __linux__
-        /* Mining DataThreads with a valid epoll fd use the dedicated epoll loop.
-         * This provides complete I/O isolation from P2P traffic and O(ready)
-         * instead of O(all-connections) per iteration. */
-        if constexpr (is_mining_data_thread_v<ProtocolType>)
+        /* DataThreads with a valid epoll fd use the epoll loop, which is
+         * O(ready) instead of O(all-connections) per iteration. */
+        if(m_nEpollFd >= 0)
         {
-            if(m_nEpollFd >= 0)
-            {
-                debug::log(1, FUNCTION, "Mining DataThread ", ID, " entering epoll loop (fd=", m_nEpollFd, ")");
-                ThreadEpoll();
-                return;
-            }
-            /* If epoll_create1 failed, fall through to the poll() path as a fallback. */
-            debug::log(1, FUNCTION, "Mining DataThread ", ID, " falling back to poll() (epoll unavailable)");
+            debug::log(1, FUNCTION, ProtocolType::Name(), " DataThread ", ID, " entering epoll loop (fd=", m_nEpollFd, ")");
+            ThreadEpoll();
+            return;
         }
+
+        /* If epoll_create1 failed, fall through to the poll() path as a fallback. */
+        debug::log(1, FUNCTION, ProtocolType::Name(), " DataThread ", ID, " falling back to poll() (epoll unavailable)");
 #endif
 
         /* Cache sleep time if applicable. */
@@ -811,13 +807,19 @@ namespace LLP
                 std::make_pair(typename ProtocolType::message_t(), DataStream(SER_NETWORK, MIN_PROTO_VERSION));
 
             /* Grab data from queue. */
+            bool fRelay = false;
             if(!RELAY->empty())
             {
                 /* Make a copy of the relay data. */
                 qRelay = RELAY->front();
                 RELAY->pop();
+
+                fRelay = true;
             }
 
+            /* Encoded relay frames by filter key, so nodes with the same filter share one frame. */
+            std::map<uint64_t, std::shared_ptr<const std::vector<uint8_t>>> mapFrames;
+
             /* Check all connections for data and packets. */
             uint32_t nSize = CONNECTIONS->size();
             for(uint32_t nIndex = 0; nIndex < nSize; ++nIndex)
@@ -828,9 +830,6 @@ namespace LLP
 
                 try
                 {
-                    /* Reset stream read position. */
-                    qRelay.second.Reset();
-
                     /* Get shared pointer to prevent race condition on the internal connection pointer. */
                     std::shared_ptr<ProtocolType> CONNECTION = CONNECTIONS->at(nIndex);
 
@@ -848,15 +847,38 @@ namespace LLP
                     CONNECTION->DrainOutgoingQueue();
 
                     /* Relay if there are active subscriptions. */
-                    const DataStream ssRelay = CONNECTION->RelayFilter(qRelay.first, qRelay.second);
-                    if(ssRelay.size() != 0)
+                    if(fRelay)
                     {
-                        /* Build the sender packet. */
-                        typename ProtocolType::packet_t PACKET = typename ProtocolType::packet_t(qRelay.first);
-                        PACKET.SetData(ssRelay);
+                        /* Check for a frame already encoded for this filter. */
+                        const uint64_t nKey = CONNECTION->RelayKey();
+
+                        std::shared_ptr<const std::vector<uint8_t>> pFrame;
+                        if(!mapFrames.count(nKey))
+                        {
+                            /* Reset stream read position. */
+                            qRelay.second.Reset();
+
+                            /* Filter and encode the relay, empty if nothing passed the filter. */
+                            const DataStream ssRelay = CONNECTION->RelayFilter(qRelay.first, qRelay.second);
+                            if(ssRelay.size() != 0)
+                            {
+                                /* Build the sender packet. */
+                                typename ProtocolType::packet_t PACKET = typename ProtocolType::packet_t(qRelay.first);
+                                PACKET.SetData(ssRelay);
+
+                                pFrame = std::make_shared<const std::vector<uint8_t>>(PACKET.GetBytes());
+                            }
+
+                            /* Unique filters are never shared. */
+                            if(nKey != RELAY_UNIQUE)
+                                mapFrames[nKey] = pFrame;
+                        }
+                        else
+                            pFrame = mapFrames[nKey];
 
-                        /* Write packet to socket. */
-                        CONNECTION->WritePacket(PACKET);
+                        /* Write frame to socket. */
+                        if(pFrame)
+                            CONNECTION->WriteFrame(pFrame);
                     }
 
                 #ifdef __linux__
@@ -877,6 +899,13 @@ namespace LLP
                     /* Attempt to flush data when buffer is available. */
                     if(CONNECTION->Buffered() && CONNECTION->Flush() < 0)
                         runtime::sleep(std::min(1u, CONNECTION->nConsecutiveErrors.load() / 1000)); //we want to sleep when we have periodic failures
+
+                #ifdef __linux__
+                    /* Other protocols keep flushing here, and arm EPOLLOUT for whatever the socket didn't accept.
+                     * The epoll loop disarms it again once the backlog is drained. */
+                    if(m_nEpollFd >= 0 && CONNECTION->NeedsWriteService())
+                        epoll_sync_write_interest(CONNECTION->fd, nIndex, true);
+                #endif
                 }
                 catch(const std::exception& e)
                 {
@@ -1139,19 +1168,24 @@ namespace LLP
 
 
 #ifdef __linux__
-    /*  Epoll-based I/O loop for mining DataThreads on Linux.
+    /*  Epoll-based I/O loop for DataThreads on Linux.
      *
      *  ARCHITECTURE:
-     *  This loop replaces the generic poll()-based Thread() for mining protocols.
-     *  It provides complete I/O isolation from P2P traffic, ensuring that Tritium
-     *  peers flooding ACTION::GET BLOCK requests cannot starve mining connections.
+     *  This loop replaces the portable poll()-based Thread() on Linux. For mining
+     *  protocols it provides complete I/O isolation from P2P traffic, ensuring that
+     *  Tritium peers flooding ACTION::GET BLOCK requests cannot starve mining
+     *  connections. For every other protocol it removes the O(connections) pollfd
+     *  rebuild and scan from each wakeup.
      *
      *  KEY DIFFERENCES FROM poll() PATH:
-     *  1. Uses epoll_wait() with 1ms timeout (vs 100ms poll) for sub-millisecond response
+     *  1. Mining uses epoll_wait() with 1ms timeout (vs 100ms poll) for sub-millisecond response
      *  2. Processes only connections with pending events — O(ready) not O(all)
-     *  3. Health sweeps (timeouts, DDOS, partial stall) run on a 250ms cadence,
-     *     decoupled from the I/O hot path
+     *  3. Health sweeps (timeouts, DDOS, partial stall) run on a 250ms cadence for
+     *     mining and 100ms for other protocols, decoupled from the I/O hot path
      *  4. All the same health checks as the poll() path are preserved
+     *  5. Connections holding input that epoll can't see (SSL records already
+     *     decrypted, HTTP headers left in the parse buffer) are revisited on the
+     *     next iteration without waiting for socket readiness
      *
      *  THREAD SAFETY:
      *  - epoll_ctl (ADD/DEL) is called from ListeningThread (via AddConnection)
@@ -1162,18 +1196,30 @@ namespace LLP
     template <class ProtocolType>
     void DataThread<ProtocolType>::ThreadEpoll()
     {
+        constexpr bool fMiningProtocol = is_mining_data_thread_v<ProtocolType>;
+
         /* Configurable mining wait timeout — default 1ms.
          * Controls both the epoll_wait timeout (this path) and the poll() timeout
          * (fallback path / non-Linux).  Overridable via -miningwait=<ms>.
          * This is the maximum latency between a miner sending data and the
-         * DataThread processing it. */
-        const int32_t nMiningWaitMs = static_cast<int32_t>(
-            config::GetArg("-miningwait", 1));
+         * DataThread processing it.  Other protocols keep the 100ms poll timeout. */
+        const int32_t nWaitMs = fMiningProtocol
+            ? static_cast<int32_t>(config::GetArg("-miningwait", 1))
+            : static_cast<int32_t>(DEFAULT_POLL_TIMEOUT_MS);
+
+        /* Empty-read window for non-mining protocols, same as the poll() path. */
+        const uint32_t nWait = config::GetArg("-llpwait", 1);
+
+        /* Per-iteration time budget for non-mining protocols, same as the poll() path. */
+        const uint32_t nTimeBudgetMs = static_cast<uint32_t>(
+            config::GetArg("-llptimebudget", static_cast<int64_t>(DEFAULT_LLP_TIME_BUDGET_MS)));
 
         /* Health sweep interval — how often we scan ALL connections for
          * time-based conditions (timeouts, partial stalls, buffer overflow).
-         * 250ms balances responsiveness with CPU efficiency. */
-        constexpr uint32_t HEALTH_SWEEP_INTERVAL_MS = 250;
+         * 250ms balances responsiveness with CPU efficiency for mining; other
+         * protocols sweep at the old poll() timeout so EVENTS::GENERIC keeps
+         * its cadence. */
+        constexpr uint32_t HEALTH_SWEEP_INTERVAL_MS = fMiningProtocol ? 250 : DEFAULT_POLL_TIMEOUT_MS;
 
         /* Maximum epoll events per wait call.  If more fds are ready than
          * this, the excess will be returned on the next epoll_wait — no data
@@ -1191,6 +1237,12 @@ namespace LLP
         /* Epoll event buffer — stack allocated for zero-alloc hot path. */
         struct epoll_event vEvents[MAX_EPOLL_EVENTS];
 
+        /* Events to work on this iteration, and connections to revisit on the next one
+         * because they hold input that won't raise socket readiness again.  Both keep
+         * their capacity between iterations. */
+        std::vector<struct epoll_event> vReady;
+        std::vector<struct epoll_event> vRevisit;
+
         /* The main mining I/O loop. */
         while(!fDestruct.load() && !config::fShutdown.load())
         {
@@ -1224,9 +1276,10 @@ namespace LLP
             }
 
             /* ── EPOLL WAIT ─────────────────────────────────────────────────
-             * Block for at most nMiningWaitMs (default 1ms).
+             * Block for at most nWaitMs (default 1ms mining, 100ms otherwise),
+             * or don't block at all if there are connections to revisit.
              * Returns only fds with pending events — no scanning idle sockets. */
-            const int32_t nReady = ::epoll_wait(m_nEpollFd, vEvents, MAX_EPOLL_EVENTS, nMiningWaitMs);
+            const int32_t nReady = ::epoll_wait(m_nEpollFd, vEvents, MAX_EPOLL_EVENTS, vRevisit.empty() ? nWaitMs : 0);
 
             if(nReady < 0)
             {
@@ -1238,17 +1291,31 @@ namespace LLP
                 continue;
             }
 
+            /* Gather the ready events followed by the connections carried over. */
+            vReady.assign(vEvents, vEvents + nReady);
+            vReady.insert(vReady.end(), vRevisit.begin(), vRevisit.end());
+            vRevisit.clear();
+
+            /* Per-iteration time budget start, see DEFAULT_LLP_TIME_BUDGET_MS. */
+            const auto tLoopStart = std::chrono::steady_clock::now();
+
             /* ── PROCESS READY CONNECTIONS ──────────────────────────────────
              * Only connections with events are visited. This is the core
              * advantage over poll(): with 50 miners but only 2 sending data,
              * we process exactly 2 iterations, not 50. */
-            for(int32_t i = 0; i < nReady; ++i)
+            uint32_t nEvent = 0;
+            for( ; nEvent < vReady.size(); ++nEvent)
             {
+                /* Get a reference of our event. */
+                const struct epoll_event& rEvent = vReady[nEvent];
+
                 /* Break early if shutdown signaled mid-iteration. */
                 if(fDestruct.load() || config::fShutdown.load())
                     break;
 
-                const uint32_t nIndex = vEvents[i].data.u32;
+                /* Unpack the slot and the fd it was registered for. */
+                const uint32_t nIndex = static_cast<uint32_t>(rEvent.data.u64);
+                const uint32_t nFd    = static_cast<uint32_t>(rEvent.data.u64 >> 32);
 
                 /* Bounds check — protects against stale epoll events from
                  * a slot that was removed and the CONNECTIONS vector shrank. */
@@ -1263,15 +1330,19 @@ namespace LLP
                     if(!CONNECTION || !CONNECTION->Connected())
                         continue;
 
+                    /* Skip stale events for a slot that was reused by a new connection. */
+                    if(static_cast<uint32_t>(CONNECTION->fd) != nFd)
+                        continue;
+
                     /* Handle epoll error events. */
-                    if(vEvents[i].events & EPOLLERR)
+                    if(rEvent.events & EPOLLERR)
                     {
                         remove_connection_with_event(nIndex, DISCONNECT::POLL_ERROR);
                         continue;
                     }
 
                     /* Handle peer disconnect. */
-                    if(vEvents[i].events & EPOLLHUP)
+                    if(rEvent.events & EPOLLHUP)
                     {
                         remove_connection_with_event(nIndex, DISCONNECT::PEER);
                         continue;
@@ -1285,7 +1356,7 @@ namespace LLP
                     }
 
                     /* Handle EPOLLIN: data ready to read. */
-                    if(vEvents[i].events & EPOLLIN)
+                    if(rEvent.events & EPOLLIN)
                     {
                         /* POLLIN with Available()==0 check (same as poll path).
                          * Mining connections get the generous 5s window. */
@@ -1298,7 +1369,7 @@ namespace LLP
 
                             if(!fHasPartialPacket
                             && !CONNECTION->IsTimeoutExempt()
-                            && CONNECTION->Timeout(MINING_POLL_EMPTY_TIMEOUT_MS, Socket::READ))
+                            && CONNECTION->Timeout(fMiningProtocol ? MINING_POLL_EMPTY_TIMEOUT_MS : nWait, Socket::READ))
                             {
                                 remove_connection_with_event(nIndex, DISCONNECT::POLL_EMPTY);
                                 continue;
@@ -1344,11 +1415,15 @@ namespace LLP
                             CONNECTION->Event(EVENTS::PROCESSED);
                             CONNECTION->ResetPacket();
                         }
+
+                        /* Decrypted SSL records don't raise readiness again, so come back for them. */
+                        if(CONNECTION->IsSSL() && CONNECTION->Available() > 0)
+                            vRevisit.push_back(rEvent);
                     }
 
                     /* Handle EPOLLOUT: service pending outbound queue/buffer only
                      * when the kernel says the socket can accept more bytes. */
-                    if(vEvents[i].events & EPOLLOUT)
+                    if(rEvent.events & EPOLLOUT)
                     {
                         if(CONNECTION->HasQueuedPackets())
                             CONNECTION->DrainOutgoingQueue();
@@ -1357,7 +1432,29 @@ namespace LLP
                             CONNECTION->Flush();
                     }
 
-                    epoll_sync_write_interest(CONNECTION->fd, nIndex, CONNECTION->NeedsWriteService());
+                    /* Only touch the interest list when EPOLLOUT needs to change. */
+                    const bool fNeedsWriteService = CONNECTION->NeedsWriteService();
+                    if(fNeedsWriteService != static_cast<bool>(rEvent.events & EPOLLOUT))
+                        epoll_sync_write_interest(CONNECTION->fd, nIndex, fNeedsWriteService);
+
+                    /* Time-budget guard, same as the poll() path.  Level-triggered
+                     * events we skip are returned again by the next epoll_wait(),
+                     * the revisits we skip are carried over below. */
+                    if(!fMiningProtocol && nTimeBudgetMs > 0)
+                    {
+                        const uint32_t nElapsedMs = static_cast<uint32_t>(
+                            std::chrono::duration_cast<std::chrono::milliseconds>(
+                                std::chrono::steady_clock::now() - tLoopStart).count());
+
+                        if(nElapsedMs >= nTimeBudgetMs)
+                        {
+                            debug::log(3, FUNCTION, "DataThread[", ID,
+                                "]: time budget exceeded (", nElapsedMs, "ms >= ",
+                                nTimeBudgetMs, "ms) after connection ", nIndex,
+                                " — re-entering epoll_wait()");
+                            break;
+                        }
+                    }
                 }
                 catch(const std::exception& e)
                 {
@@ -1393,6 +1490,10 @@ namespace LLP
                 }
             }
 
+            /* Carry over the revisits a time-budget break skipped, their input was already read off the socket. */
+            for(uint32_t n = std::max(nEvent + 1, static_cast<uint32_t>(nReady)); n < vReady.size(); ++n)
+                vRevisit.push_back(vReady[n]);
+
             /* ── PERIODIC HEALTH SWEEP ─────────────────────────────────────
              * Every HEALTH_SWEEP_INTERVAL_MS, scan ALL connections for
              * time-based conditions that epoll events cannot detect:
@@ -1425,7 +1526,19 @@ namespace LLP
 
                         /* Shared health checks: read-idle timeout, write stall,
                          * buffer overflow, partial-packet stall, EVENTS::GENERIC. */
-                        check_connection_health(nIndex, CONNECTION);
+                        if(check_connection_health(nIndex, CONNECTION))
+                            continue;
+
+                        /* Partial packets of other protocols may be parseable from input already
+                         * read off the socket (e.g. HTTP header lines), revisit them as a read. */
+                        if(!fMiningProtocol && !CONNECTION->INCOMING.IsNull() && !CONNECTION->PacketComplete())
+                        {
+                            struct epoll_event ev;
+                            ev.events   = EPOLLIN;
+                            ev.data.u64 = epoll_key(CONNECTION->fd, nIndex);
+
+                            vRevisit.push_back(ev);
+                        }
                     }
                     catch(const std::exception& e)
                     {
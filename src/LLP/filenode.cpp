@@ -29,6 +29,50 @@ ________________________________________________________________________________
 
 namespace LLP
 {
+    /* Parse a single byte range header of the form bytes=first-last, bytes=first- or bytes=-suffix. */
+    static bool ParseRange(const std::string& strRange, const uint64_t nSize, uint64_t &nBegin, uint64_t &nEnd)
+    {
+        /* Check for the byte units, we don't support multiple ranges. */
+        if(strRange.compare(0, 6, "bytes=") != 0 || strRange.find(',') != std::string::npos)
+            return false;
+
+        const std::string strSpec = trim(strRange.substr(6));
+        const auto nDash = strSpec.find('-');
+        if(nDash == std::string::npos || nSize == 0)
+            return false;
+
+        const std::string strFirst = strSpec.substr(0, nDash);
+        const std::string strLast  = strSpec.substr(nDash + 1);
+        if(strFirst.find_first_not_of("0123456789") != std::string::npos || strLast.find_first_not_of("0123456789") != std::string::npos)
+            return false;
+
+        /* Check the positions fit in 64 bits. */
+        if(strFirst.size() > 18 || strLast.size() > 18)
+            return false;
+
+        /* Handle a suffix range for the last bytes of the file. */
+        if(strFirst.empty())
+        {
+            if(strLast.empty())
+                return false;
+
+            const uint64_t nSuffix = static_cast<uint64_t>(std::stoull(strLast));
+            if(nSuffix == 0)
+                return false;
+
+            nBegin = (nSuffix >= nSize ? 0 : nSize - nSuffix);
+            nEnd   = nSize - 1;
+
+            return true;
+        }
+
+        nBegin = static_cast<uint64_t>(std::stoull(strFirst));
+        nEnd   = strLast.empty() ? nSize - 1 : std::min(static_cast<uint64_t>(std::stoull(strLast)), nSize - 1);
+
+        return nBegin <= nEnd;
+    }
+
+
     /** Default Constructor **/
     FileNode::FileNode()
     : HTTPNode()
@@ -147,6 +191,9 @@ namespace LLP
 
         /* Check that the file exists. */
         std::string strContent = "";
+        int64_t nSize = -1;
+        uint64_t nRangeBegin = 0;
+        uint64_t nRangeEnd   = 0;
         if(filesystem::exists(strFile))
         {
             /* Check if this is a directory. */
@@ -161,24 +208,42 @@ namespace LLP
                     std::fstream(strFile, std::ios::in | std::ios::out | std::ios::binary);
 
                 /* Read the binary data and pass back as a string. */
-                const int64_t nSize =
-                    filesystem::size(strFile);
+                nSize = filesystem::size(strFile);
 
                 /* Make sure we have the correct size here. */
                 if(nSize != -1)
                 {
-                    /* Get a vector for our file contents. */
-                    strContent.resize(nSize);
-
-                    /* Read our entire file's contents. */
-                    ssFile.seekg(0, std::ios::beg);
-                    ssFile.read(&strContent[0], nSize);
+                    /* Check for a range request, so large files such as snapshots can be fetched in parts. */
+                    if(INCOMING.mapHeaders.count("range"))
+                    {
+                        /* Read only the bytes asked for. */
+                        if(ParseRange(INCOMING.mapHeaders["range"], nSize, nRangeBegin, nRangeEnd))
+                        {
+                            strContent.resize(nRangeEnd - nRangeBegin + 1);
+
+                            ssFile.seekg(nRangeBegin, std::ios::beg);
+                            ssFile.read(&strContent[0], strContent.size());
+
+                            nStatus = 206;
+                        }
+                        else
+                            nStatus = 416;
+                    }
+                    else
+                    {
+                        /* Get a vector for our file contents. */
+                        strContent.resize(nSize);
+
+                        /* Read our entire file's contents. */
+                        ssFile.seekg(0, std::ios::beg);
+                        ssFile.read(&strContent[0], nSize);
+
+                        /* If we have gotten this far, we have a successful lookup. */
+                        nStatus = 200;
+                    }
 
                     /* Close our file now. */
                     ssFile.close();
-
-                    /* If we have gotten this far, we have a successful lookup. */
-                    nStatus = 200;
                 }
             }
             else
@@ -204,7 +269,26 @@ namespace LLP
             case 200:
             {
                 RESPONSE.strContent = strContent;
-                RESPONSE.mapHeaders["Content-Type"] = "text/html";
+                RESPONSE.mapHeaders["Content-Type"]  = "text/html";
+                RESPONSE.mapHeaders["Accept-Ranges"] = "bytes";
+                break;
+            }
+
+            /* Handle a range of a file. */
+            case 206:
+            {
+                RESPONSE.strContent = strContent;
+                RESPONSE.mapHeaders["Content-Type"]  = "application/octet-stream";
+                RESPONSE.mapHeaders["Content-Range"] = debug::safe_printstr("bytes ", nRangeBegin, "-", nRangeEnd, "/", nSize);
+                break;
+            }
+
+            /* Handle for a range outside of the file. */
+            case 416:
+            {
+                RESPONSE.strContent = "<b>416 RANGE NOT SATISFIABLE</b>";
+                RESPONSE.mapHeaders["Content-Type"]  = "text/html";
+                RESPONSE.mapHeaders["Content-Range"] = debug::safe_printstr("bytes */", nSize);
                 break;
             }
 
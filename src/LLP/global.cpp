@@ -13,13 +13,16 @@ ________________________________________________________________________________
 
 #include <LLC/include/random.h>
 
+#include <LLP/include/command_pool.h>
 #include <LLP/include/global.h>
 #include <LLP/include/graceful_shutdown.h>
 #include <LLP/include/mining_config.h>
 #include <LLP/include/mining_server_factory.h>
 #include <LLP/include/miner_push_dispatcher.h>
 #include <LLP/include/network.h>
+#include <LLP/include/sync_pipeline.h>
 #include <LLP/include/falcon_auth.h>
+#include <LLP/include/validation_thread_pool.h>
 #include <LLP/include/colin_mining_agent.h>
 
 #include <TAO/API/include/global.h>
@@ -136,6 +139,9 @@ namespace LLP
         gethostname(chHostname, sizeof(chHostname));
         strHostname = std::string(chHostname);
 
+        /* Start the worker pool used for parallel block and transaction validation. */
+        InitializeValidationPool(config::GetArg("-validationthreads", 0));
+
         /* Initialize API Pointers. */
         TAO::API::Initialize();
 
@@ -402,6 +408,10 @@ namespace LLP
             }
         }
 
+        /* Start the workers running API and RPC commands off the data threads. */
+        if(servers.api || servers.rpc)
+            CommandPool::Get().Start();
+
         servers.SyncAliases();
 
         return true;
@@ -710,9 +720,18 @@ namespace LLP
          * the mining servers so any queued notifications are delivered first. */
         MinerPushDispatcher::StopPushWorker();
 
+        /* Stop the parallel sync before the nodes it asks for blocks go away. */
+        SyncPipeline::Get().Shutdown();
+
+        /* Let the running commands finish, the data threads run new ones inline from here. */
+        CommandPool::Get().Shutdown();
+
         /* Destroy the runtime-owned servers in the established shutdown order. */
         servers.Reset();
 
+        /* Stop the validation workers once no more blocks can arrive. */
+        ShutdownValidationPool();
+
         /* After all servers shut down, clean up underlying network resources. */
         NetworkShutdown();
     }
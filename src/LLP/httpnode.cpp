@@ -11,6 +11,7 @@
 
 ____________________________________________________________________________________________*/
 
+#include <LLP/include/command_pool.h>
 #include <LLP/types/httpnode.h>
 #include <LLP/templates/ddos.h>
 #include <LLP/templates/events.h>
@@ -18,6 +19,7 @@ ________________________________________________________________________________
 #include <Util/include/string.h>
 
 #include <algorithm>
+#include <limits>
 
 namespace LLP
 {
@@ -26,6 +28,7 @@ namespace LLP
     HTTPNode::HTTPNode()
     : BaseConnection<HTTPPacket> ( )
     , vchBuffer                  ( )
+    , nPending                   (0)
     {
     }
 
@@ -34,6 +37,7 @@ namespace LLP
     HTTPNode::HTTPNode(const Socket &SOCKET_IN, DDOS_Filter* DDOS_IN, bool fDDOSIn)
     : BaseConnection<HTTPPacket> (SOCKET_IN, DDOS_IN, fDDOSIn)
     , vchBuffer                  ( )
+    , nPending                   (0)
     {
     }
 
@@ -42,6 +46,7 @@ namespace LLP
     HTTPNode::HTTPNode(DDOS_Filter* DDOS_IN, bool fDDOSIn)
     : BaseConnection<HTTPPacket> (DDOS_IN, fDDOSIn)
     , vchBuffer                  ( )
+    , nPending                   (0)
     {
     }
 
@@ -52,6 +57,20 @@ namespace LLP
     }
 
 
+    /* Check if this connection is exempt from the read timeout while commands are pending. */
+    bool HTTPNode::IsTimeoutExempt() const
+    {
+        return nPending.load() > 0;
+    }
+
+
+    /* Get the read timeout while commands are pending. */
+    uint32_t HTTPNode::GetReadTimeout() const
+    {
+        return nPending.load() > 0 ? std::numeric_limits<uint32_t>::max() : 0;
+    }
+
+
     /* Send the DoS Score to DDOS Filter */
     bool HTTPNode::DoS(uint32_t nDoS, bool fReturn)
     {
@@ -179,4 +198,33 @@ namespace LLP
         }
     }
 
+
+    /* Write a response that runs no command from the data thread. */
+    bool HTTPNode::Respond(const std::shared_ptr<HTTPNode>& pNode, const HTTPPacket& RESPONSE)
+    {
+        /* Only the data thread adds pending commands, so with none pending there is nothing to overtake. */
+        if(nPending.load() == 0)
+        {
+            this->WritePacket(RESPONSE);
+            return true;
+        }
+
+        ++nPending;
+        const bool fQueued = CommandPool::Get().Reply(this, [pNode, RESPONSE]()
+        {
+            if(pNode->Connected())
+                pNode->WritePacket(RESPONSE);
+
+            --pNode->nPending;
+        });
+
+        if(!fQueued)
+        {
+            --nPending;
+            return false;
+        }
+
+        return true;
+    }
+
 }
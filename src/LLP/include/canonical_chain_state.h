@@ -143,7 +143,8 @@ namespace LLP
          **/
         int32_t height_drift_from_canonical() const
         {
-            const TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+            const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+            const TAO::Ledger::BlockState& stateBest = *pStateBest;
 
             return static_cast<int32_t>(stateBest.nHeight)
                  - static_cast<int32_t>(canonical_unified_height);
@@ -0,0 +1,218 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLP_INCLUDE_COMMAND_POOL_H
+#define NEXUS_LLP_INCLUDE_COMMAND_POOL_H
+
+#include <Util/include/json.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace LLP
+{
+    /** CommandPool
+     *
+     *  Worker threads executing API and RPC commands, so a slow command doesn't hold up the data thread reading
+     *  every other connection assigned to it. Enabled with -apiworkers (default 4), 0 runs commands inline.
+     *
+     *  Every connection has its own queue of commands that run one at a time in order, so responses go out in
+     *  the order the requests came in. Connections with commands waiting take turns on the workers, and both
+     *  the queue of a connection and the total number of commands waiting are bounded.
+     *
+     **/
+    class CommandPool
+    {
+        /** The upper bounds of the latency histogram buckets, in milliseconds. **/
+        static constexpr std::array<uint32_t, 8> LATENCY_BUCKETS = {{ 1, 5, 10, 50, 100, 500, 1000, 5000 }};
+
+
+        /** A command waiting to run. **/
+        struct Job
+        {
+            /** The endpoint the command is for. **/
+            std::string strEndpoint;
+
+            /** The function executing the command and writing its response. **/
+            std::function<void()> fnExecute;
+
+            /** The time the command was queued. **/
+            std::chrono::steady_clock::time_point tQueued;
+        };
+
+
+        /** The commands of a connection. **/
+        struct Client
+        {
+            /** The commands waiting to run. **/
+            std::deque<Job> queueJobs;
+
+            /** Flag indicating a command of this connection is running. **/
+            bool fRunning = false;
+        };
+
+
+        /** The statistics of an endpoint. **/
+        struct Endpoint
+        {
+            /** The number of commands waiting to run. **/
+            uint32_t nQueued = 0;
+
+            /** The number of commands executed. **/
+            uint64_t nCompleted = 0;
+
+            /** The number of commands turned away because the queues were full. **/
+            uint64_t nRejected = 0;
+
+            /** The total milliseconds commands spent waiting to run. **/
+            uint64_t nWaitMS = 0;
+
+            /** The number of commands by latency from being queued to being answered, one past the last bucket. **/
+            std::array<uint64_t, LATENCY_BUCKETS.size() + 1> vLatency = {{ }};
+        };
+
+
+        /** Mutex protecting the queues and statistics. **/
+        mutable std::mutex MUTEX;
+
+
+        /** Condition to wake the workers. **/
+        std::condition_variable CONDITION;
+
+
+        /** The connections with commands waiting or running. **/
+        std::map<const void*, Client> mapClients;
+
+
+        /** The connections with a command waiting and none running, in the order they get their turn. **/
+        std::deque<const void*> queueReady;
+
+
+        /** The statistics of every endpoint used. **/
+        std::map<std::string, Endpoint> mapEndpoints;
+
+
+        /** The total number of commands waiting. **/
+        uint32_t nQueued;
+
+
+        /** The number of commands waiting on all connections before new ones are turned away. **/
+        uint32_t nMaxQueued;
+
+
+        /** The number of commands waiting on one connection before new ones are turned away. **/
+        uint32_t nMaxClient;
+
+
+        /** Flag indicating the workers are running, cleared to tell them to exit. **/
+        std::atomic<bool> fRunning;
+
+
+        /** The worker threads. **/
+        std::vector<std::thread> vWorkers;
+
+
+        /** Default Constructor. **/
+        CommandPool();
+
+    public:
+
+        /** Get the pool instance. **/
+        static CommandPool& Get();
+
+
+        /** Start
+         *
+         *  Start the worker threads, reading -apiworkers, -apiqueue and -apiclientqueue.
+         *
+         **/
+        void Start();
+
+
+        /** Shutdown
+         *
+         *  Stop the worker threads once their current commands finish, dropping the commands still waiting.
+         *
+         **/
+        void Shutdown();
+
+
+        /** Running
+         *
+         *  Check if commands should be submitted to the pool rather than run inline.
+         *
+         **/
+        bool Running() const;
+
+
+        /** Submit
+         *
+         *  Queue a command for a connection.
+         *
+         *  @param[in] pClient The connection the command came from.
+         *  @param[in] strEndpoint The endpoint the command is for.
+         *  @param[in] fnExecute The function executing the command and writing its response.
+         *
+         *  @return false if the queues are full or the pool is stopped.
+         *
+         **/
+        bool Submit(const void* pClient, const std::string& strEndpoint, std::function<void()>&& fnExecute);
+
+
+        /** Reply
+         *
+         *  Queue a response that runs no command behind the commands a connection has waiting, so it doesn't
+         *  overtake their responses. Replies aren't turned away by the queue limits, only once a connection has
+         *  twice its limit waiting.
+         *
+         *  @param[in] pClient The connection the response is for.
+         *  @param[in] fnReply The function writing the response.
+         *
+         *  @return false if the connection has too much waiting or the pool is stopped.
+         *
+         **/
+        bool Reply(const void* pClient, std::function<void()>&& fnReply);
+
+
+        /** Status
+         *
+         *  Get the queue depths and latency histograms of the pool and every endpoint.
+         *
+         *  @return The status in JSON.
+         *
+         **/
+        encoding::json Status() const;
+
+
+    private:
+
+        /** Add a job to the queue of a connection, giving it a turn if it has none. Requires MUTEX. **/
+        void queue(const void* pClient, const std::string& strEndpoint, std::function<void()>&& fnExecute);
+
+
+        /** Thread executing the commands. **/
+        void Worker();
+    };
+}
+
+#endif
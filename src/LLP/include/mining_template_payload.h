@@ -67,7 +67,8 @@ namespace LLP
             return result;
         }
 
-        TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& stateBest = *pStateBest;
         TAO::Ledger::BlockState stateChannel = stateBest;
         const uint1024_t hashBestChain = TAO::Ledger::ChainState::hashBestChain.load();
         uint32_t nChannelHeight = 0;
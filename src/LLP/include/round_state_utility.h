@@ -91,7 +91,8 @@ namespace LLP
 
             /* Tightly-scoped atomic reads to minimize temporal inconsistency.
              * Both reads happen back-to-back with no intervening logic. */
-            TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+            const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+            const TAO::Ledger::BlockState& stateBest = *pStateBest;
             snap.hashBestChain = TAO::Ledger::ChainState::hashBestChain.load();
 
             /* Check blockchain readiness */
@@ -0,0 +1,283 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLP_INCLUDE_SYNC_PIPELINE_H
+#define NEXUS_LLP_INCLUDE_SYNC_PIPELINE_H
+
+#include <LLC/types/uint1024.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+/* Forward declarations. */
+namespace TAO::Ledger
+{
+    class Block;
+    class ClientBlock;
+    class SyncBlock;
+}
+
+namespace LLP
+{
+    /** SyncPipeline
+     *
+     *  Header first initial block download, enabled with -parallelsync.
+     *
+     *  The sync node serves the chain of headers as client blocks. The bodies are then asked for in windows
+     *  of consecutive blocks from every connected node that has them, checked on the validation pool as they
+     *  arrive, and connected one at a time in height order from a reorder buffer.
+     *
+     *  Requests use the existing ACTION::LIST messages, so any tritium node can serve the pipeline.
+     *
+     **/
+    class SyncPipeline
+    {
+        /** A range of blocks asked for from a single node. **/
+        struct Window
+        {
+            /** The last height in the window. **/
+            uint32_t nEnd;
+
+            /** The next height expected from the node. **/
+            uint32_t nNext;
+
+            /** The session the window was asked from, 0 if waiting for a node. **/
+            uint64_t nSession;
+
+            /** The session that last failed to serve the window. **/
+            uint64_t nFailed;
+
+            /** Timestamp of the request or the last block received for it. **/
+            uint64_t nLastActivity;
+        };
+
+
+        /** Mutex protecting the headers, windows and buffers. **/
+        mutable std::mutex MUTEX;
+
+
+        /** Condition to wake the connect thread when a block is ready. **/
+        std::condition_variable CONDITION;
+
+
+        /** The hash of the last block connected by the pipeline. **/
+        uint1024_t hashBase;
+
+
+        /** The height of the last block connected by the pipeline. **/
+        uint32_t nBaseHeight;
+
+
+        /** The hashes of the headers past the base, the first one being at nBaseHeight + 1. **/
+        std::deque<uint1024_t> vHeaders;
+
+
+        /** The session the headers are asked from. **/
+        uint64_t nHeaderSession;
+
+
+        /** Timestamp of the outstanding header request, 0 when none is outstanding. **/
+        uint64_t nHeaderRequested;
+
+
+        /** The windows being downloaded, by the first height they cover. **/
+        std::map<uint32_t, Window> mapWindows;
+
+
+        /** The next height that hasn't been given a window. **/
+        uint32_t nNextWindow;
+
+
+        /** The heights being checked on the validation pool. **/
+        std::set<uint32_t> setChecking;
+
+
+        /** The checked blocks waiting to be connected, by height. **/
+        std::map<uint32_t, std::unique_ptr<TAO::Ledger::Block>> mapReady;
+
+
+        /** The number of times a height has failed its checks or to connect. **/
+        std::map<uint32_t, uint32_t> mapFailures;
+
+
+        /** The sessions serving a window, or that served one before the run finished. **/
+        std::set<uint64_t> setRequested;
+
+
+        /** The sessions that were asked for their best height. **/
+        std::set<uint64_t> setSubscribed;
+
+
+        /** Flag to tell if the pipeline is driving the sync. **/
+        std::atomic<bool> fActive;
+
+
+        /** Flag to tell the threads to exit. **/
+        std::atomic<bool> fShutdown;
+
+
+        /** Thread assigning windows to nodes and asking for headers. **/
+        std::thread DISPATCH_THREAD;
+
+
+        /** Thread connecting the checked blocks in order. **/
+        std::thread CONNECT_THREAD;
+
+
+        /** Default Constructor. **/
+        SyncPipeline();
+
+    public:
+
+        /** Get the pipeline instance. **/
+        static SyncPipeline& Get();
+
+
+        /** Enabled
+         *
+         *  Check if synchronization should go through the pipeline.
+         *
+         *  @return true if -parallelsync is set and not running in -client mode.
+         *
+         **/
+        static bool Enabled();
+
+
+        /** Active
+         *
+         *  Check if the pipeline is currently driving the sync.
+         *
+         **/
+        bool Active() const;
+
+
+        /** Start
+         *
+         *  Start, or move the header download of a running pipeline to another sync node.
+         *
+         *  @param[in] nSession The session to download headers from.
+         *
+         **/
+        void Start(const uint64_t nSession);
+
+
+        /** Shutdown
+         *
+         *  Stop the pipeline threads.
+         *
+         **/
+        void Shutdown();
+
+
+        /** Requested
+         *
+         *  Check if a session was asked for sync blocks by the pipeline.
+         *
+         *  @param[in] nSession The session to check.
+         *
+         **/
+        bool Requested(const uint64_t nSession) const;
+
+
+        /** AddHeader
+         *
+         *  Extend the chain of headers with a client block from the header node.
+         *
+         *  @param[in] block The client block holding the header.
+         *  @param[in] nSession The session it came from.
+         *
+         *  @return true if the header was added to the chain.
+         *
+         **/
+        bool AddHeader(const TAO::Ledger::ClientBlock& block, const uint64_t nSession);
+
+
+        /** AddBlock
+         *
+         *  Queue a sync block that matches the chain of headers to be checked.
+         *
+         *  @param[in] block The sync block received.
+         *  @param[in] nSession The session it came from.
+         *
+         *  @return true if the block was queued.
+         *
+         **/
+        bool AddBlock(const TAO::Ledger::SyncBlock& block, const uint64_t nSession);
+
+
+        /** LastIndex
+         *
+         *  Handle the last index notification of the sync node, which ends a list of headers.
+         *
+         *  @param[in] hashLast The last index the node has sent.
+         *
+         **/
+        void LastIndex(const uint1024_t& hashLast);
+
+
+    private:
+
+        /** Reset the pipeline to start from the current best chain. **/
+        void reset();
+
+
+        /** Drop the headers from the given height up, along with their windows and blocks. **/
+        void truncate(const uint32_t nHeight);
+
+
+        /** Get the hash of the header at a height past the base. **/
+        const uint1024_t& header(const uint32_t nHeight) const;
+
+
+        /** Get the height of the last header. **/
+        uint32_t tip() const;
+
+
+        /** Record a failure at a height and queue it to be asked for again. **/
+        void failed(const uint32_t nHeight, const uint64_t nSession);
+
+
+        /** Forget a session once it no longer serves any window, so its blocks are no longer taken as requested. **/
+        void release(const uint64_t nSession);
+
+
+        /** Check and queue a block for connecting, run on the validation pool. **/
+        void check(std::shared_ptr<TAO::Ledger::SyncBlock> pblock, const uint32_t nHeight, const uint64_t nSession);
+
+
+        /** Ask for headers past the tip. **/
+        void request_headers();
+
+
+        /** Ask for the blocks of windows that are waiting for a node. **/
+        void request_windows();
+
+
+        /** Thread assigning windows and asking for headers. **/
+        void Dispatch();
+
+
+        /** Thread connecting the blocks in order. **/
+        void Connect();
+    };
+}
+
+#endif
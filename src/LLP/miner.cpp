@@ -792,7 +792,8 @@ namespace LLP
                            (SECONDS_PER_DAY / SECONDS_PER_DAY), "d)");
 
                 /* Build unified 32-byte response */
-                TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+                const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+                const TAO::Ledger::BlockState& stateBest = *pStateBest;
                 uint32_t nUnifiedHeight = stateBest.nHeight;
 
                 TAO::Ledger::BlockState stateChannel = stateBest;
@@ -1422,7 +1423,7 @@ namespace LLP
                 debug::log(2, FUNCTION, "GET_REWARD request from ", GetAddress().ToStringIP());
 
                 /* Get the mining reward amount for the channel currently set. */
-                uint64_t nReward = TAO::Ledger::GetCoinbaseReward(TAO::Ledger::ChainState::tStateBest.load(), nChannel.load(), 0);
+                uint64_t nReward = TAO::Ledger::GetCoinbaseReward(*TAO::Ledger::ChainState::tStateBest.get(), nChannel.load(), 0);
 
                 /* Check to make sure the reward is greater than zero. */
                 if(nReward == 0)
@@ -2184,7 +2185,8 @@ namespace LLP
          * The hash is needed inside the lock to implement the hash-based
          * bypass: a new hashPrevBlock always bypasses the 1-second floor
          * so miners receive fresh work after every fork step. */
-        TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& stateBest = *pStateBest;
         const uint1024_t hashBestChain =
             PushNotificationBuilder::BestChainHashForNotification(stateBest);
 
@@ -2292,7 +2294,8 @@ namespace LLP
         /* Snapshot the chain tip BEFORE entering the throttle lock (same
          * pattern as SendChannelNotification) so the hash-based bypass can
          * be evaluated while holding MUTEX without a blocking load inside. */
-        TAO::Ledger::BlockState stateBestForHash = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBestForHash = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& stateBestForHash = *pStateBestForHash;
         const uint1024_t hashCurrentChain =
             PushNotificationBuilder::BestChainHashForNotification(stateBestForHash);
 
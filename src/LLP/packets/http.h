@@ -232,6 +232,10 @@ namespace LLP
                     strType = "204 No Content";
                     break;
 
+                case 206:
+                    strType = "206 Partial Content";
+                    break;
+
                 case 400:
                     strType = "400 Bad Request";
                     break;
@@ -248,9 +252,17 @@ namespace LLP
                     strType = "404 Not Found";
                     break;
 
+                case 416:
+                    strType = "416 Range Not Satisfiable";
+                    break;
+
                 case 500:
                     strType = "500 Internal Server Error";
                     break;
+
+                case 503:
+                    strType = "503 Service Unavailable";
+                    break;
             }
 
             /* Set connection header. */
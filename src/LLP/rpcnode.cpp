@@ -13,6 +13,7 @@ ________________________________________________________________________________
 
 #include <Legacy/include/global.h>
 
+#include <LLP/include/command_pool.h>
 #include <LLP/types/rpcnode.h>
 #include <LLP/templates/events.h>
 
@@ -175,6 +176,68 @@ namespace LLP
             if(!config::fInitialized)
                 throw TAO::API::Exception(-1, "Daemon is still initializing");
 
+            /* Run the method on the command pool so this data thread can go on serving other connections. */
+            CommandPool& pool = CommandPool::Get();
+            if(pool.Running())
+            {
+                std::shared_ptr<RPCNode> pNode = shared_from_this();
+
+                ++nPending;
+                const bool fQueued = pool.Submit(this, "rpc/" + strMethod, [pNode, strMethod, jParams, jID]()
+                {
+                    /* Skip commands of clients that went away while they were waiting. */
+                    if(pNode->Connected())
+                    {
+                        /* Reset this thread's errors for the new command. */
+                        debug::GetLastError();
+
+                        pNode->Execute(strMethod, jParams, jID);
+                    }
+
+                    --pNode->nPending;
+                });
+
+                /* Tell the client to come back later when the queues are full. */
+                if(!fQueued)
+                {
+                    --nPending;
+                    return Respond(pNode, HTTPPacket(503));
+                }
+
+                return true;
+            }
+
+            return Execute(strMethod, jParams, jID);
+        }
+
+        /* Handle for custom API exceptions. */
+        catch(TAO::API::Exception& e)
+        {
+            return RejectRequest(e.ToJSON(), jID, e.what());
+        }
+
+        /* Handle for JSON exceptions. */
+        catch(const encoding::detail::exception& e)
+        {
+            return RejectRequest(TAO::API::Exception(e.id, e.what()).ToJSON(), jID, e.what());
+        }
+
+        /* Handle for STD exceptions. */
+        catch(const std::exception& e)
+        {
+            return RejectRequest(TAO::API::Exception(-32700, e.what()).ToJSON(), jID, e.what());
+        }
+
+        /* Handle a connection close header. */
+        return true;
+    }
+
+
+    /* Execute an RPC method and reply with its result or error. */
+    bool RPCNode::Execute(std::string strMethod, encoding::json jParams, const encoding::json& jID)
+    {
+        try
+        {
             /* Execute the RPC method. */
             #ifndef NO_WALLET
             encoding::json jsonResult = Legacy::Commands->Execute(strMethod, jParams, false);
@@ -208,7 +271,6 @@ namespace LLP
             return debug::error("RPC Exception: ", e.what());
         }
 
-        /* Handle a connection close header. */
         return true;
     }
 
@@ -236,7 +298,29 @@ namespace LLP
         return jReply;
     }
 
+    /* Reply an error from the RPC server. */
     void RPCNode::ErrorReply(const encoding::json& jError, const encoding::json& jID)
+    {
+        this->WritePacket(ErrorResponse(jError, jID));
+    }
+
+
+    /* Reply an error found in a request before its method was queued. */
+    bool RPCNode::RejectRequest(const encoding::json& jError, const encoding::json& jID, const std::string& strError)
+    {
+        /* Closing the connection would drop the responses still pending, so keep it open while there are any. */
+        const bool fPending = (nPending.load() > 0);
+        if(!Respond(shared_from_this(), ErrorResponse(jError, jID)))
+            return false;
+
+        debug::error("RPC Exception: ", strError);
+
+        return fPending;
+    }
+
+
+    /* Build the response of an error from the RPC server. */
+    HTTPPacket RPCNode::ErrorResponse(const encoding::json& jError, const encoding::json& jID)
     {
         /* Default error status code is 500. */
         uint16_t nStatus = 500;
@@ -256,8 +340,11 @@ namespace LLP
                 break;
         }
 
-        /* Send the response packet. */
-        PushResponse(nStatus, JSONReply(encoding::json(nullptr), jError, jID).dump());
+        /* Build the response packet. */
+        HTTPPacket RESPONSE(nStatus);
+        RESPONSE.strContent = JSONReply(encoding::json(nullptr), jError, jID).dump();
+
+        return RESPONSE;
     }
 
     bool RPCNode::Authorized(std::map<std::string, std::string>& mapHeaders)
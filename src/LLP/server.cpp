@@ -1248,6 +1248,10 @@ namespace LLP
         runtime::timer TIMER;
         if(CONFIG.ENABLE_METERS)
             TIMER.Start();
+
+        /* Keep track of the socket byte counters at the last meter output. */
+        uint64_t nSentLast   = Socket::BYTES_SENT.load();
+        uint64_t nCopiedLast = Socket::BYTES_COPIED.load();
         
         /* Keep track of cleanup timer (10 minutes for session sweep/purge) */
         runtime::timer CLEANUP_TIMER;
@@ -1417,6 +1421,11 @@ namespace LLP
             if((RPS == 0 && PPS == 0) || nGlobalConnections == 0)
                 continue;
 
+            /* Bytes copied into output queues for every byte sent, across all sockets. */
+            const uint64_t nSent   = Socket::BYTES_SENT.load();
+            const uint64_t nCopied = Socket::BYTES_COPIED.load();
+            const double dCopied   = double(nCopied - nCopiedLast) / std::max(nSent - nSentLast, uint64_t(1));
+
             /* Meter output. */
             debug::log(0,
                 ANSI_COLOR_FUNCTION, Name(), " LLP : ", ANSI_COLOR_RESET,
@@ -1424,11 +1433,14 @@ namespace LLP
                 DPS, " Closing/s | ",
                 RPS, " Incoming/s | ",
                 PPS, " Outgoing/s | ",
+                dCopied, " Copied/Sent | ",
                 nGlobalConnections, " Connections"
             );
 
             /* Reset meter info. */
             TIMER.Reset();
+            nSentLast   = nSent;
+            nCopiedLast = nCopied;
             ProtocolType::REQUESTS.store(0);
             ProtocolType::PACKETS.store(0);
             ProtocolType::CONNECTIONS.store(0);
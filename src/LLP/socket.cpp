@@ -25,6 +25,8 @@ ________________________________________________________________________________
 #ifndef WIN32
 #include <arpa/inet.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
 #endif
 
 #include <openssl/ssl.h>
@@ -34,6 +36,14 @@ ________________________________________________________________________________
 namespace LLP
 {
 
+    /* Total bytes handed to the kernel by all sockets. */
+    std::atomic<uint64_t> Socket::BYTES_SENT(0);
+
+
+    /* Total bytes copied into socket output queues by all sockets. */
+    std::atomic<uint64_t> Socket::BYTES_COPIED(0);
+
+
     /* The default constructor. */
     Socket::Socket()
     : pollfd             ( )
@@ -43,10 +53,9 @@ namespace LLP
     , nLastSend          (0)
     , nLastRecv          (0)
     , nError             (0)
-    , vBuffer            ( )
-    , m_nFlushOffset     (0)
-    , vPriorityBuffer    ( )
-    , m_nPriorityFlushOffset(0)
+    , queueOutput        ( )
+    , queuePriority      ( )
+    , nUnsent            (0)
     , nBufferSize        (0)
     , fBufferFull        (false)
     , nConsecutiveErrors (0)
@@ -69,10 +78,9 @@ namespace LLP
     , nLastSend          (socket.nLastSend.load())
     , nLastRecv          (socket.nLastRecv.load())
     , nError             (socket.nError.load())
-    , vBuffer            (socket.vBuffer)
-    , m_nFlushOffset     (socket.m_nFlushOffset)
-    , vPriorityBuffer    (socket.vPriorityBuffer)
-    , m_nPriorityFlushOffset(socket.m_nPriorityFlushOffset)
+    , queueOutput        (socket.queueOutput)
+    , queuePriority      (socket.queuePriority)
+    , nUnsent            (socket.nUnsent)
     , nBufferSize        (socket.nBufferSize.load())
     , fBufferFull        (socket.fBufferFull.load())
     , nConsecutiveErrors (socket.nConsecutiveErrors.load())
@@ -107,10 +115,9 @@ namespace LLP
     , nLastSend          (0)
     , nLastRecv          (0)
     , nError             (0)
-    , vBuffer            ( )
-    , m_nFlushOffset     (0)
-    , vPriorityBuffer    ( )
-    , m_nPriorityFlushOffset(0)
+    , queueOutput        ( )
+    , queuePriority      ( )
+    , nUnsent            (0)
     , nBufferSize        (0)
     , fBufferFull        (false)
     , nConsecutiveErrors (0)
@@ -264,10 +271,9 @@ namespace LLP
     , nLastSend          (0)
     , nLastRecv          (0)
     , nError             (0)
-    , vBuffer            ( )
-    , m_nFlushOffset     (0)
-    , vPriorityBuffer    ( )
-    , m_nPriorityFlushOffset(0)
+    , queueOutput        ( )
+    , queuePriority      ( )
+    , nUnsent            (0)
     , nBufferSize        (0)
     , fBufferFull        (false)
     , nConsecutiveErrors (0)
@@ -868,170 +874,136 @@ namespace LLP
     /* Write data into the socket buffer non-blocking */
     int32_t Socket::Write(const std::vector<uint8_t>& vData, size_t nBytes, bool fPriority)
     {
-        int32_t nSent = 0;
+        /* Single critical section covering both the output-queue check and the
+         * direct-send path, so that Flush() can't drain the queues in between
+         * and reorder new data ahead of queued data. */
+        RECURSIVE(SOCKET_MUTEX);
 
-        /* Single critical section covering both the overflow-buffer check and
-         * the direct-send path.  The previous design used two separate
-         * RECURSIVE(SOCKET_MUTEX) acquisitions, creating a window where
-         * Flush() could drain vBuffer between the first unlock and the second
-         * lock acquisition, potentially reordering new data ahead of buffered
-         * data.  TCP ordering preserves correctness for the TCP case, but the
-         * single-section approach is safer for any future transport and removes
-         * a redundant lock acquisition on the common (empty buffer) path. */
+        /* Clear stale fBufferFull latch under the lock.  If the queues have
+         * drained to zero since the last Write() but fBufferFull is still set,
+         * reset it now so subsequent Flush() calls don't spin unnecessarily.
+         * Use compare_exchange to avoid clobbering a concurrent
+         * fBufferFull.store(true) from WritePacket() on another thread. */
+        if(nUnsent == 0 && fBufferFull.load())
         {
-            RECURSIVE(SOCKET_MUTEX);
+            bool expected = true;
+            fBufferFull.compare_exchange_strong(expected, false);
+        }
 
-            /* Must be called only while holding SOCKET_MUTEX. */
-            auto bufferedBytes = [this]() -> size_t
-            {
-                return (vPriorityBuffer.size() - m_nPriorityFlushOffset)
-                    + (vBuffer.size() - m_nFlushOffset);
-            };
+        /* Queue behind any outstanding data.  Priority writes overtake queued
+         * low-priority packets at the next packet boundary, low-priority writes
+         * keep their FIFO order. */
+        if(nUnsent > 0)
+        {
+            enqueue(std::make_shared<const std::vector<uint8_t>>(vData.begin(), vData.begin() + nBytes), 0, fPriority);
+            BYTES_COPIED += nBytes;
 
-            auto clearStaleFullLatch = [this, &bufferedBytes]()
-            {
-                if(bufferedBytes() == 0 && fBufferFull.load())
-                {
-                    bool expected = true;
-                    fBufferFull.compare_exchange_strong(expected, false);
-                }
-            };
+            return static_cast<int32_t>(nBytes);
+        }
 
-            auto appendBuffered = [this, &vData, &bufferedBytes](std::vector<uint8_t>& vTarget)
-            {
-                vTarget.insert(vTarget.end(), vData.begin(), vData.end());
-                nBufferSize.store(bufferedBytes());
-            };
+        /* No outstanding data — attempt a direct non-blocking send. */
+        int32_t nSent = transmit(&vData[0], nBytes);
 
-            /* Clear stale fBufferFull latch under the lock.  If the buffer
-             * has drained to zero since the last Write() but fBufferFull is
-             * still set (Flush() returned early on an empty buffer, or a race
-             * between nBufferSize.store(0) and fBufferFull.store(false)),
-             * reset it now so subsequent Flush() calls don't spin unnecessarily.
-             * Use compare_exchange to avoid clobbering a concurrent
-             * fBufferFull.store(true) from WritePacket() on another thread. */
-            clearStaleFullLatch();
-
-            const size_t nPriorityUnsent = vPriorityBuffer.size() - m_nPriorityFlushOffset;
-            const size_t nUnsent = vBuffer.size() - m_nFlushOffset;
-
-            /* Priority writes join the control-plane buffer whenever any
-             * high-priority bytes are already pending, or when a low-priority
-             * backlog exists and we want to overtake it in user space. */
-            if(fPriority && (nPriorityUnsent > 0 || nUnsent > 0))
-            {
-                appendBuffered(vPriorityBuffer);
-                return static_cast<int32_t>(nBytes);
-            }
+        /* Handle for error state.  If the socket is only back-pressured
+         * (EWOULDBLOCK / WANT_WRITE), queue the full payload so the
+         * write-service path can retry it later instead of dropping it. */
+        if(nSent < 0)
+        {
+            if(Errors())
+                return nSent;
 
-            /* Low-priority writes append behind any existing buffered data to
-             * preserve in-class FIFO order and allow the flush path to drain
-             * control traffic first. */
-            if(!fPriority && (nPriorityUnsent > 0 || nUnsent > 0))
-            {
-                appendBuffered(vBuffer);
-                return static_cast<int32_t>(nBytes);
-            }
+            nSent = 0;
+        }
 
-            /* No outstanding data — attempt a direct non-blocking send. */
-            if(pSSL)
-                nSent = static_cast<int32_t>(SSL_write(pSSL, (int8_t*)&vData[0], nBytes));
-            else
-            {
-            #ifdef WIN32
-                nSent = static_cast<int32_t>(send(fd, (char*)&vData[0], nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
-            #else
-                nSent = static_cast<int32_t>(send(fd, (int8_t*)&vData[0], nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
-            #endif
-            }
+        /* If not all data was sent non-blocking, queue a copy with the offset
+         * past the bytes the kernel took, so the slice counts as partly sent
+         * and no priority packet is sent before its remainder. */
+        if(nSent != static_cast<int32_t>(nBytes))
+        {
+            enqueue(std::make_shared<const std::vector<uint8_t>>(vData.begin(), vData.begin() + nBytes), nSent, fPriority);
+            BYTES_COPIED += nBytes;
 
-            /* Handle for error state.  If the socket is only back-pressured
-             * (EWOULDBLOCK / WANT_WRITE), preserve the full payload in the
-             * overflow buffer so the write-service path can retry it later
-             * instead of dropping the packet. */
-            if(nSent < 0)
-            {
-                if(pSSL)
-                    nError = SSL_get_error(pSSL, nSent);
-                else
-                    nError = WSAGetLastError();
+            /* Nothing was accepted, report the payload as buffered. */
+            if(nSent == 0)
+                return static_cast<int32_t>(nBytes);
+        }
 
-                if(!Errors())
-                {
-                    std::vector<uint8_t>& vTarget = fPriority ? vPriorityBuffer : vBuffer;
-                    size_t& nTargetOffset = fPriority ? m_nPriorityFlushOffset : m_nFlushOffset;
+        /* Update last sent time — partial writes still represent forward
+         * progress.  Without this update, DISCONNECT::TIMEOUT_WRITE can
+         * fire spuriously when large mining templates are being sent in
+         * multiple chunks. */
+        nLastSend = runtime::timestamp(true);
+        return nSent;
+    }
 
-                    if(nTargetOffset == vTarget.size())
-                    {
-                        vTarget.clear();
-                        nTargetOffset = 0;
-                    }
 
-                    vTarget.insert(vTarget.end(), vData.begin(), vData.end());
-                    nBufferSize.store(bufferedBytes());
+    /* Write a shared frame non-blocking. */
+    int32_t Socket::WriteShared(const std::shared_ptr<const std::vector<uint8_t>>& pFrame)
+    {
+        const std::vector<uint8_t>& vData = *pFrame;
+        if(vData.empty())
+            return 0;
 
-                    return static_cast<int32_t>(nBytes);
-                }
-                return nSent;
-            }
+        RECURSIVE(SOCKET_MUTEX);
 
-            /* If not all data was sent non-blocking, buffer the remainder. */
-            if(nSent != static_cast<int32_t>(vData.size()))
-            {
-                /* Insert remaining data into the buffer (after any existing bytes,
-                 * but since nUnsent == 0 the vector may also be cleared first to
-                 * reclaim the space consumed by m_nFlushOffset). */
-                std::vector<uint8_t>& vTarget = fPriority ? vPriorityBuffer : vBuffer;
-                size_t& nTargetOffset = fPriority ? m_nPriorityFlushOffset : m_nFlushOffset;
+        /* Clear a stale fBufferFull latch, same as Write(). */
+        if(nUnsent == 0 && fBufferFull.load())
+        {
+            bool expected = true;
+            fBufferFull.compare_exchange_strong(expected, false);
+        }
 
-                if(nTargetOffset == vTarget.size())
-                {
-                    vTarget.clear();
-                    nTargetOffset = 0;
-                }
-                vTarget.insert(vTarget.end(), vData.begin() + nSent, vData.end());
-                nBufferSize.store(bufferedBytes());
+        /* Queue the frame by reference behind anything already buffered. */
+        if(nUnsent > 0)
+        {
+            enqueue(pFrame, 0, false);
+            return static_cast<int32_t>(vData.size());
+        }
 
-                /* Update last sent time — partial writes still represent forward
-                 * progress.  Without this update, DISCONNECT::TIMEOUT_WRITE can
-                 * fire spuriously when large mining templates are being sent in
-                 * multiple chunks.  nLastSend must reflect any successful send()
-                 * to prevent the DataThread from killing the connection. */
-                if(nSent > 0)
-                    nLastSend = runtime::timestamp(true);
+        /* No outstanding data — attempt a direct non-blocking send. */
+        int32_t nSent = transmit(&vData[0], vData.size());
 
+        /* Handle for error state, back-pressure keeps the whole frame queued. */
+        if(nSent < 0)
+        {
+            if(Errors())
                 return nSent;
-            }
+
+            nSent = 0;
+        }
+
+        /* Queue the frame for the remainder, the offset skips the bytes the kernel took. */
+        if(nSent != static_cast<int32_t>(vData.size()))
+        {
+            enqueue(pFrame, nSent, false);
+
+            if(nSent == 0)
+                return static_cast<int32_t>(vData.size());
         }
 
-        /* All data was written to the kernel buffer in one shot. */
         nLastSend = runtime::timestamp(true);
         return nSent;
     }
 
 
-    /* Flushes data out of the overflow buffer.
+    /* Flushes data out of the output queues.
      *
-     * Drains the buffer in a bounded loop, sending up to MTU bytes per
-     * iteration, for at most MAX_FLUSH_CHUNKS iterations (default 4).
+     * Sends at most MAX_FLUSH_CHUNKS × MTU bytes per call (default 4 × 16 KB).
      * This caps the maximum time Flush() holds SOCKET_MUTEX, preventing
      * write-side monopolization that starves the DataThread's ReadPacket()
-     * path on the same connection.
-     *
-     * With 4 × 16 KB chunks = 64 KB per Flush() call, a 2 MB buffer
-     * requires ~32 Flush() calls.  FLUSH_THREAD wakes on each
-     * FLUSH_CONDITION notify and drains incrementally.  Between calls,
-     * SOCKET_MUTEX is released, giving ReadPacket() a window to acquire
-     * the mutex and process inbound data.
+     * path on the same connection.  FLUSH_THREAD wakes on each
+     * FLUSH_CONDITION notify and drains incrementally.
      *
      * The chunk limit is configurable via -maxflushchunks (min 1, max 64).
      *
-     * Performance note: instead of erasing sent bytes from the front of
-     * vBuffer (O(n) memmove), Flush() advances m_nFlushOffset past sent
-     * bytes.  The vector is cleared (and the offset reset) only when all
-     * bytes have been consumed.  This makes every Flush() iteration O(1)
-     * for the common case and eliminates the per-chunk memmove that was
-     * previously O(n) relative to the total buffered size.
+     * On plain sockets the queued slices are gathered into one sendmsg(), so
+     * packet headers and shared relay frames go out without being copied into
+     * a contiguous buffer first.  SSL sockets send one slice chunk per
+     * SSL_write() since OpenSSL has no gather write.
+     *
+     * Slices go out in this order: a partly sent low-priority slice first, so
+     * that a priority packet never lands in the middle of another packet, then
+     * the priority queue, then the rest of the low-priority queue.
      *
      * Returns total bytes sent (≥ 0) or the last send() error (< 0). */
     int Socket::Flush()
@@ -1070,104 +1042,128 @@ namespace LLP
                 std::min(MAX_FLUSH_CHUNKS_LIMIT,
                     config::GetArg("-maxflushchunks", DEFAULT_FLUSH_CHUNKS))));
 
-        uint32_t nChunksSent = 0;
-
-        /* Bounded-drain loop: send MTU-sized chunks until the buffer is empty,
-         * the kernel TCP send buffer is full, or the chunk limit is reached. */
-        while(nBufferSize.load() > 0 && nChunksSent < MAX_FLUSH_CHUNKS)
+    #ifndef WIN32
+        /* Plain sockets gather the whole per-call budget into one sendmsg(). */
+        if(!pSSL)
         {
-            int32_t  nSent  = 0;
-            uint32_t nBytes = 0;
-            bool fPriorityChunk = false;
+            /* Maximum slices gathered per call. */
+            static constexpr uint32_t MAX_FLUSH_SLICES = 64;
+
+            RECURSIVE(SOCKET_MUTEX);
 
-            /* Send one chunk starting from the current read offset. */
+            const size_t nBudget = static_cast<size_t>(nMaxChunk) * MAX_FLUSH_CHUNKS;
+
+            /* Add a slice to the gather list, false once the budget is used up. */
+            iovec vSlices[MAX_FLUSH_SLICES];
+            uint32_t nSlices   = 0;
+            size_t   nGathered = 0;
+            auto gather = [&](const Slice& slice) -> bool
             {
-                RECURSIVE(SOCKET_MUTEX);
+                if(nSlices == MAX_FLUSH_SLICES || nGathered == nBudget)
+                    return false;
 
-                const size_t nPriorityUnsent = vPriorityBuffer.size() - m_nPriorityFlushOffset;
-                const size_t nLowUnsent      = vBuffer.size() - m_nFlushOffset;
+                const size_t nBytes = std::min(slice.pData->size() - slice.nOffset, nBudget - nGathered);
+                vSlices[nSlices].iov_base = const_cast<uint8_t*>(slice.pData->data() + slice.nOffset);
+                vSlices[nSlices].iov_len  = nBytes;
 
-                if(nPriorityUnsent > 0)
-                {
-                    fPriorityChunk = true;
-                    nBytes = std::min<uint32_t>(static_cast<uint32_t>(nPriorityUnsent), nMaxChunk);
-                }
-                else if(nLowUnsent > 0)
-                {
-                    nBytes = std::min<uint32_t>(static_cast<uint32_t>(nLowUnsent), nMaxChunk);
-                }
-                else
-                {
-                    nBufferSize.store(0);
-                    break;
-                }
+                ++nSlices;
+                nGathered += nBytes;
 
-                const std::vector<uint8_t>& vTarget = fPriorityChunk ? vPriorityBuffer : vBuffer;
-                const size_t nOffset = fPriorityChunk ? m_nPriorityFlushOffset : m_nFlushOffset;
+                return true;
+            };
 
-                if(pSSL)
-                    nSent = static_cast<int32_t>(SSL_write(pSSL, (int8_t *)&vTarget[nOffset], nBytes));
-                else
-                {
-                #ifdef WIN32
-                    nSent = static_cast<int32_t>(send(fd, (char*)&vTarget[nOffset], nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
-                #else
-                    nSent = static_cast<int32_t>(send(fd, (int8_t*)&vTarget[nOffset], nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
-                #endif
-                }
+            /* Finish a partly sent low-priority slice before anything else. */
+            size_t nFirst = 0;
+            if(!queueOutput.empty() && queueOutput.front().nOffset > 0)
+            {
+                gather(queueOutput.front());
+                nFirst = 1;
             }
 
-            /* Handle errors on flush — stop draining. */
-            if(nSent < 0)
+            /* Control traffic next, then the rest of the low-priority queue. */
+            for(const Slice& slice : queuePriority)
+                if(!gather(slice))
+                    break;
+
+            for(size_t nIndex = nFirst; nIndex < queueOutput.size(); ++nIndex)
+                if(!gather(queueOutput[nIndex]))
+                    break;
+
+            /* Nothing queued, reset our counter. */
+            if(nSlices == 0)
             {
-                if(pSSL)
-                    nError.store(SSL_get_error(pSSL, nSent));
-                else
-                    nError.store(WSAGetLastError());
+                nBufferSize.store(0);
+                return 0;
+            }
 
+            msghdr msg = { };
+            msg.msg_iov    = vSlices;
+            msg.msg_iovlen = nSlices;
+
+            nTotalSent = static_cast<int32_t>(sendmsg(fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT));
+
+            /* Handle errors on flush. */
+            if(nTotalSent < 0)
+            {
+                nError.store(WSAGetLastError());
                 ++nConsecutiveErrors;
 
-                /* Return error on first chunk, otherwise return bytes sent so far. */
-                return (nTotalSent > 0) ? nTotalSent : nSent;
+                return nTotalSent;
             }
 
-            /* send() returned 0 — kernel buffer is full, stop draining. */
-            if(nSent == 0)
-                break;
+            /* Successful send — advance the queues past the bytes sent. */
+            if(nTotalSent > 0)
+            {
+                consume(nTotalSent);
+
+                nLastSend          = runtime::timestamp(true);
+                nConsecutiveErrors = 0;
+            }
+
+            return nTotalSent;
+        }
+    #endif
 
-            /* Successful send — advance the read offset instead of erasing.
-             * Erasing from the front of a std::vector is O(n) because it
-             * memmoves all remaining elements leftward.  Advancing an offset
-             * is O(1).  When the offset reaches the end of the vector all
-             * bytes have been consumed; at that point we clear the vector and
-             * reset the offset in one shot to reclaim memory. */
+        /* Bounded-drain loop: send MTU-sized chunks of the next slice until the
+         * queues are empty, the kernel send buffer is full, or the chunk limit
+         * is reached. */
+        uint32_t nChunksSent = 0;
+        while(nBufferSize.load() > 0 && nChunksSent < MAX_FLUSH_CHUNKS)
+        {
+            int32_t nSent = 0;
             {
                 RECURSIVE(SOCKET_MUTEX);
 
-                std::vector<uint8_t>& vTarget = fPriorityChunk ? vPriorityBuffer : vBuffer;
-                size_t& nTargetOffset = fPriorityChunk ? m_nPriorityFlushOffset : m_nFlushOffset;
-                nTargetOffset += static_cast<size_t>(nSent);
-
-                if(nTargetOffset >= vTarget.size())
+                /* Pick the next slice in send order. */
+                const bool fPartial = (!queueOutput.empty() && queueOutput.front().nOffset > 0);
+                if(!fPartial && queuePriority.empty() && queueOutput.empty())
                 {
-                    /* All bytes sent — compact the vector to reclaim memory. */
-                    vTarget.clear();
-                    nTargetOffset = 0;
+                    nBufferSize.store(0);
+                    break;
                 }
 
-                const size_t nBuffered =
-                    (vPriorityBuffer.size() - m_nPriorityFlushOffset)
-                    + (vBuffer.size() - m_nFlushOffset);
-                nBufferSize.store(nBuffered);
+                const Slice& slice = (fPartial || queuePriority.empty()) ? queueOutput.front() : queuePriority.front();
+                const size_t nBytes = std::min<size_t>(slice.pData->size() - slice.nOffset, nMaxChunk);
+
+                nSent = transmit(slice.pData->data() + slice.nOffset, nBytes);
 
-                if(nBuffered == 0)
+                /* Handle errors on flush — stop draining. */
+                if(nSent < 0)
                 {
-                    /* Clear fBufferFull now that the buffers are fully drained. */
-                    bool expected = true;
-                    fBufferFull.compare_exchange_strong(expected, false);
+                    ++nConsecutiveErrors;
+
+                    /* Return error on first chunk, otherwise return bytes sent so far. */
+                    return (nTotalSent > 0) ? nTotalSent : nSent;
                 }
+
+                /* Successful send — advance the queues past the bytes sent. */
+                consume(nSent);
             }
 
+            /* Kernel buffer is full, stop draining. */
+            if(nSent == 0)
+                break;
+
             /* Accumulate total sent and update timers. */
             nTotalSent        += nSent;
             nLastSend          = runtime::timestamp(true);
@@ -1202,6 +1198,85 @@ namespace LLP
     }
 
 
+    /* Send bytes to the socket non-blocking. */
+    int32_t Socket::transmit(const uint8_t* pData, const size_t nBytes)
+    {
+        int32_t nSent = 0;
+        if(pSSL)
+            nSent = static_cast<int32_t>(SSL_write(pSSL, (int8_t*)pData, nBytes));
+        else
+        {
+        #ifdef WIN32
+            nSent = static_cast<int32_t>(send(fd, (char*)pData, nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
+        #else
+            nSent = static_cast<int32_t>(send(fd, (int8_t*)pData, nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
+        #endif
+        }
+
+        /* Record the error for the caller to check. */
+        if(nSent < 0)
+        {
+            if(pSSL)
+                nError.store(SSL_get_error(pSSL, nSent));
+            else
+                nError.store(WSAGetLastError());
+        }
+        else
+            BYTES_SENT += nSent;
+
+        return nSent;
+    }
+
+
+    /* Queue the unsent part of a buffer. */
+    void Socket::enqueue(const std::shared_ptr<const std::vector<uint8_t>>& pData, const size_t nOffset, const bool fPriority)
+    {
+        std::deque<Slice>& queueTarget = fPriority ? queuePriority : queueOutput;
+        queueTarget.push_back({pData, nOffset});
+
+        nUnsent += (pData->size() - nOffset);
+        nBufferSize.store(nUnsent);
+    }
+
+
+    /* Advance the output queues past bytes that were sent. */
+    void Socket::consume(size_t nSent)
+    {
+    #ifndef WIN32
+        /* Gathered sends don't go through transmit(). */
+        if(!pSSL)
+            BYTES_SENT += nSent;
+    #endif
+
+        while(nSent > 0)
+        {
+            /* Same order as Flush(): a partly sent low-priority slice, then the priority queue. */
+            const bool fPartial = (!queueOutput.empty() && queueOutput.front().nOffset > 0);
+            std::deque<Slice>& queueTarget = (fPartial || queuePriority.empty()) ? queueOutput : queuePriority;
+
+            /* Advance the front slice, dropping our reference once fully sent. */
+            Slice& slice = queueTarget.front();
+            const size_t nBytes = std::min(nSent, slice.pData->size() - slice.nOffset);
+
+            slice.nOffset += nBytes;
+            if(slice.nOffset == slice.pData->size())
+                queueTarget.pop_front();
+
+            nSent   -= nBytes;
+            nUnsent -= nBytes;
+        }
+
+        nBufferSize.store(nUnsent);
+
+        /* Clear fBufferFull now that the queues are fully drained. */
+        if(nUnsent == 0)
+        {
+            bool expected = true;
+            fBufferFull.compare_exchange_strong(expected, false);
+        }
+    }
+
+
     /*  Checks if is in null state. */
     bool Socket::IsNull() const
     {
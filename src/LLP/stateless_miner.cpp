@@ -1796,7 +1796,8 @@ namespace LLP
         /* Gather current chain state for unified 32-byte reply.
          * CRITICAL: Use stateBest.GetHash() instead of loading hashBestChain separately
          * to prevent race conditions where heights come from block N but hash from block N+1. */
-        TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& stateBest = *pStateBest;
         uint32_t nUnifiedHeight = stateBest.nHeight;
 
         TAO::Ledger::BlockState stateChannel = stateBest;
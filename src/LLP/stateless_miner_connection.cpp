@@ -488,7 +488,8 @@ namespace LLP
         uint32_t nDiff = TAO::Ledger::GetNextTargetRequired(stateBest, nChannel);
 
         /* Validate stateBest hasn't changed during calculation */
-        TAO::Ledger::BlockState stateBestCheck = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBestCheck = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& stateBestCheck = *pStateBestCheck;
         if(stateBest.nHeight != stateBestCheck.nHeight)
         {
             debug::log(3, FUNCTION, "Blockchain advanced during calculation - recalculating");
@@ -1191,7 +1192,8 @@ namespace LLP
                 
                 /* Cache the current unified height for stale-height throttling */
                 {
-                    TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+                    const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+                    const TAO::Ledger::BlockState& stateBest = *pStateBest;
                     context = context.WithLastTemplateUnifiedHeight(stateBest.nHeight);
                 }
 
@@ -1457,7 +1459,8 @@ namespace LLP
 
                 /* Build canonical chain state snapshot using nBits from the created block */
                 {
-                    TAO::Ledger::BlockState stateGetBlock = TAO::Ledger::ChainState::tStateBest.load();
+                    const auto pStateGetBlock = TAO::Ledger::ChainState::tStateBest.get();
+                    const TAO::Ledger::BlockState& stateGetBlock = *pStateGetBlock;
                     TAO::Ledger::BlockState stateGetBlockCh = stateGetBlock;
                     if(TAO::Ledger::GetLastState(stateGetBlockCh, gbResult.nBlockChannel))
                     {
@@ -2380,7 +2383,7 @@ namespace LLP
 
                 /* Get the mining reward amount for the channel currently set */
                 uint64_t nReward = TAO::Ledger::GetCoinbaseReward(
-                    TAO::Ledger::ChainState::tStateBest.load(), 
+                    *TAO::Ledger::ChainState::tStateBest.get(),
                     nChannel_snap, 
                     0);
 
@@ -3495,7 +3498,8 @@ namespace LLP
 
             /* Channel-height staleness: check if the blockchain has advanced past
              * the channel height this template was mining for. */
-            TAO::Ledger::BlockState stateCurrent = TAO::Ledger::ChainState::tStateBest.load();
+            const auto pStateCurrent = TAO::Ledger::ChainState::tStateBest.get();
+            const TAO::Ledger::BlockState& stateCurrent = *pStateCurrent;
             TAO::Ledger::BlockState stateChannel = stateCurrent;
             if(TAO::Ledger::GetLastState(stateChannel, nTemplateChannel))
             {
@@ -3826,7 +3830,8 @@ namespace LLP
         debug::log(2, FUNCTION, "   Templates before cleanup: ", mapBlocks.size());
 
         /* Get current blockchain state to determine current channel heights */
-        TAO::Ledger::BlockState stateCurrent = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateCurrent = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& stateCurrent = *pStateCurrent;
 
         /* Cache current channel heights for each channel (0=Stake, 1=Prime, 2=Hash) */
         std::map<uint32_t, uint32_t> currentChannelHeights;
@@ -4409,7 +4414,8 @@ namespace LLP
         /* Snapshot the best tip before taking MUTEX so the hash lookup work
          * stays outside the lock; the comparison/update against push-throttle
          * state still happens under MUTEX below. */
-        TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& stateBest = *pStateBest;
         const uint1024_t hashBestChain =
             PushNotificationBuilder::BestChainHashForNotification(stateBest);
 
@@ -4580,7 +4586,8 @@ namespace LLP
             return;
         }
 
-        TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& stateBest = *pStateBest;
         const uint1024_t hashCurrentChain =
             PushNotificationBuilder::BestChainHashForNotification(stateBest);
         
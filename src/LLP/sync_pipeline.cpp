@@ -0,0 +1,780 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLD/include/global.h>
+
+#include <LLP/include/global.h>
+#include <LLP/include/sync_pipeline.h>
+#include <LLP/include/validation_thread_pool.h>
+#include <LLP/types/tritium.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+#include <TAO/Ledger/include/process.h>
+#include <TAO/Ledger/types/client.h>
+#include <TAO/Ledger/types/locator.h>
+#include <TAO/Ledger/types/syncblock.h>
+#include <TAO/Ledger/types/tritium.h>
+
+#include <Legacy/types/legacy.h>
+
+#include <Util/include/args.h>
+#include <Util/include/debug.h>
+#include <Util/include/mutex.h>
+#include <Util/include/runtime.h>
+
+namespace LLP
+{
+    /* The number of consecutive blocks asked for in a single list request. */
+    const uint32_t SYNC_WINDOW_SIZE = 64;
+
+
+    /* The number of windows a node is asked for at the same time. */
+    const uint32_t MAX_WINDOWS_PER_NODE = 2;
+
+
+    /* How far past the last connected block windows are handed out, bounding the reorder buffer. */
+    const uint32_t MAX_BLOCKS_AHEAD = 4096;
+
+
+    /* How far past the last connected block headers are downloaded. */
+    const uint32_t MAX_HEADERS_AHEAD = 100000;
+
+
+    /* Seconds without a block before a window is asked from another node. */
+    const uint64_t WINDOW_TIMEOUT = 15;
+
+
+    /* Seconds before an unanswered header request is sent again. */
+    const uint64_t HEADER_TIMEOUT = 30;
+
+
+    /* The number of failures at a height before the headers from there are downloaded again. */
+    const uint32_t MAX_HEIGHT_FAILURES = 3;
+
+
+    /* Hash a sync block by its header fields, the same way the client block of its header commits to them. */
+    static uint1024_t header_hash(const TAO::Ledger::SyncBlock& block)
+    {
+        TAO::Ledger::ClientBlock header;
+        static_cast<TAO::Ledger::Block&>(header) = block;
+        header.nTime = block.nTime;
+
+        return header.GetHash();
+    }
+
+
+    /* Default Constructor. */
+    SyncPipeline::SyncPipeline()
+    : MUTEX            ( )
+    , CONDITION        ( )
+    , hashBase         (0)
+    , nBaseHeight      (0)
+    , vHeaders         ( )
+    , nHeaderSession   (0)
+    , nHeaderRequested (0)
+    , mapWindows       ( )
+    , nNextWindow      (0)
+    , setChecking      ( )
+    , mapReady         ( )
+    , mapFailures      ( )
+    , setRequested     ( )
+    , setSubscribed    ( )
+    , fActive          (false)
+    , fShutdown        (false)
+    , DISPATCH_THREAD  ( )
+    , CONNECT_THREAD   ( )
+    {
+    }
+
+
+    /* Get the pipeline instance. */
+    SyncPipeline& SyncPipeline::Get()
+    {
+        static SyncPipeline PIPELINE;
+        return PIPELINE;
+    }
+
+
+    /* Check if synchronization should go through the pipeline. */
+    bool SyncPipeline::Enabled()
+    {
+        return config::GetBoolArg("-parallelsync", false) && !config::fClient.load();
+    }
+
+
+    /* Check if the pipeline is currently driving the sync. */
+    bool SyncPipeline::Active() const
+    {
+        return fActive.load();
+    }
+
+
+    /* Start, or move the header download of a running pipeline to another sync node. */
+    void SyncPipeline::Start(const uint64_t nSession)
+    {
+        {
+            LOCK(MUTEX);
+
+            /* A fresh run starts from our best chain. */
+            if(!fActive.load())
+            {
+                reset();
+                setRequested.clear();
+
+                fActive.store(true);
+            }
+
+            /* Headers from now on come from the new sync node. */
+            nHeaderSession   = nSession;
+            nHeaderRequested = 0;
+
+            debug::log(0, FUNCTION, "Parallel sync from height ", nBaseHeight, " with headers from ", std::hex, nSession);
+        }
+
+        /* The threads live until shutdown once started. */
+        if(!DISPATCH_THREAD.joinable())
+        {
+            DISPATCH_THREAD = std::thread(&SyncPipeline::Dispatch, this);
+            CONNECT_THREAD  = std::thread(&SyncPipeline::Connect,  this);
+        }
+    }
+
+
+    /* Stop the pipeline threads. */
+    void SyncPipeline::Shutdown()
+    {
+        fShutdown.store(true);
+        fActive.store(false);
+
+        CONDITION.notify_all();
+
+        if(DISPATCH_THREAD.joinable())
+            DISPATCH_THREAD.join();
+
+        if(CONNECT_THREAD.joinable())
+            CONNECT_THREAD.join();
+    }
+
+
+    /* Check if a session was asked for sync blocks by the pipeline. */
+    bool SyncPipeline::Requested(const uint64_t nSession) const
+    {
+        LOCK(MUTEX);
+        return setRequested.count(nSession);
+    }
+
+
+    /* Extend the chain of headers with a client block from the header node. */
+    bool SyncPipeline::AddHeader(const TAO::Ledger::ClientBlock& block, const uint64_t nSession)
+    {
+        /* Get the hash outside of our lock. */
+        const uint1024_t hashBlock = block.GetHash();
+
+        LOCK(MUTEX);
+
+        /* Only take headers from the node we asked. */
+        if(!fActive.load() || nSession != nHeaderSession)
+            return false;
+
+        /* Check that the header links to the chain we have. */
+        const uint32_t nHeight = block.nHeight;
+        if(nHeight <= nBaseHeight || nHeight > tip() + 1)
+            return false;
+
+        if(block.hashPrevBlock != header(nHeight - 1))
+            return debug::error(FUNCTION, "header ", hashBlock.SubString(), " at height ", nHeight, " doesn't link to our chain");
+
+        /* Check for a header we already have, or a fork of our headers. */
+        if(nHeight <= tip())
+        {
+            if(header(nHeight) == hashBlock)
+                return false;
+
+            debug::log(0, FUNCTION, "Headers forked at height ", nHeight, " to ", hashBlock.SubString());
+            truncate(nHeight);
+        }
+
+        vHeaders.push_back(hashBlock);
+
+        /* Headers count as progress for the sync node. */
+        TritiumNode::nLastTimeReceived.store(runtime::timestamp());
+
+        return true;
+    }
+
+
+    /* Queue a sync block that matches the chain of headers to be checked. */
+    bool SyncPipeline::AddBlock(const TAO::Ledger::SyncBlock& block, const uint64_t nSession)
+    {
+        /* Get the hash outside of our lock. */
+        const uint1024_t hashBlock = header_hash(block);
+        const uint32_t nHeight     = block.nHeight;
+
+        {
+            LOCK(MUTEX);
+
+            /* Blocks that arrive after the sync finished are dropped quietly. */
+            if(!fActive.load())
+                return false;
+
+            /* Check that the block is one of our headers. */
+            if(nHeight <= nBaseHeight || nHeight > tip() || header(nHeight) != hashBlock)
+            {
+                debug::log(3, FUNCTION, "block ", hashBlock.SubString(), " at height ", nHeight, " is not in our headers");
+                return false;
+            }
+
+            /* Move the window along if this is from the node we asked for it. */
+            auto it = mapWindows.upper_bound(nHeight);
+            if(it != mapWindows.begin())
+            {
+                --it;
+
+                Window& window = it->second;
+                if(window.nSession == nSession && nHeight >= window.nNext && nHeight <= window.nEnd)
+                {
+                    window.nNext         = nHeight + 1;
+                    window.nLastActivity = runtime::timestamp();
+
+                    if(window.nNext > window.nEnd)
+                    {
+                        mapWindows.erase(it);
+                        release(nSession);
+                    }
+                }
+            }
+
+            /* Skip blocks another node already served us. */
+            if(setChecking.count(nHeight) || mapReady.count(nHeight))
+                return false;
+
+            setChecking.insert(nHeight);
+        }
+
+        /* Check the block on the validation pool, or on this thread if there is none. */
+        std::shared_ptr<TAO::Ledger::SyncBlock> pblock = std::make_shared<TAO::Ledger::SyncBlock>(block);
+
+        ValidationThreadPool* pPool = GetValidationPool();
+        if(pPool)
+        {
+            pPool->Submit(block.hashMerkleRoot, block.nNonce, 0, [this, pblock, nHeight, nSession]()
+            {
+                check(pblock, nHeight, nSession);
+                return true;
+            });
+        }
+        else
+            check(pblock, nHeight, nSession);
+
+        return true;
+    }
+
+
+    /* Handle the last index notification of the sync node, which ends a list of headers. */
+    void SyncPipeline::LastIndex(const uint1024_t& hashLast)
+    {
+        LOCK(MUTEX);
+
+        /* A list ending at our last header has been fully received. */
+        if(hashLast == header(tip()))
+            nHeaderRequested = 0;
+    }
+
+
+    /* Reset the pipeline to start from the current best chain. */
+    void SyncPipeline::reset()
+    {
+        const auto pStateBest = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& tStateBest = *pStateBest;
+
+        hashBase    = tStateBest.GetHash();
+        nBaseHeight = tStateBest.nHeight;
+        nNextWindow = nBaseHeight + 1;
+
+        vHeaders.clear();
+        mapWindows.clear();
+        mapReady.clear();
+        mapFailures.clear();
+        setSubscribed.clear();
+
+        nHeaderRequested = 0;
+    }
+
+
+    /* Drop the headers from the given height up, along with their windows and blocks. */
+    void SyncPipeline::truncate(const uint32_t nHeight)
+    {
+        vHeaders.resize(nHeight - nBaseHeight - 1);
+
+        /* Cut the windows back to the remaining headers. */
+        std::set<uint64_t> setDropped;
+        for(auto it = mapWindows.begin(); it != mapWindows.end(); )
+        {
+            Window& window = it->second;
+            if(window.nEnd >= nHeight)
+                window.nEnd = nHeight - 1;
+
+            if(it->first >= nHeight || window.nNext > window.nEnd)
+            {
+                setDropped.insert(window.nSession);
+                it = mapWindows.erase(it);
+            }
+            else
+                ++it;
+        }
+
+        /* Forget the nodes that no longer serve a window. */
+        for(const auto& nSession : setDropped)
+            release(nSession);
+
+        /* Blocks still being checked are dropped once their check is done. */
+        mapReady.erase(mapReady.lower_bound(nHeight), mapReady.end());
+        mapFailures.erase(mapFailures.lower_bound(nHeight), mapFailures.end());
+
+        nNextWindow = std::min(nNextWindow, nHeight);
+    }
+
+
+    /* Get the hash of the header at a height past the base. */
+    const uint1024_t& SyncPipeline::header(const uint32_t nHeight) const
+    {
+        if(nHeight == nBaseHeight)
+            return hashBase;
+
+        return vHeaders[nHeight - nBaseHeight - 1];
+    }
+
+
+    /* Get the height of the last header. */
+    uint32_t SyncPipeline::tip() const
+    {
+        return nBaseHeight + static_cast<uint32_t>(vHeaders.size());
+    }
+
+
+    /* Record a failure at a height and queue it to be asked for again. */
+    void SyncPipeline::failed(const uint32_t nHeight, const uint64_t nSession)
+    {
+        /* Blocks that keep failing mean the headers can't be trusted, so download them again. */
+        if(++mapFailures[nHeight] >= MAX_HEIGHT_FAILURES)
+        {
+            debug::error(FUNCTION, "height ", nHeight, " failed ", MAX_HEIGHT_FAILURES, " times, downloading headers again");
+
+            truncate(nHeight);
+            nHeaderRequested = 0;
+
+            release(nSession);
+            return;
+        }
+
+        /* Find the window covering the height, if any. */
+        auto it = mapWindows.upper_bound(nHeight);
+        if(it != mapWindows.begin())
+        {
+            auto itPrev = std::prev(it);
+
+            Window& window = itPrev->second;
+            if(nHeight <= window.nEnd)
+            {
+                /* The window has yet to download the height. */
+                if(nHeight >= window.nNext)
+                {
+                    release(nSession);
+                    return;
+                }
+
+                /* Split off the part the window has yet to download, so the height can be asked for on its own. */
+                const Window tail = window;
+                mapWindows.erase(itPrev);
+                mapWindows[tail.nNext] = tail;
+            }
+
+            /* Extend a window waiting for a node that ends right before the height. */
+            else if(window.nSession == 0 && window.nEnd + 1 == nHeight)
+            {
+                window.nEnd    = nHeight;
+                window.nFailed = nSession;
+
+                release(nSession);
+                return;
+            }
+        }
+
+        /* Ask for the block again, preferring another node, along with a waiting window that starts right after it. */
+        Window window = { nHeight, nHeight, 0, nSession, 0 };
+
+        it = mapWindows.find(nHeight + 1);
+        if(it != mapWindows.end() && it->second.nSession == 0 && it->second.nNext == nHeight + 1)
+        {
+            window.nEnd = it->second.nEnd;
+            mapWindows.erase(it);
+        }
+
+        mapWindows[nHeight] = window;
+        release(nSession);
+    }
+
+
+    /* Forget a session once it no longer serves any window. */
+    void SyncPipeline::release(const uint64_t nSession)
+    {
+        if(nSession == 0)
+            return;
+
+        for(const auto& pair : mapWindows)
+        {
+            if(pair.second.nSession == nSession)
+                return;
+        }
+
+        setRequested.erase(nSession);
+    }
+
+
+    /* Check and queue a block for connecting, run on the validation pool. */
+    void SyncPipeline::check(std::shared_ptr<TAO::Ledger::SyncBlock> pblock, const uint32_t nHeight, const uint64_t nSession)
+    {
+        /* Build the block the same way the sync handler does, adding its transactions to the mempool. */
+        std::unique_ptr<TAO::Ledger::Block> pCheck;
+        uint1024_t hashBlock = 0;
+
+        bool fValid = false;
+        try
+        {
+            if(pblock->nVersion >= 7)
+                pCheck.reset(new TAO::Ledger::TritiumBlock(*pblock));
+            else
+                pCheck.reset(new Legacy::LegacyBlock(*pblock));
+
+            hashBlock = pCheck->GetHash();
+
+            /* Blocks we already have fail their checks, but still move the connect thread along. */
+            fValid = pCheck->Check() || LLD::Ledger->HasBlock(hashBlock);
+        }
+        catch(const std::exception& e)
+        {
+            debug::error(FUNCTION, e.what());
+        }
+
+        LOCK(MUTEX);
+        setChecking.erase(nHeight);
+
+        /* Check that the headers haven't moved on while checking. */
+        if(!fActive.load() || nHeight <= nBaseHeight || nHeight > tip() || header(nHeight) != hashBlock)
+            return;
+
+        if(!fValid)
+        {
+            debug::error(FUNCTION, "block ", hashBlock.SubString(), " at height ", nHeight, " failed checks");
+            failed(nHeight, nSession);
+
+            return;
+        }
+
+        mapReady[nHeight] = std::move(pCheck);
+        CONDITION.notify_all();
+    }
+
+
+    /* Ask for headers past the tip. */
+    void SyncPipeline::request_headers()
+    {
+        std::shared_ptr<TritiumNode> pnode;
+        std::vector<uint1024_t> vHave;
+        {
+            LOCK(MUTEX);
+
+            /* Wait for the outstanding request. */
+            const uint64_t nNow = runtime::timestamp();
+            if(nHeaderRequested != 0 && nHeaderRequested + HEADER_TIMEOUT > nNow)
+                return;
+
+            /* Wait for the blocks to catch up with our headers. */
+            if(vHeaders.size() >= MAX_HEADERS_AHEAD)
+                return;
+
+            /* Get the node we download headers from. */
+            pnode = TritiumNode::GetNode(nHeaderSession);
+            if(!pnode)
+                return;
+
+            /* Ask once all headers are connected even if the node has no more, its last index completes the sync. */
+            if(pnode->nCurrentHeight != 0 && pnode->nCurrentHeight <= tip() && !vHeaders.empty())
+                return;
+
+            /* Locate from our headers first, then from our chain in case they forked. */
+            for(uint32_t nStep = 1, nHeight = tip(); nHeight > nBaseHeight && vHave.size() < 10; nStep *= 2)
+            {
+                vHave.push_back(header(nHeight));
+                nHeight = (nHeight > nBaseHeight + nStep ? nHeight - nStep : nBaseHeight);
+            }
+
+            nHeaderRequested = nNow;
+        }
+
+        /* Add the locator of our chain. */
+        const TAO::Ledger::Locator locator = TAO::Ledger::Locator(TAO::Ledger::ChainState::hashBestChain.load());
+        vHave.insert(vHave.end(), locator.vHave.begin(), locator.vHave.end());
+        vHave.resize(std::min<size_t>(vHave.size(), 30));
+
+        try
+        {
+            pnode->PushMessage(TritiumNode::ACTION::LIST,
+                uint8_t(TritiumNode::SPECIFIER::CLIENT),
+                uint8_t(TritiumNode::TYPES::BLOCK),
+                uint8_t(TritiumNode::TYPES::LOCATOR),
+                TAO::Ledger::Locator(vHave),
+                uint1024_t(0)
+            );
+        }
+        catch(const std::exception& e)
+        {
+            debug::error(FUNCTION, e.what());
+        }
+    }
+
+
+    /* Ask for the blocks of windows that are waiting for a node. */
+    void SyncPipeline::request_windows()
+    {
+        /* A request for a single window. */
+        struct Request
+        {
+            std::shared_ptr<TritiumNode> pnode;
+            uint1024_t hashStart;
+            uint1024_t hashStop;
+        };
+
+        /* Get our connected nodes outside of our lock. */
+        std::vector<std::shared_ptr<TritiumNode>> vNodes;
+        if(TRITIUM_SERVER)
+            vNodes = TRITIUM_SERVER->GetConnections();
+
+        std::vector<std::shared_ptr<TritiumNode>> vSubscribe;
+        std::vector<Request> vRequests;
+        {
+            LOCK(MUTEX);
+
+            /* Ask new nodes for their best height, which tells us the windows they can serve. */
+            std::vector<std::shared_ptr<TritiumNode>> vReady;
+            for(const auto& pnode : vNodes)
+            {
+                if(setSubscribed.insert(pnode->nCurrentSession).second)
+                    vSubscribe.push_back(pnode);
+                else if(pnode->nCurrentHeight > nBaseHeight)
+                    vReady.push_back(pnode);
+            }
+
+            /* Hand out new windows up to our look-ahead. */
+            const uint32_t nTip = tip();
+            while(nNextWindow <= nTip && nNextWindow <= nBaseHeight + MAX_BLOCKS_AHEAD)
+            {
+                const uint32_t nEnd = std::min(nTip, nNextWindow + SYNC_WINDOW_SIZE - 1);
+                mapWindows[nNextWindow] = { nEnd, nNextWindow, 0, 0, 0 };
+
+                nNextWindow = nEnd + 1;
+            }
+
+            /* Expire stalled windows and count the windows each node is serving. */
+            const uint64_t nNow = runtime::timestamp();
+
+            std::map<uint64_t, uint32_t> mapLoad;
+            for(auto it = mapWindows.begin(); it != mapWindows.end(); )
+            {
+                Window& window = it->second;
+
+                /* Connected blocks no longer need downloading. */
+                window.nNext = std::max(window.nNext, nBaseHeight + 1);
+                if(window.nNext > window.nEnd)
+                {
+                    it = mapWindows.erase(it);
+                    continue;
+                }
+
+                if(window.nSession != 0 && window.nLastActivity + WINDOW_TIMEOUT < nNow)
+                {
+                    debug::log(2, FUNCTION, "window ", window.nNext, "-", window.nEnd, " timed out from ", std::hex, window.nSession);
+
+                    window.nFailed  = window.nSession;
+                    window.nSession = 0;
+
+                    release(window.nFailed);
+                }
+
+                if(window.nSession != 0)
+                    ++mapLoad[window.nSession];
+
+                ++it;
+            }
+
+            /* Give waiting windows to the least loaded node that has them, in height order. */
+            for(auto& pair : mapWindows)
+            {
+                Window& window = pair.second;
+                if(window.nSession != 0)
+                    continue;
+
+                std::shared_ptr<TritiumNode> pBest;
+                for(const auto& pnode : vReady)
+                {
+                    /* Skip nodes that are full or don't have the window yet. */
+                    const uint64_t nSession = pnode->nCurrentSession;
+                    if(mapLoad[nSession] >= MAX_WINDOWS_PER_NODE || pnode->nCurrentHeight < window.nEnd)
+                        continue;
+
+                    if(!pBest)
+                    {
+                        pBest = pnode;
+                        continue;
+                    }
+
+                    /* Only go back to a node that failed this window if there is no other. */
+                    const bool fFailed = (nSession == window.nFailed);
+                    if(fFailed != (pBest->nCurrentSession == window.nFailed))
+                    {
+                        if(!fFailed)
+                            pBest = pnode;
+
+                        continue;
+                    }
+
+                    if(mapLoad[nSession] < mapLoad[pBest->nCurrentSession])
+                        pBest = pnode;
+                }
+
+                if(!pBest)
+                    continue;
+
+                window.nSession      = pBest->nCurrentSession;
+                window.nLastActivity = nNow;
+
+                ++mapLoad[window.nSession];
+                setRequested.insert(window.nSession);
+
+                /* A list stops before the start hash, so a single block is asked for from its parent. */
+                const uint32_t nStart = (window.nNext == window.nEnd ? window.nNext - 1 : window.nNext);
+                vRequests.push_back({ pBest, header(nStart), header(window.nEnd) });
+            }
+        }
+
+        /* Send our requests outside of our lock. */
+        for(const auto& pnode : vSubscribe)
+        {
+            try { pnode->Subscribe(TritiumNode::SUBSCRIPTION::BESTHEIGHT); }
+            catch(const std::exception& e) { debug::error(FUNCTION, e.what()); }
+        }
+
+        for(const auto& request : vRequests)
+        {
+            try
+            {
+                request.pnode->PushMessage(TritiumNode::ACTION::LIST,
+                    uint8_t(TritiumNode::SPECIFIER::SYNC),
+                    uint8_t(TritiumNode::TYPES::BLOCK),
+                    uint8_t(TritiumNode::TYPES::UINT1024_T),
+                    request.hashStart,
+                    request.hashStop
+                );
+            }
+            catch(const std::exception& e)
+            {
+                debug::error(FUNCTION, e.what());
+            }
+        }
+    }
+
+
+    /* Thread assigning windows and asking for headers. */
+    void SyncPipeline::Dispatch()
+    {
+        while(!fShutdown.load() && !config::fShutdown.load())
+        {
+            runtime::sleep(100);
+            if(!fActive.load())
+                continue;
+
+            /* Stop once the sync node tells us we are synchronized. */
+            if(TritiumNode::fSynchronized.load())
+            {
+                LOCK(MUTEX);
+
+                debug::log(0, FUNCTION, "Parallel sync finished at height ", nBaseHeight);
+
+                fActive.store(false);
+                reset();
+
+                continue;
+            }
+
+            request_headers();
+            request_windows();
+        }
+    }
+
+
+    /* Thread connecting the blocks in order. */
+    void SyncPipeline::Connect()
+    {
+        while(!fShutdown.load() && !config::fShutdown.load())
+        {
+            /* Wait for the next block to be checked. */
+            std::unique_ptr<TAO::Ledger::Block> pblock;
+            uint32_t nHeight = 0;
+            {
+                LOCK(MUTEX);
+                CONDITION.wait_for(lk, std::chrono::milliseconds(1000), [this]
+                {
+                    return fShutdown.load() || (fActive.load() && mapReady.count(nBaseHeight + 1));
+                });
+
+                auto it = mapReady.find(nBaseHeight + 1);
+                if(!fActive.load() || it == mapReady.end())
+                    continue;
+
+                nHeight = it->first;
+                pblock  = std::move(it->second);
+                mapReady.erase(it);
+            }
+
+            /* Connect the block, it was checked on the validation pool. */
+            uint8_t nStatus = 0;
+            TAO::Ledger::Process(*pblock, nStatus, nullptr, true);
+
+            const uint1024_t hashBlock = pblock->GetHash();
+
+            LOCK(MUTEX);
+
+            /* Check that the pipeline wasn't reset while connecting. */
+            if(!fActive.load() || nHeight != nBaseHeight + 1 || header(nHeight) != hashBlock)
+                continue;
+
+            /* Blocks connected by another path still move us along. */
+            if(!(nStatus & TAO::Ledger::PROCESS::ACCEPTED) && !LLD::Ledger->HasBlock(hashBlock))
+            {
+                debug::error(FUNCTION, "block ", hashBlock.SubString(), " at height ", nHeight, " failed to connect");
+                failed(nHeight, 0);
+
+                continue;
+            }
+
+            /* Move the base up to the connected block. */
+            hashBase    = hashBlock;
+            nBaseHeight = nHeight;
+
+            vHeaders.pop_front();
+            mapFailures.erase(nHeight);
+
+            TritiumNode::nLastTimeReceived.store(runtime::timestamp());
+        }
+    }
+}
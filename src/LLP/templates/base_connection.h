@@ -25,6 +25,7 @@ ________________________________________________________________________________
 
 #include <vector>
 #include <queue>
+#include <limits>
 #include <condition_variable>
 
 namespace LLP
@@ -34,6 +35,10 @@ namespace LLP
     class DDOS_Filter;
 
 
+    /** Relay key of nodes whose relay filter depends on the node itself. **/
+    const uint64_t RELAY_UNIQUE = std::numeric_limits<uint64_t>::max();
+
+
     /** BaseConnection
      *
      *  Base Template class to handle outgoing / incoming LLP data for both Client and Server.
@@ -337,6 +342,18 @@ namespace LLP
 
     private:
 
+        /** admit
+         *
+         *  Check if the send buffer has room for a packet, flagging the buffer as full if not.
+         *
+         *  @param[in] nBytes The size of the packet.
+         *
+         *  @return true if the packet can be written.
+         *
+         **/
+        bool admit(const uint64_t nBytes);
+
+
         /** Flag to determine if event occurred. **/
         std::atomic<bool> fEVENT;
 
@@ -412,6 +429,20 @@ namespace LLP
         }
 
 
+        /** RelayKey
+         *
+         *  Get the key of the relay filter this node applies. Nodes with the same key get the
+         *  same output from RelayFilter, so a relay is encoded once for all of them.
+         *
+         *  @return the filter key, RELAY_UNIQUE if the filter depends on this node alone.
+         *
+         **/
+        uint64_t RelayKey() const
+        {
+            return 0; //every node relays the same data
+        }
+
+
         /** AddTrigger
          *
          *  Adds a new event listener to this connection to fire off condition variables on specific message types.
@@ -524,6 +555,16 @@ namespace LLP
         void WritePacket(const PacketType& PACKET, bool fPriority);
 
 
+        /** WriteFrame
+         *
+         *  Write an encoded frame shared with other connections to the TCP stream.
+         *
+         *  @param[in] pFrame The bytes of the packet, referenced until sent.
+         *
+         **/
+        void WriteFrame(const std::shared_ptr<const std::vector<uint8_t>>& pFrame);
+
+
         /** ReadPacket
          *
          *  Non-Blocking Packet reader to build a packet from TCP Connection.
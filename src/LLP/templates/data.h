@@ -53,7 +53,7 @@ namespace LLP
 
 
     /** Compile-time trait: true for mining protocol types (Miner, StatelessMinerConnection).
-     *  Used to select epoll-based I/O on Linux for mining DataThreads. */
+     *  Used to select low-latency wait timeouts and the EPOLLOUT-only write path for mining DataThreads. */
     template <typename T>
     inline constexpr bool is_mining_data_thread_v =
         std::is_same_v<T, Miner> || std::is_same_v<T, StatelessMinerConnection>;
@@ -76,10 +76,11 @@ namespace LLP
      *  Base Template Thread Class for Server base. Used for Core LLP Packet Functionality.
      *  Not to be inherited, only for use by the LLP Server Base Class.
      *
-     *  On Linux, mining protocol DataThreads (Miner / StatelessMinerConnection) use epoll
-     *  instead of poll() for dedicated, high-priority I/O processing. This prevents
-     *  P2P traffic starvation from killing miner sessions. Non-mining DataThreads and
-     *  all non-Linux platforms continue to use the portable poll() path.
+     *  On Linux, every DataThread uses epoll instead of poll(), so that a wakeup only
+     *  visits the connections that are ready rather than every slot. Mining protocol
+     *  DataThreads (Miner / StatelessMinerConnection) additionally use a 1ms wait and
+     *  service socket writes from EPOLLOUT only, so that P2P traffic can't starve miner
+     *  sessions. All non-Linux platforms continue to use the portable poll() path.
      *
      **/
     template <class ProtocolType>
@@ -127,11 +128,10 @@ namespace LLP
 
 
 #ifdef __linux__
-        /** Epoll file descriptor for mining DataThreads.
-         *  Created via epoll_create1(0) in the constructor for mining protocols.
-         *  Set to -1 for non-mining protocols (poll() used instead).
-         *  Each mining connection's socket fd is registered with EPOLL_CTL_ADD
-         *  in AddConnection/NewConnection and deregistered in remove_connection. */
+        /** Epoll file descriptor for this DataThread.
+         *  Created via epoll_create1(0) in the constructor, set to -1 if that failed
+         *  (poll() used instead). Each connection's socket fd is registered with
+         *  EPOLL_CTL_ADD in AddConnection/NewConnection and deregistered in remove_connection. */
         int m_nEpollFd;
 #endif
 
@@ -194,7 +194,7 @@ namespace LLP
                 else
                     CONNECTIONS->at(nSlot) = std::shared_ptr<ProtocolType>(pnode);
 
-                 /* Register the socket fd with epoll for mining DataThreads on Linux.
+                 /* Register the socket fd with epoll on Linux.
                   * epoll_ctl is thread-safe: ListeningThread calls AddConnection while
                   * the DataThread is running epoll_wait concurrently. */
                 epoll_register(pnode->fd, nSlot);
@@ -263,7 +263,7 @@ namespace LLP
                 else
                     CONNECTIONS->at(nSlot) = std::shared_ptr<ProtocolType>(pnode);
 
-                /* Register the socket fd with epoll for mining DataThreads on Linux. */
+                /* Register the socket fd with epoll on Linux. */
                 epoll_register(pnode->fd, nSlot);
                 epoll_sync_write_interest(pnode->fd, nSlot, pnode->NeedsWriteService());
 
@@ -398,26 +398,23 @@ namespace LLP
 
         /** epoll_register
          *
-         *  Register a socket fd with the epoll instance for mining DataThreads.
-         *  No-op for non-mining protocols or non-Linux platforms.
+         *  Register a socket fd with the epoll instance of this DataThread.
+         *  No-op if epoll is unavailable or on non-Linux platforms.
          *
          *  @param[in] nFd    The socket file descriptor to register.
-         *  @param[in] nSlot  The CONNECTIONS vector index (stored in epoll_event.data.u32).
+         *  @param[in] nSlot  The CONNECTIONS vector index (stored in epoll_event.data.u64 with the fd).
          *
          **/
         void epoll_register(SOCKET nFd, uint32_t nSlot)
         {
 #ifdef __linux__
-            if constexpr (is_mining_data_thread_v<ProtocolType>)
+            if(m_nEpollFd >= 0 && nFd != static_cast<SOCKET>(INVALID_SOCKET))
             {
-                if(m_nEpollFd >= 0 && nFd != static_cast<SOCKET>(INVALID_SOCKET))
-                {
-                    struct epoll_event ev;
-                    ev.events  = EPOLLIN | EPOLLHUP | EPOLLERR;
-                    ev.data.u32 = nSlot;
-                    if(::epoll_ctl(m_nEpollFd, EPOLL_CTL_ADD, static_cast<int>(nFd), &ev) < 0)
-                        debug::error(FUNCTION, "epoll_ctl ADD failed for fd=", nFd, " slot=", nSlot, " errno=", errno);
-                }
+                struct epoll_event ev;
+                ev.events   = EPOLLIN | EPOLLHUP | EPOLLERR;
+                ev.data.u64 = epoll_key(nFd, nSlot);
+                if(::epoll_ctl(m_nEpollFd, EPOLL_CTL_ADD, static_cast<int>(nFd), &ev) < 0)
+                    debug::error(FUNCTION, "epoll_ctl ADD failed for fd=", nFd, " slot=", nSlot, " errno=", errno);
             }
 #else
             /* Suppress unused parameter warnings on non-Linux. */
@@ -429,7 +426,7 @@ namespace LLP
 
         /** epoll_sync_write_interest
          *
-         *  Update Linux mining epoll interest for a connection's write-service
+         *  Update Linux epoll interest for a connection's write-service
          *  state.  Read readiness is always armed; EPOLLOUT is toggled
          *  dynamically based on whether the connection still has queued or
          *  buffered outbound work.
@@ -442,22 +439,19 @@ namespace LLP
         void epoll_sync_write_interest(SOCKET nFd, uint32_t nSlot, bool fNeedsWriteService)
         {
 #ifdef __linux__
-            if constexpr (is_mining_data_thread_v<ProtocolType>)
+            if(m_nEpollFd >= 0 && nFd != static_cast<SOCKET>(INVALID_SOCKET))
             {
-                if(m_nEpollFd >= 0 && nFd != static_cast<SOCKET>(INVALID_SOCKET))
-                {
-                    struct epoll_event ev;
-                    ev.events  = EPOLLIN | EPOLLHUP | EPOLLERR;
-                    if(fNeedsWriteService)
-                        ev.events |= EPOLLOUT;
+                struct epoll_event ev;
+                ev.events  = EPOLLIN | EPOLLHUP | EPOLLERR;
+                if(fNeedsWriteService)
+                    ev.events |= EPOLLOUT;
 
-                    ev.data.u32 = nSlot;
+                ev.data.u64 = epoll_key(nFd, nSlot);
 
-                    if(::epoll_ctl(m_nEpollFd, EPOLL_CTL_MOD, static_cast<int>(nFd), &ev) < 0 && errno != ENOENT)
-                        debug::error(FUNCTION, "epoll_ctl MOD failed for fd=", nFd,
-                                     " slot=", nSlot, " write_interest=", fNeedsWriteService,
-                                     " errno=", errno);
-                }
+                if(::epoll_ctl(m_nEpollFd, EPOLL_CTL_MOD, static_cast<int>(nFd), &ev) < 0 && errno != ENOENT)
+                    debug::error(FUNCTION, "epoll_ctl MOD failed for fd=", nFd,
+                                 " slot=", nSlot, " write_interest=", fNeedsWriteService,
+                                 " errno=", errno);
             }
 #else
             (void)nFd;
@@ -469,8 +463,8 @@ namespace LLP
 
         /** epoll_deregister
          *
-         *  Remove a socket fd from the epoll instance for mining DataThreads.
-         *  No-op for non-mining protocols or non-Linux platforms.
+         *  Remove a socket fd from the epoll instance of this DataThread.
+         *  No-op if epoll is unavailable or on non-Linux platforms.
          *  Safe to call even if fd was already closed (epoll auto-removes closed fds).
          *
          *  @param[in] nFd  The socket file descriptor to deregister.
@@ -479,13 +473,10 @@ namespace LLP
         void epoll_deregister(SOCKET nFd)
         {
 #ifdef __linux__
-            if constexpr (is_mining_data_thread_v<ProtocolType>)
+            if(m_nEpollFd >= 0 && nFd != static_cast<SOCKET>(INVALID_SOCKET))
             {
-                if(m_nEpollFd >= 0 && nFd != static_cast<SOCKET>(INVALID_SOCKET))
-                {
-                    if(::epoll_ctl(m_nEpollFd, EPOLL_CTL_DEL, static_cast<int>(nFd), nullptr) < 0 && errno != ENOENT)
-                        debug::error(FUNCTION, "epoll_ctl DEL failed for fd=", nFd, " errno=", errno);
-                }
+                if(::epoll_ctl(m_nEpollFd, EPOLL_CTL_DEL, static_cast<int>(nFd), nullptr) < 0 && errno != ENOENT && errno != EBADF)
+                    debug::error(FUNCTION, "epoll_ctl DEL failed for fd=", nFd, " errno=", errno);
             }
 #else
             (void)nFd;
@@ -493,6 +484,24 @@ namespace LLP
         }
 
 
+        /** epoll_key
+         *
+         *  Pack a socket fd and its CONNECTIONS slot into the epoll event data.
+         *  The fd is kept alongside the slot so that a stale event for a slot that
+         *  was reused by a new connection within the same wakeup can be dropped.
+         *
+         *  @param[in] nFd    The socket file descriptor.
+         *  @param[in] nSlot  The CONNECTIONS vector index.
+         *
+         *  @return The 64-bit event key, fd in the upper word and slot in the lower.
+         *
+         **/
+        static uint64_t epoll_key(SOCKET nFd, uint32_t nSlot)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(nFd)) << 32) | nSlot;
+        }
+
+
         /** remove_connection_with_event
          *
          *  Fires off a Disconnect event with the given disconnect reason
@@ -546,12 +555,12 @@ namespace LLP
 #ifdef __linux__
         /** ThreadEpoll
          *
-         *  Epoll-based I/O loop for mining DataThreads on Linux.
-         *  Uses epoll_wait() with configurable timeout for maximum responsiveness.
+         *  Epoll-based I/O loop for DataThreads on Linux.
          *  Only processes connections with pending events (EPOLLIN/EPOLLOUT/EPOLLERR/EPOLLHUP),
-         *  with periodic health sweeps for timeout-based checks.
+         *  with periodic health sweeps for timeout-based checks. Mining protocols use the
+         *  -miningwait timeout for maximum responsiveness.
          *
-         *  Called from Thread() via if-constexpr for mining protocols.
+         *  Called from Thread() whenever the epoll instance was created.
          *
          **/
         void ThreadEpoll();
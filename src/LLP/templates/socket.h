@@ -20,6 +20,8 @@ ________________________________________________________________________________
 
 #include <vector>
 #include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <atomic>
 
@@ -68,32 +70,33 @@ namespace LLP
         std::atomic<int32_t> nError;
 
 
-        /** Oversize buffer for low-priority packets (templates / pushes). **/
-        std::vector<uint8_t> vBuffer;
-
-
-        /** Read offset into vBuffer.
+        /** Slice
          *
-         *  Instead of erasing sent bytes from the front of vBuffer (O(n) memmove),
-         *  Flush() advances this offset past the bytes it has sent.  vBuffer is
-         *  compacted (cleared and offset reset) only when all bytes have been
-         *  consumed, keeping every Flush() iteration O(1) for the common case.
+         *  A refcounted buffer queued for sending, with the offset of its first unsent byte.
+         *  Frames written with WriteShared() are referenced by every socket they go to, so
+         *  queueing them costs no copy.
          *
-         *  Protected by SOCKET_MUTEX (same as vBuffer).
-         *  Always satisfies: m_nFlushOffset <= vBuffer.size(). **/
-        size_t m_nFlushOffset;
+         **/
+        struct Slice
+        {
+            /** The bytes to send. **/
+            std::shared_ptr<const std::vector<uint8_t>> pData;
 
-        /** Oversize buffer for high-priority control packets (ACKs / round replies). **/
-        std::vector<uint8_t> vPriorityBuffer;
+            /** The offset of the first byte not sent yet. **/
+            size_t nOffset;
+        };
 
 
-        /** Read offset into vPriorityBuffer.
-         *
-         *  Mirrors m_nFlushOffset for the high-priority control-plane buffer.
-         *  Protected by SOCKET_MUTEX and always satisfies:
-         *  m_nPriorityFlushOffset <= vPriorityBuffer.size().
-         **/
-        size_t m_nPriorityFlushOffset;
+        /** Output queue for low-priority packets (templates / pushes / relays). **/
+        std::deque<Slice> queueOutput;
+
+
+        /** Output queue for high-priority control packets (ACKs / round replies). **/
+        std::deque<Slice> queuePriority;
+
+
+        /** Unsent bytes across both queues. Protected by SOCKET_MUTEX. **/
+        size_t nUnsent;
 
 
         /** Keep track of total buffered bytes across both priority classes. */
@@ -111,6 +114,14 @@ namespace LLP
         std::atomic<uint32_t> nConsecutiveErrors;
 
 
+        /** Total bytes handed to the kernel by all sockets. **/
+        static std::atomic<uint64_t> BYTES_SENT;
+
+
+        /** Total bytes copied into socket output queues by all sockets. **/
+        static std::atomic<uint64_t> BYTES_COPIED;
+
+
         /** Timeout flags. **/
         enum
         {
@@ -235,9 +246,25 @@ namespace LLP
         int32_t Write(const std::vector<uint8_t>& vData, size_t nBytes, bool fPriority);
 
 
+        /** WriteShared
+         *
+         *  Write a shared frame non-blocking. Any part of the frame the socket
+         *  doesn't accept is queued by reference rather than copied.
+         *
+         *  Shared frames always go in the low-priority queue.
+         *
+         *  @param[in] pFrame The encoded frame, shared with other sockets.
+         *
+         *  @return the total bytes that were written
+         *
+         **/
+        int32_t WriteShared(const std::shared_ptr<const std::vector<uint8_t>>& pFrame);
+
+
         /** Flush
          *
-         *  Flushes data out of the overflow buffer
+         *  Flushes data out of the output queues, gathering the queued slices
+         *  into a single sendmsg() on plain sockets.
          *
          *  @return the total bytes that were written
          *
@@ -320,6 +347,42 @@ namespace LLP
 
     private:
 
+        /** transmit
+         *
+         *  Send bytes to the socket non-blocking, must be called with SOCKET_MUTEX held.
+         *
+         *  @param[in] pData The bytes to send.
+         *  @param[in] nBytes The total bytes to send.
+         *
+         *  @return the total bytes that were sent, < 0 on error.
+         *
+         **/
+        int32_t transmit(const uint8_t* pData, const size_t nBytes);
+
+
+        /** enqueue
+         *
+         *  Queue the unsent part of a buffer, must be called with SOCKET_MUTEX held.
+         *
+         *  @param[in] pData The buffer to queue.
+         *  @param[in] nOffset The offset of the first byte to send.
+         *  @param[in] fPriority Flag to queue in the high-priority queue.
+         *
+         **/
+        void enqueue(const std::shared_ptr<const std::vector<uint8_t>>& pData, const size_t nOffset, const bool fPriority);
+
+
+        /** consume
+         *
+         *  Advance the output queues past bytes that were sent, in the order Flush() sends
+         *  them, must be called with SOCKET_MUTEX held.
+         *
+         *  @param[in] nSent The total bytes that were sent.
+         *
+         **/
+        void consume(size_t nSent);
+
+
         /** error_code
          *
          *  Returns the error of socket if any
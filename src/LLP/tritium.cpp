@@ -15,10 +15,12 @@ ________________________________________________________________________________
 
 #include <LLD/include/global.h>
 #include <LLD/cache/binary_key.h>
+#include <LLD/types/sync_reader.h>
 
 #include <LLP/types/tritium.h>
 #include <LLP/include/global.h>
 #include <LLP/include/manager.h>
+#include <LLP/include/sync_pipeline.h>
 #include <LLP/templates/events.h>
 
 #include <TAO/API/include/global.h>
@@ -128,6 +130,7 @@ namespace LLP
     , setSubscriptions()
     , mapTritium      ()
     , mapLegacy       ()
+    , pSyncReader     ()
     , nLastPing(0)
     , nLastSamples(0)
     , mapLatencyTracker()
@@ -161,6 +164,7 @@ namespace LLP
     , setSubscriptions()
     , mapTritium      ()
     , mapLegacy       ()
+    , pSyncReader     ()
     , nLastPing(0)
     , nLastSamples(0)
     , mapLatencyTracker()
@@ -193,6 +197,7 @@ namespace LLP
     , setSubscriptions()
     , mapTritium      ()
     , mapLegacy       ()
+    , pSyncReader     ()
     , nLastPing(0)
     , nLastSamples(0)
     , mapLatencyTracker()
@@ -1352,195 +1357,223 @@ namespace LLP
 
                         /* Track our sequential block index to issue the next batch. */
                         uint1024_t hashLastRead = stateLast.GetHash();
+                        uint1024_t hashLast     = hashLastRead;
 
-                        /* Do a sequential read to obtain the list at our set limit. */
-                        std::vector<TAO::Ledger::BlockState> vStates;
-
-                        while(!fBufferFull.load() && nBlockBudget > 0 && hashStart != hashStop)
+                        /* Sync blocks are streamed by a reader that reads them ahead on its own thread. */
+                        if(nSpecifier == SPECIFIER::SYNC && !config::GetBoolArg("-sequentialsync", false))
                         {
-                            const auto nNextBlockBatchSize = static_cast<uint32_t>(
-                                std::min<int32_t>(nBlockBudget, static_cast<int32_t>(nBatchLimit)));
+                            /* Keep the reader from our last list if this one starts where it left off. */
+                            if(!pSyncReader || !pSyncReader->Seek(hashStart))
+                                pSyncReader.reset(new LLD::SyncReader(hashStart));
 
-                            if(!LLD::Ledger->BatchRead(hashLastRead, "block", vStates, nNextBlockBatchSize, true))
-                                break;
+                            /* Send the blocks until we reach our limits. */
+                            TAO::Ledger::SyncBlock block;
+                            uint1024_t hashBlock;
+                            while(!fBufferFull.load() && nBlockBudget > 0 && hashStart != hashStop && pSyncReader->Next(block, hashBlock))
+                            {
+                                /* Push message in response. */
+                                PushMessage(TYPES::BLOCK, uint8_t(SPECIFIER::SYNC), block);
+
+                                /* Update start every iteration. */
+                                stateLast.hashPrevBlock = block.hashPrevBlock;
+                                hashStart = hashBlock;
+
+                                --nBlockBudget;
+                            }
+                        }
+                        else
+                        {
+                            /* Do a sequential read to obtain the list at our set limit. */
+                            std::vector<TAO::Ledger::BlockState> vStates;
+                            std::vector<uint1024_t> vHashes;
 
-                            /* Loop through all available states. */
-                            for(auto& state : vStates)
+                            while(!fBufferFull.load() && nBlockBudget > 0 && hashStart != hashStop)
                             {
-                                /* Keep this iterating so we can track our sequential reads. */
-                                hashLastRead = state.GetHash();
+                                const auto nNextBlockBatchSize = static_cast<uint32_t>(
+                                    std::min<int32_t>(nBlockBudget, static_cast<int32_t>(nBatchLimit)));
 
-                                /* Check if in main chain. */
-                                if(!state.IsInMainChain())
-                                    continue;
+                                if(!LLD::Ledger->BatchRead(hashLastRead, "block", vStates, nNextBlockBatchSize, true))
+                                    break;
+
+                                /* Hash the whole batch of headers at once. */
+                                TAO::Ledger::BlockState::GetHashes(vStates, vHashes);
 
-                                /* Check for matching hashes. */
-                                if(state.hashPrevBlock != stateLast.GetHash())
+                                /* Loop through all available states. */
+                                for(uint32_t nIndex = 0; nIndex < vStates.size(); ++nIndex)
                                 {
-                                    /* Read the correct block from next index. */
-                                    if(!LLD::Ledger->ReadBlock(stateLast.hashNextBlock, state))
-                                        break;
+                                    auto& state = vStates[nIndex];
 
-                                    /* Update hashLastRead. */
-                                    hashLastRead = state.GetHash();
-                                }
+                                    /* Keep this iterating so we can track our sequential reads. */
+                                    hashLastRead = vHashes[nIndex];
 
-                                /* Handle for special sync block type specifier. */
-                                if(nSpecifier == SPECIFIER::SYNC)
-                                {
-                                    /* Hande our experimental sequential sync code. */
-                                    if(config::GetBoolArg("-sequentialsync", false)) //set this default to false now
+                                    /* Check if in main chain. */
+                                    if(!state.IsInMainChain())
+                                        continue;
+
+                                    /* Check for matching hashes. */
+                                    if(state.hashPrevBlock != hashLast)
                                     {
-                                        /* Build the sync block from state. */
-                                        TAO::Ledger::SyncBlock block =
-                                            TAO::Ledger::SyncBlock(state, false);
+                                        /* Read the correct block from next index. */
+                                        if(!LLD::Ledger->ReadBlock(stateLast.hashNextBlock, state))
+                                            break;
 
-                                        /* Loop through transactions in state block. */
-                                        for(const auto& proof : state.vtx)
+                                        /* Update hashLastRead. */
+                                        hashLastRead = state.GetHash();
+                                    }
+
+                                    /* Handle for special sync block type specifier. */
+                                    if(nSpecifier == SPECIFIER::SYNC)
+                                    {
+                                        /* Hande our experimental sequential sync code. */
+                                        if(config::GetBoolArg("-sequentialsync", false)) //set this default to false now
                                         {
-                                            /* Switch for type. */
-                                            switch(proof.first)
+                                            /* Build the sync block from state. */
+                                            TAO::Ledger::SyncBlock block =
+                                                TAO::Ledger::SyncBlock(state, false);
+
+                                            /* Loop through transactions in state block. */
+                                            for(const auto& proof : state.vtx)
                                             {
-                                                /* Check for tritium. */
-                                                case TAO::Ledger::TRANSACTION::TRITIUM:
+                                                /* Switch for type. */
+                                                switch(proof.first)
                                                 {
-                                                    auto itTritium = mapTritium.find(proof.second);
-                                                    if(itTritium == mapTritium.end())
+                                                    /* Check for tritium. */
+                                                    case TAO::Ledger::TRANSACTION::TRITIUM:
                                                     {
-                                                        /* Read the next batch of inventory. */
-                                                        std::vector<TAO::Ledger::Transaction> vList;
-                                                        if(LLD::Ledger->BatchRead(proof.second, "tx", vList, nInventoryBatchSize, false))
+                                                        auto itTritium = mapTritium.find(proof.second);
+                                                        if(itTritium == mapTritium.end())
                                                         {
-                                                            /* Add all of our values to a map. */
-                                                            for(auto& tBatch : vList)
-                                                                mapTritium.emplace(tBatch.GetHash(), std::move(tBatch));
-
-                                                            //debug::notice("Read ", vList.size(), " entries (", mapTritium.size(), ")");
+                                                            /* Read the next batch of inventory. */
+                                                            std::vector<TAO::Ledger::Transaction> vList;
+                                                            if(LLD::Ledger->BatchRead(proof.second, "tx", vList, nInventoryBatchSize, false))
+                                                            {
+                                                                /* Add all of our values to a map. */
+                                                                for(auto& tBatch : vList)
+                                                                    mapTritium.emplace(tBatch.GetHash(), std::move(tBatch));
+
+                                                                //debug::notice("Read ", vList.size(), " entries (", mapTritium.size(), ")");
+                                                            }
+
+                                                            itTritium = mapTritium.find(proof.second);
                                                         }
 
-                                                        itTritium = mapTritium.find(proof.second);
-                                                    }
-
-                                                    /* Check that we found it in batch. */
-                                                    if(itTritium == mapTritium.end())
-                                                    {
-                                                        /* Make sure we have the transaction. */
-                                                        TAO::Ledger::Transaction tMissing;
-                                                        if(LLD::Ledger->ReadTx(proof.second, tMissing))
+                                                        /* Check that we found it in batch. */
+                                                        if(itTritium == mapTritium.end())
+                                                        {
+                                                            /* Make sure we have the transaction. */
+                                                            TAO::Ledger::Transaction tMissing;
+                                                            if(LLD::Ledger->ReadTx(proof.second, tMissing))
+                                                            {
+                                                                /* Build our transaction serialization stream. */
+                                                                DataStream ssData(SER_DISK, LLD::DATABASE_VERSION);
+                                                                ssData << tMissing;
+
+                                                                /* Push this to our new sync block. */
+                                                                block.vtx.push_back(std::make_pair(proof.first, ssData.Bytes()));
+
+                                                                debug::warning(FUNCTION, "read for ", proof.second.SubString());
+                                                            }
+                                                        }
+                                                        else
                                                         {
                                                             /* Build our transaction serialization stream. */
                                                             DataStream ssData(SER_DISK, LLD::DATABASE_VERSION);
-                                                            ssData << tMissing;
+                                                            ssData << itTritium->second;
 
                                                             /* Push this to our new sync block. */
                                                             block.vtx.push_back(std::make_pair(proof.first, ssData.Bytes()));
 
-                                                            debug::warning(FUNCTION, "read for ", proof.second.SubString());
+                                                            /* Delete processed transaction from memory. */
+                                                            mapTritium.erase(itTritium);
                                                         }
-                                                    }
-                                                    else
-                                                    {
-                                                        /* Build our transaction serialization stream. */
-                                                        DataStream ssData(SER_DISK, LLD::DATABASE_VERSION);
-                                                        ssData << itTritium->second;
-
-                                                        /* Push this to our new sync block. */
-                                                        block.vtx.push_back(std::make_pair(proof.first, ssData.Bytes()));
 
-                                                        /* Delete processed transaction from memory. */
-                                                        mapTritium.erase(itTritium);
+                                                        break;
                                                     }
 
-                                                    break;
-                                                }
-
-                                                /* Check for legacy. */
-                                                case TAO::Ledger::TRANSACTION::LEGACY:
-                                                {
-                                                    auto itLegacy = mapLegacy.find(proof.second);
-                                                    if(itLegacy == mapLegacy.end())
+                                                    /* Check for legacy. */
+                                                    case TAO::Ledger::TRANSACTION::LEGACY:
                                                     {
-                                                        /* Read the next batch of inventory. */
-                                                        std::vector<Legacy::Transaction> vList;
-                                                        if(LLD::Legacy->BatchRead(std::make_pair(std::string("tx"), proof.second), "tx", vList, nInventoryBatchSize, false))
+                                                        auto itLegacy = mapLegacy.find(proof.second);
+                                                        if(itLegacy == mapLegacy.end())
                                                         {
-                                                            /* Add all of our values to a map. */
-                                                            for(auto& tBatch : vList)
-                                                                mapLegacy.emplace(tBatch.GetHash(), std::move(tBatch));
-
-                                                            //debug::notice("Read ", vList.size(), " entries (", mapLegacy.size(), ")");
+                                                            /* Read the next batch of inventory. */
+                                                            std::vector<Legacy::Transaction> vList;
+                                                            if(LLD::Legacy->BatchRead(std::make_pair(std::string("tx"), proof.second), "tx", vList, nInventoryBatchSize, false))
+                                                            {
+                                                                /* Add all of our values to a map. */
+                                                                for(auto& tBatch : vList)
+                                                                    mapLegacy.emplace(tBatch.GetHash(), std::move(tBatch));
+
+                                                                //debug::notice("Read ", vList.size(), " entries (", mapLegacy.size(), ")");
+                                                            }
+
+                                                            itLegacy = mapLegacy.find(proof.second);
                                                         }
 
-                                                        itLegacy = mapLegacy.find(proof.second);
-                                                    }
-
-                                                    /* Check that we found it in batch. */
-                                                    if(itLegacy == mapLegacy.end())
-                                                    {
-                                                        /* Make sure we have the transaction. */
-                                                        Legacy::Transaction tMissing;
-                                                        if(LLD::Legacy->ReadTx(proof.second, tMissing))
+                                                        /* Check that we found it in batch. */
+                                                        if(itLegacy == mapLegacy.end())
+                                                        {
+                                                            /* Make sure we have the transaction. */
+                                                            Legacy::Transaction tMissing;
+                                                            if(LLD::Legacy->ReadTx(proof.second, tMissing))
+                                                            {
+                                                                /* Build our transaction serialization stream. */
+                                                                DataStream ssData(SER_DISK, LLD::DATABASE_VERSION);
+                                                                ssData << tMissing;
+
+                                                                /* Push this to our new sync block. */
+                                                                block.vtx.push_back(std::make_pair(proof.first, ssData.Bytes()));
+
+                                                                debug::warning(FUNCTION, mapLegacy.size(), " read for ", proof.second.SubString());
+                                                            }
+                                                        }
+                                                        else
                                                         {
                                                             /* Build our transaction serialization stream. */
                                                             DataStream ssData(SER_DISK, LLD::DATABASE_VERSION);
-                                                            ssData << tMissing;
+                                                            ssData << itLegacy->second;
 
                                                             /* Push this to our new sync block. */
                                                             block.vtx.push_back(std::make_pair(proof.first, ssData.Bytes()));
 
-                                                            debug::warning(FUNCTION, mapLegacy.size(), " read for ", proof.second.SubString());
+                                                            /* Delete processed transaction from memory. */
+                                                            mapLegacy.erase(itLegacy);
                                                         }
                                                     }
-                                                    else
-                                                    {
-                                                        /* Build our transaction serialization stream. */
-                                                        DataStream ssData(SER_DISK, LLD::DATABASE_VERSION);
-                                                        ssData << itLegacy->second;
-
-                                                        /* Push this to our new sync block. */
-                                                        block.vtx.push_back(std::make_pair(proof.first, ssData.Bytes()));
 
-                                                        /* Delete processed transaction from memory. */
-                                                        mapLegacy.erase(itLegacy);
-                                                    }
+                                                    break;
                                                 }
-
-                                                break;
                                             }
-                                        }
 
-                                        /* Push message in response. */
-                                        PushMessage(TYPES::BLOCK, uint8_t(SPECIFIER::SYNC), block);
-                                    }
-                                    else
-                                    {
-                                        /* Push message in response. */
-                                        PushMessage(TYPES::BLOCK, uint8_t(SPECIFIER::SYNC), TAO::Ledger::SyncBlock(state, true));
+                                            /* Push message in response. */
+                                            PushMessage(TYPES::BLOCK, uint8_t(SPECIFIER::SYNC), block);
+                                        }
                                     }
-                                }
 
-                                /* Push the block to our connection buffer. */
-                                else
-                                    PushBlock(nSpecifier, state);
+                                    /* Push the block to our connection buffer. */
+                                    else
+                                        PushBlock(nSpecifier, state);
 
-                                /* Update start every iteration. */
-                                stateLast = state;
-                                hashStart = hashLastRead;
+                                    /* Update start every iteration. */
+                                    stateLast = state;
+                                    hashLast  = hashLastRead;
+                                    hashStart = hashLastRead;
 
-                                /* Check for stop hash. */
-                                if(--nBlockBudget <= 0 || hashStart == hashStop || fBufferFull.load()) //1MB limit
-                                {
-                                    /* Regular debug for normal limits */
-                                    if(config::nVerbose >= 3)
+                                    /* Check for stop hash. */
+                                    if(--nBlockBudget <= 0 || hashStart == hashStop || fBufferFull.load()) //1MB limit
                                     {
-                                        /* Special message for full write buffers. */
-                                        if(fBufferFull.load())
-                                            debug::log(3, FUNCTION, "Buffer is FULL ", Buffered(), " bytes");
+                                        /* Regular debug for normal limits */
+                                        if(config::nVerbose >= 3)
+                                        {
+                                            /* Special message for full write buffers. */
+                                            if(fBufferFull.load())
+                                                debug::log(3, FUNCTION, "Buffer is FULL ", Buffered(), " bytes");
 
-                                        debug::log(3, FUNCTION, "Block budget ", nBlockBudget, " Reached ", hashStart.SubString(), " == ", hashStop.SubString());
-                                    }
+                                            debug::log(3, FUNCTION, "Block budget ", nBlockBudget, " Reached ", hashStart.SubString(), " == ", hashStop.SubString());
+                                        }
 
-                                    break;
+                                        break;
+                                    }
                                 }
                             }
                         }
@@ -2397,7 +2430,7 @@ namespace LLP
                                             Unsubscribe(SUBSCRIPTION::LASTINDEX);
 
                                             /* Total blocks synchronized */
-                                            uint32_t nBlocks = TAO::Ledger::ChainState::tStateBest.load().nHeight - nSyncStart.load();
+                                            uint32_t nBlocks = TAO::Ledger::ChainState::tStateBest.get()->nHeight - nSyncStart.load();
 
                                             /* Calculate the time to sync*/
                                             uint32_t nElapsed = SYNCTIMER.Elapsed();
@@ -2407,6 +2440,11 @@ namespace LLP
                                             debug::log(0, NODE, "ACTION::NOTIFY: Synchronized ", nBlocks, " blocks in ", nElapsed,
                                                 " seconds [", double(nBlocks / (nElapsed + 1.0)), " blocks/s]" );
                                         }
+
+                                        /* The parallel sync asks for its own headers and blocks. */
+                                        else if(SyncPipeline::Get().Active())
+                                            SyncPipeline::Get().LastIndex(hashLast);
+
                                         else
                                         {
                                             /* Ask for list of blocks. */
@@ -2753,6 +2791,19 @@ namespace LLP
                         if(config::fClient.load())
                             return debug::drop(NODE, "TYPES::BLOCK::SYNC: disabled in -client mode");
 
+                        /* Blocks for the parallel sync can come from any node it asked, and are connected by the pipeline. */
+                        if(SyncPipeline::Get().Requested(nCurrentSession))
+                        {
+                            /* Get the block from the stream. */
+                            TAO::Ledger::SyncBlock block;
+                            ssPacket >> block;
+
+                            /* Queue the block to be checked and connected. */
+                            SyncPipeline::Get().AddBlock(block, nCurrentSession);
+
+                            break;
+                        }
+
                         /* Check if this is an unsolicited sync block. */
                         if(nCurrentSession != TAO::Ledger::nSyncSession || fSynchronized.load())
                             return debug::drop(FUNCTION, "unsolicted sync block");
@@ -2798,6 +2849,13 @@ namespace LLP
                         TAO::Ledger::ClientBlock block;
                         ssPacket >> block;
 
+                        /* Headers for the parallel sync are only linked, their blocks are downloaded after. */
+                        if(!config::fClient.load() && SyncPipeline::Get().Active())
+                        {
+                            SyncPipeline::Get().AddHeader(block, nCurrentSession);
+                            break;
+                        }
+
                         /* Process the block. */
                         TAO::Ledger::Process(block, nStatus);
 
@@ -3844,6 +3902,18 @@ namespace LLP
     }
 
 
+    /* Get the key of the relay filter this node applies. */
+    uint64_t TritiumNode::RelayKey() const
+    {
+        /* Sigchain and register notifications are filtered by our own subscriptions. */
+        const uint16_t nMask = nNotifications.load();
+        if(nMask & (SUBSCRIPTION::SIGCHAIN | SUBSCRIPTION::REGISTER))
+            return RELAY_UNIQUE;
+
+        return nMask;
+    }
+
+
     /* Determine whether a node is syncing. */
     bool TritiumNode::Syncing()
     {
@@ -4037,7 +4107,7 @@ namespace LLP
 
         /* Cache the height at the start of the sync */
         if(nSyncStart.load() == 0)
-            nSyncStart.store(TAO::Ledger::ChainState::tStateBest.load().nHeight);
+            nSyncStart.store(TAO::Ledger::ChainState::tStateBest.get()->nHeight);
 
         /* Make sure the sync timer is stopped.  We don't start this until we receive our first sync block*/
         SYNCTIMER.Stop();
@@ -4045,6 +4115,13 @@ namespace LLP
         /* Subscribe to this node. */
         Subscribe(SUBSCRIPTION::LASTINDEX | SUBSCRIPTION::BESTCHAIN | SUBSCRIPTION::BESTHEIGHT);
 
+        /* Download headers from this node and blocks from every node through the parallel sync. */
+        if(SyncPipeline::Enabled())
+        {
+            SyncPipeline::Get().Start(nCurrentSession);
+            return;
+        }
+
         /* Ask for list of blocks if this is current sync node. */
         PushMessage(ACTION::LIST,
             config::fClient.load() ? uint8_t(SPECIFIER::CLIENT) : uint8_t(SPECIFIER::SYNC),
@@ -18,6 +18,8 @@ ________________________________________________________________________________
 #include <LLP/types/httpnode.h>
 #include <Util/include/json.h>
 
+#include <memory>
+
 namespace LLP
 {
     /** APINode
@@ -34,7 +36,7 @@ namespace LLP
      *  This could also be used as the base for a HTTP-LLP server implementation.
      *
      **/
-    class APINode : public HTTPNode
+    class APINode : public HTTPNode, public std::enable_shared_from_this<APINode>
     {
     public:
 
@@ -83,6 +85,19 @@ namespace LLP
         bool ProcessPacket() final;
 
 
+        /** Execute
+         *
+         *  Execute the command of a request and build its response. Runs on the command pool when it is enabled.
+         *
+         *  @param[in] REQUEST The request to execute.
+         *  @param[in] strAddress The address of the client.
+         *
+         *  @return The response to write.
+         *
+         **/
+        HTTPPacket Execute(HTTPPacket& REQUEST, const std::string& strAddress);
+
+
         /** Authorized
          *
          *  Check if an authorization base64 encoded string is correct.
@@ -18,6 +18,8 @@ ________________________________________________________________________________
 #include <LLP/templates/base_connection.h>
 #include <LLP/packets/http.h>
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 #include <cstdint>
@@ -54,6 +56,10 @@ namespace LLP
 
     public:
 
+        /** The number of commands of this connection waiting or running on the command pool. **/
+        std::atomic<uint32_t> nPending;
+
+
         /** Default Constructor **/
         HTTPNode();
 
@@ -91,6 +97,27 @@ namespace LLP
         bool ProcessPacket() override = 0;
 
 
+        /** IsTimeoutExempt
+         *
+         *  A connection waiting on the command pool sends nothing until its response is written, so it is
+         *  exempt from the read timeout while commands are pending.
+         *
+         *  @return true if this connection has commands pending.
+         *
+         **/
+        bool IsTimeoutExempt() const override;
+
+
+        /** GetReadTimeout
+         *
+         *  Get the read timeout while commands are pending, which is unbounded.
+         *
+         *  @return read-idle timeout in milliseconds, or 0 to use the default.
+         *
+         **/
+        uint32_t GetReadTimeout() const override;
+
+
         /** DoS
          *
          *  Send the DoS Score to DDOS Filte
@@ -122,6 +149,20 @@ namespace LLP
          **/
         void PushResponse(const uint16_t nMsg, const std::string& strContent);
 
+
+        /** Respond
+         *
+         *  Write a response that runs no command from the data thread. When commands of this connection are
+         *  still pending, the response waits behind them on the command pool so it doesn't overtake theirs.
+         *
+         *  @param[in] pNode The connection itself, kept alive while the response waits.
+         *  @param[in] RESPONSE The response to write.
+         *
+         *  @return false if the response couldn't be queued and the connection should be closed.
+         *
+         **/
+        bool Respond(const std::shared_ptr<HTTPNode>& pNode, const HTTPPacket& RESPONSE);
+
     };
 
 }
@@ -20,6 +20,8 @@ ________________________________________________________________________________
 #include <TAO/API/types/base.h>
 #include <Util/include/json.h>
 
+#include <memory>
+
 namespace LLP
 {
 
@@ -36,7 +38,7 @@ namespace LLP
      *  {"method":"", "params":[]}
      *
      **/
-    class RPCNode : public HTTPNode
+    class RPCNode : public HTTPNode, public std::enable_shared_from_this<RPCNode>
     {
     public:
 
@@ -78,6 +80,20 @@ namespace LLP
          **/
         bool ProcessPacket() final;
 
+
+        /** Execute
+         *
+         *  Execute an RPC method and reply with its result or error. Runs on the command pool when it is enabled.
+         *
+         *  @param[in] strMethod The method to execute.
+         *  @param[in] jParams The parameters of the method.
+         *  @param[in] jID The identifier of the request.
+         *
+         *  @return True if the method succeeded.
+         *
+         **/
+        bool Execute(std::string strMethod, encoding::json jParams, const encoding::json& jID);
+
     protected:
 
         /** JSONReply
@@ -106,6 +122,33 @@ namespace LLP
         void ErrorReply(const encoding::json& jsonError, const encoding::json& jsonID);
 
 
+        /** RejectRequest
+         *
+         *  Reply an error found in a request before its method was queued, behind the responses still pending.
+         *
+         *  @param[in] jsonError The JSON error response object.
+         *  @param[in] jsonID The identifier of request.
+         *  @param[in] strError The error to log.
+         *
+         *  @return False if the connection should be closed.
+         *
+         **/
+        bool RejectRequest(const encoding::json& jsonError, const encoding::json& jsonID, const std::string& strError);
+
+
+        /** ErrorResponse
+         *
+         *  Build the response of an error from the RPC server.
+         *
+         *  @param[in] jsonError The JSON error response object.
+         *  @param[in] jsonID The identifier of request.
+         *
+         *  @return The response packet.
+         *
+         **/
+        HTTPPacket ErrorResponse(const encoding::json& jsonError, const encoding::json& jsonID);
+
+
         /** Authorized
          *
          *  Check if an authorization base64 encoded string is correct.
@@ -31,8 +31,12 @@ ________________________________________________________________________________
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <thread>
 
+/* Forward declarations. */
+namespace LLD { class SyncReader; }
+
 namespace LLP
 {
 
@@ -503,6 +507,10 @@ namespace LLP
         std::map<uint512_t, Legacy::Transaction> mapLegacy;
 
 
+        /** Reads the sync blocks ahead for a node synchronizing with us. **/
+        std::unique_ptr<LLD::SyncReader> pSyncReader;
+
+
     public:
 
         /** Mutex for connected sessions. **/
@@ -736,6 +744,17 @@ namespace LLP
         const DataStream RelayFilter(const uint16_t nMsg, const DataStream& ssData) const;
 
 
+        /** RelayKey
+         *
+         *  Get the key of the relay filter this node applies, which is its notification mask
+         *  unless it is subscribed to sigchain or register notifications.
+         *
+         *  @return the filter key, RELAY_UNIQUE if the filter depends on this node alone.
+         *
+         **/
+        uint64_t RelayKey() const;
+
+
         /** Auth
          *
          *  Authorize this node to the connected node .
@@ -42,16 +42,11 @@ namespace TAO
             /* Get the transaction hash. */
             uint512_t nTxHash = tx.GetHash();
 
-            RECURSIVE(MUTEX);
-
-            /* Check the mempool. */
-            if(mapLegacy.count(nTxHash))
-                return false;
+            Shard& rShard = shard(nTxHash);
+            WRITE_LOCK(rShard.MUTEX);
 
-            /* Add to the map. */
-            mapLegacy[nTxHash] = tx;
-
-            return true;
+            /* Add to the map if not already in the mempool. */
+            return rShard.mapLegacy.emplace(nTxHash, tx).second;
         }
 
 
@@ -60,11 +55,22 @@ namespace TAO
             /* Get the transaction hash. */
             uint512_t hashTx = tx.GetHash();
 
+            /* Check if we already have this tx. */
+            Shard& rShard = shard(hashTx);
+            {
+                SHARED_LOCK(rShard.MUTEX);
+                if(rShard.mapLegacy.count(hashTx))
+                    return false;
+            }
+
             RECURSIVE(MUTEX);
 
-            /* Check if we already have this tx. */
-            if(mapLegacy.count(hashTx))
-                return false;
+            /* Check again now that we hold admission, another thread could have accepted it while we checked. */
+            {
+                SHARED_LOCK(rShard.MUTEX);
+                if(rShard.mapLegacy.count(hashTx))
+                    return false;
+            }
 
             debug::log(3, "ACCEPT --------------------------------------");
             if(config::nVerbose >= 3)
@@ -91,11 +97,13 @@ namespace TAO
             for(const auto& vin : tx.vin)
             {
                 /* Check if input is already claimed. */
-                if(mapInputs.count(vin.prevout))
+                if(IsSpent(vin.prevout.hash, vin.prevout.n))
                 {
                     /* Add to conflicts map. */
                     debug::error(FUNCTION, "LEGACY CONFLICT: INPUTS CLAIMED ", vin.prevout.hash.SubString(), ", ", vin.prevout.n);
-                    mapLegacyConflicts[hashTx] = tx;
+
+                    WRITE_LOCK(rShard.MUTEX);
+                    rShard.mapLegacyConflicts[hashTx] = tx;
 
                     return false;
                 }
@@ -224,12 +232,19 @@ namespace TAO
                 return debug::error(FUNCTION, "tx ", hashTx.SubString(), " failed to connect inputs");
 
             /* Set the inputs to be claimed. */
-            uint32_t s = tx.vin.size();
-            for(uint32_t i = 0; i < s; ++i)
-                mapInputs[tx.vin[i].prevout] = hashTx;
+            {
+                LOCK(INPUTS_MUTEX);
+
+                uint32_t s = tx.vin.size();
+                for(uint32_t i = 0; i < s; ++i)
+                    mapInputs[tx.vin[i].prevout] = hashTx;
+            }
 
             /* Add to the legacy map. */
-            mapLegacy[hashTx] = tx;
+            {
+                WRITE_LOCK(rShard.MUTEX);
+                rShard.mapLegacy[hashTx] = tx;
+            }
 
             /* Relay tx if creating ourselves. */
             if(!pnode && LLP::TRITIUM_SERVER)
@@ -254,19 +269,22 @@ namespace TAO
         /* Checks if a given output is spent in memory. */
         bool Mempool::IsSpent(const uint512_t& hash, const uint32_t n)
         {
+            LOCK(INPUTS_MUTEX);
             return mapInputs.count(Legacy::OutPoint(hash, n));
         }
 
         /* Gets a legacy transaction from mempool */
         bool Mempool::Get(const uint512_t& hashTx, Legacy::Transaction &tx, bool &fConflicted) const
         {
-            RECURSIVE(MUTEX);
+            Shard& rShard = shard(hashTx);
+            SHARED_LOCK(rShard.MUTEX);
 
             /* Check in conflict memory. */
-            if(mapLegacyConflicts.count(hashTx))
+            auto it = rShard.mapLegacyConflicts.find(hashTx);
+            if(it != rShard.mapLegacyConflicts.end())
             {
                 /* Get from conflicts map. */
-                tx = mapLegacyConflicts.at(hashTx);
+                tx = it->second;
                 fConflicted = true;
 
                 debug::log(0, FUNCTION, "CONFLICTED TRANSACTION: ", hashTx.SubString());
@@ -275,10 +293,11 @@ namespace TAO
             }
 
             /* Check the memory map. */
-            if(mapLegacy.count(hashTx))
+            it = rShard.mapLegacy.find(hashTx);
+            if(it != rShard.mapLegacy.end())
             {
                 /* Get the transaction from memory. */
-                tx = mapLegacy.at(hashTx);
+                tx = it->second;
 
                 return true;
             }
@@ -289,14 +308,16 @@ namespace TAO
         /* Gets a legacy transaction from mempool */
         bool Mempool::Get(const uint512_t& hashTx, Legacy::Transaction &tx) const
         {
-            RECURSIVE(MUTEX);
+            Shard& rShard = shard(hashTx);
+            SHARED_LOCK(rShard.MUTEX);
 
             /* Check the memory map. */
-            if(!mapLegacy.count(hashTx))
+            auto it = rShard.mapLegacy.find(hashTx);
+            if(it == rShard.mapLegacy.end())
                 return false;
 
             /* Get the transaction from memory. */
-            tx = mapLegacy.at(hashTx);
+            tx = it->second;
 
             return true;
         }
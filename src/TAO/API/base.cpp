@@ -15,6 +15,7 @@ ________________________________________________________________________________
 #include <TAO/API/types/base.h>
 #include <TAO/API/types/exception.h>
 #include <TAO/API/types/operators/initialize.h>
+#include <TAO/API/types/query.h>
 
 #include <TAO/API/include/check.h>
 #include <TAO/API/include/filter.h>
@@ -128,23 +129,25 @@ namespace TAO::API
 
             /* Check if we may have some caches available or execute the function. */
             encoding::json jResults;
-            if(nSettings & ENABLE::CACHING)
+            bool fPlanned = false;
+            if((nSettings & ENABLE::CACHING) && xFunction.oCache.Get(jParams, jResults))
+                debug::notice("Using CACHE for ", strMethod, " of size ", jResults.size());
+            else
             {
-                /* Check if we can get it in a cache. */
-                if(!xFunction.oCache.Get(jParams, jResults))
-                {
-                    /* Execute our function so we can have an up to date cache. */
-                    jResults =
-                        xFunction.Execute(jParams, fHelp);
+                /* Check if our function can apply our queries and paging while it reads. */
+                if(nSettings & ENABLE::PLANNING)
+                    fPlanned = QueryPlan::Prepare(jParams, nSettings, xFunction.oCache.strDefaultColumn);
 
-                    /* Now insert it into our cache. */
-                    xFunction.oCache.Insert(jParams, jResults);
-                }
+                /* Execute our function so we can have an up to date cache. */
+                jResults =
+                    xFunction.Execute(jParams, fHelp);
+
+                /* Planned results are only part of the dataset, so we sort them without caching. */
+                if(fPlanned)
+                    xFunction.oCache.Sort(jParams, jResults);
                 else
-                    debug::notice("Using CACHE for ", strMethod, " of size ", jResults.size());
+                    xFunction.oCache.Insert(jParams, jResults);
             }
-            else
-                jResults = xFunction.Execute(jParams, fHelp);
 
             /* Check our settings for queries and filters. */
             if(nSettings & ENABLE::QUERIES || nSettings & ENABLE::FILTERS)
@@ -156,8 +159,8 @@ namespace TAO::API
                     encoding::json jProcessed = encoding::json::array();
                     for(auto& jItem : jResults)
                     {
-                        /* Check that we match our filters. */
-                        if((nSettings & ENABLE::QUERIES) && !FilterResults(jParams, jItem))
+                        /* Check that we match our filters, unless our function already has. */
+                        if((nSettings & ENABLE::QUERIES) && !fPlanned && !FilterResults(jParams, jItem))
                             continue;
 
                         /* Check that we match our filters. */
@@ -39,8 +39,8 @@ namespace TAO::API
         jRet[ "hash"]  = ChannelToJSON(2);
 
         /* Grab our best block. */
-        const TAO::Ledger::BlockState tBestBlock =
-            TAO::Ledger::ChainState::tStateBest.load();
+        const auto pBestBlock = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& tBestBlock = *pBestBlock;
 
         /* We only need supply data when on a public network or testnet, private and hybrid do not have supply. */
         if(!config::fHybrid.load())
@@ -38,8 +38,8 @@ namespace TAO::API
     encoding::json Ledger::GetMetrics(const encoding::json& jParams, const bool fHelp)
     {
         /* Grab our best block. */
-        const TAO::Ledger::BlockState tBestBlock =
-            TAO::Ledger::ChainState::tStateBest.load();
+        const auto pBestBlock = TAO::Ledger::ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& tBestBlock = *pBestBlock;
 
         /* Wrap this in a cache. */
         encoding::json jRet;
@@ -101,7 +101,7 @@ namespace TAO::API
                 std::placeholders::_1,
                 std::placeholders::_2
             )
-            , ENABLE::CACHING | ENABLE::PAGING | ENABLE::SORTING | ENABLE::FILTERS | ENABLE::QUERIES | ENABLE::OPERATORS
+            , ENABLE::CACHING | ENABLE::PAGING | ENABLE::SORTING | ENABLE::FILTERS | ENABLE::QUERIES | ENABLE::OPERATORS | ENABLE::PLANNING
         );
 
         /* Handle for generic list operations. */
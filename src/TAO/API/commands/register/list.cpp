@@ -24,6 +24,7 @@ ________________________________________________________________________________
 #include <TAO/API/include/get.h>
 #include <TAO/API/include/list.h>
 #include <TAO/API/types/exception.h>
+#include <TAO/API/types/query.h>
 
 #include <TAO/Ledger/include/stake.h>
 
@@ -39,73 +40,100 @@ namespace TAO::API
         /* Grab our type to run some checks against. */
         const std::set<std::string> setTypes = ExtractTypes(jParams);
 
-        /* Build our return value. */
-        encoding::json jRet = encoding::json::array();
+        /* Build our plan to check our query and limits as we read. */
+        QueryPlan tPlan(jParams);
         for(const auto& strType : setTypes)
         {
+            /* Check if we have all the results we need already. */
+            if(tPlan.Full())
+                break;
+
             try
             {
                 /* Get our standard type. */
                 const std::string strStandard =
                     mapStandards[strType].Type();
 
-                /* Special handle if address indexed. */
-                if(config::fIndexAddress.load())
+                /* Read only the registers of our standard from the type index once it is built. */
+                if(LLD::Register->HasTypes())
                 {
-                    /* Batch read up to 1000 at a time */
-                    std::vector<std::pair<uint256_t, TAO::Register::Object>> vObjects;
-                    if(LLD::Register->BatchRead(strStandard + "_address", vObjects, -1))
+                    /* Read by owner if our query requires one, user objects can shadow the owner with a field. */
+                    uint256_t hashOwner = 0;
+                    if(strStandard != "object")
+                        tPlan.Owner(hashOwner);
+
+                    /* Read in small pages so we don't read past what our plan needs. */
+                    uint32_t nCursor = 0;
+                    std::vector<uint256_t> vAddresses;
+                    while(!tPlan.Full() && LLD::Register->ListTypes(strStandard, hashOwner, vAddresses, nCursor, 100))
                     {
-                        /* Add the register data to the response */
-                        for(auto& rObject : vObjects)
+                        /* Read the states of our page together. */
+                        std::vector<TAO::Register::State> vStates;
+                        LLD::Register->ReadState(vAddresses, vStates);
+
+                        /* Check each register of our page. */
+                        for(uint32_t n = 0; n < vStates.size(); ++n)
                         {
+                            /* Skip over registers erased since our page was listed. */
+                            if(vStates[n].IsNull())
+                                continue;
+
                             /* Parse our object now. */
-                            if(rObject.second.nType == TAO::Register::REGISTER::OBJECT && !rObject.second.Parse())
+                            TAO::Register::Object rObject(vStates[n]);
+                            if(rObject.nType == TAO::Register::REGISTER::OBJECT && !rObject.Parse())
                                 continue;
 
                             /* Check our object standards. */
-                            if(!CheckStandard(jParams, rObject.second))
+                            if(!CheckStandard(jParams, rObject))
                                 continue;
 
-                            /* Populate the response */
-                            encoding::json jRegister =
-                                StandardToJSON(jParams, rObject.second, rObject.first);
-
-                            /* Insert into our return value. */
-                            jRet.push_back(jRegister);
+                            /* Stop once our plan has enough. */
+                            if(!tPlan.Insert(rObject, vAddresses[n]))
+                                break;
                         }
                     }
                 }
-                else
+
+                /* Special handle if address indexed. */
+                else if(config::fIndexAddress.load())
                 {
-                    /* Batch read up to 1000 at a time */
-                    std::vector<TAO::Register::Object> vObjects;
-                    if(LLD::Register->BatchRead(strStandard, vObjects, -1))
+                    /* Check each register as it is read, stopping once our plan has enough. */
+                    LLD::Register->BatchRead<std::pair<uint256_t, TAO::Register::Object>>(strStandard + "_address",
+                        [&](std::pair<uint256_t, TAO::Register::Object>& rObject)
                     {
-                        /* Add the register data to the response */
-                        for(auto& rObject : vObjects)
-                        {
-                            /* Parse our object now. */
-                            if(rObject.nType == TAO::Register::REGISTER::OBJECT && !rObject.Parse())
-                                continue;
+                        /* Parse our object now. */
+                        if(rObject.second.nType == TAO::Register::REGISTER::OBJECT && !rObject.second.Parse())
+                            return true;
 
-                            /* Check our object standards. */
-                            if(!CheckStandard(jParams, rObject))
-                                continue;
+                        /* Check our object standards. */
+                        if(!CheckStandard(jParams, rObject.second))
+                            return true;
+
+                        return tPlan.Insert(rObject.second, rObject.first);
+                    });
+                }
+                else
+                {
+                    /* Check each register as it is read, stopping once our plan has enough. */
+                    LLD::Register->BatchRead<TAO::Register::Object>(strStandard,
+                        [&](TAO::Register::Object& rObject)
+                    {
+                        /* Parse our object now. */
+                        if(rObject.nType == TAO::Register::REGISTER::OBJECT && !rObject.Parse())
+                            return true;
 
-                            /* Populate the response */
-                            encoding::json jRegister =
-                                StandardToJSON(jParams, rObject);
+                        /* Check our object standards. */
+                        if(!CheckStandard(jParams, rObject))
+                            return true;
 
-                            /* Insert into our return value. */
-                            jRet.push_back(jRegister);
-                        }
-                    }
+                        return tPlan.Insert(rObject);
+                    });
                 }
             }
+            catch(const Exception& e){ throw; } //errors in our query go back to the caller
             catch(const std::exception& e){ debug::warning("Exception: ", e.what()); }
         }
 
-        return jRet;
+        return tPlan.Results();
     }
 }
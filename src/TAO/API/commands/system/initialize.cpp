@@ -78,6 +78,20 @@ namespace TAO
             );
 
 
+            /* Handle for get/workers. */
+            mapFunctions["get/workers"] = Function
+            (
+                std::bind
+                (
+                    &System::GetWorkers,
+                    this,
+                    std::placeholders::_1,
+                    std::placeholders::_2
+                )
+                , ENABLE::FILTERS
+            );
+
+
             /* Handle for get/info. */
             mapFunctions["stop"] = Function
             (
@@ -18,6 +18,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/difficulty.h>
 #include <TAO/Ledger/include/retarget.h>
 #include <TAO/Ledger/include/supply.h>
+#include <TAO/Ledger/types/sigcache.h>
 
 #include <TAO/Register/types/object.h>
 
@@ -58,209 +59,95 @@ namespace TAO::API
         uint64_t nTotalObjects = 0;
         uint64_t nTotalTokenized = 0;
 
-        /* Special handle if address indexed. */
-        if(config::fIndexAddress.load())
-        {
-            /* Batch read all trust keys. */
-            std::vector<std::pair<uint256_t, TAO::Register::Object>> vTrust;
-            if(LLD::Register->BatchRead("trust_address", vTrust, -1))
-            {
-                /* Check through all trust accounts. */
-                for(auto& object : vTrust)
-                {
-                    /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
-                    if(!object.second.Parse())
-                        continue;
-
-                    /* Increment total register. */
-                    ++nTotalRegisters;
-
-                    /* Check stake value over 0. */
-                    if(object.second.get<uint64_t>("stake") == 0)
-                        continue;
-
-                    /* Update stake amount. */
-                    nTotalStake += object.second.get<uint64_t>("stake");
-                    nTotalTrust += object.second.get<uint64_t>("trust");
-                    nTotalTrustKeys++;
-                }
-            }
-        }
-        else
+        /* Read all trust keys. */
+        std::vector<TAO::Register::Object> vTrust;
+        if(read_registers("trust", vTrust))
         {
-            /* Batch read all trust keys. */
-            std::vector<TAO::Register::Object> vTrust;
-            if(LLD::Register->BatchRead("trust", vTrust, -1))
+            /* Check through all trust accounts. */
+            for(auto& object : vTrust)
             {
-                /* Check through all trust accounts. */
-                for(auto& object : vTrust)
-                {
-                    /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
-                    if(!object.Parse())
-                        continue;
+                /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
+                if(!object.Parse())
+                    continue;
 
-                    /* Increment total register. */
-                    ++nTotalRegisters;
+                /* Increment total register. */
+                ++nTotalRegisters;
 
-                    /* Check stake value over 0. */
-                    if(object.get<uint64_t>("stake") == 0)
-                        continue;
+                /* Check stake value over 0. */
+                if(object.get<uint64_t>("stake") == 0)
+                    continue;
 
-                    /* Update stake amount. */
-                    nTotalStake += object.get<uint64_t>("stake");
-                    nTotalTrust += object.get<uint64_t>("trust");
-                    nTotalTrustKeys++;
-                }
+                /* Update stake amount. */
+                nTotalStake += object.get<uint64_t>("stake");
+                nTotalTrust += object.get<uint64_t>("trust");
+                nTotalTrustKeys++;
             }
         }
 
 
-
-        /* Special handle if address indexed. */
-        if(config::fIndexAddress.load())
-        {
-            /* Batch read all names. */
-            std::vector<std::pair<uint256_t, TAO::Register::Object>> vNames;
-            if(LLD::Register->BatchRead("name_address", vNames, -1))
-            {
-                /* Check through all names. */
-                for(auto& object : vNames)
-                {
-                    /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
-                    if(!object.second.Parse())
-                        continue;
-
-                    /* Increment total register. */
-                    ++nTotalRegisters;
-
-                    /* global */
-                    if(object.second.get<std::string>("namespace") == TAO::Register::NAMESPACE::GLOBAL)
-                        nTotalGlobalNames++;
-
-                    /* namespaced */
-                    else if(object.second.get<std::string>("namespace") != "")
-                        nTotalNamespacedNames ++;
-
-                    /* Update count*/
-                    nTotalNames++;
-                }
-            }
-        }
-        else
+        /* Read all names. */
+        std::vector<TAO::Register::Object> vNames;
+        if(read_registers("name", vNames))
         {
-            /* Batch read all names. */
-            std::vector<TAO::Register::Object> vNames;
-            if(LLD::Register->BatchRead("name", vNames, -1))
+            /* Check through all names. */
+            for(auto& object : vNames)
             {
-                /* Check through all names. */
-                for(auto& object : vNames)
-                {
-                    /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
-                    if(!object.Parse())
-                        continue;
+                /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
+                if(!object.Parse())
+                    continue;
 
-                    /* Increment total register. */
-                    ++nTotalRegisters;
+                /* Increment total register. */
+                ++nTotalRegisters;
 
-                    /* global */
-                    if(object.get<std::string>("namespace") == TAO::Register::NAMESPACE::GLOBAL)
-                        nTotalGlobalNames++;
+                /* global */
+                if(object.get<std::string>("namespace") == TAO::Register::NAMESPACE::GLOBAL)
+                    nTotalGlobalNames++;
 
-                    /* namespaced */
-                    else if(object.get<std::string>("namespace") != "")
-                        nTotalNamespacedNames ++;
+                /* namespaced */
+                else if(object.get<std::string>("namespace") != "")
+                    nTotalNamespacedNames ++;
 
-                    /* Update count*/
-                    nTotalNames++;
-                }
+                /* Update count*/
+                nTotalNames++;
             }
         }
 
 
-
-        /* Special handle if address indexed. */
-        if(config::fIndexAddress.load())
+        /* Read all object registers. */
+        std::vector<TAO::Register::Object> vObjects;
+        if(read_registers("object", vObjects))
         {
-            /* Batch read all object registers. */
-            std::vector<std::pair<uint256_t, TAO::Register::Object>> vObjects;
-            if(LLD::Register->BatchRead("object_address", vObjects, -1))
+            /* Check through all names. */
+            for(auto& object : vObjects)
             {
-                /* Check through all names. */
-                for(auto& object : vObjects)
-                {
-                    /* Increment total register. */
-                    ++nTotalRegisters;
+                /* Increment total register. */
+                ++nTotalRegisters;
 
-                    /* Check if tokenized*/
-                    if(TAO::Register::Address(object.second.hashOwner).IsToken())
-                        nTotalTokenized++;
+                /* Check if tokenized*/
+                if(TAO::Register::Address(object.hashOwner).IsToken())
+                    nTotalTokenized++;
 
-                    /* Update count*/
-                    nTotalObjects++;
-                }
-            }
-        }
-        else
-        {
-            /* Batch read all object registers. */
-            std::vector<TAO::Register::Object> vObjects;
-            if(LLD::Register->BatchRead("object", vObjects, -1))
-            {
-                /* Check through all names. */
-                for(auto& object : vObjects)
-                {
-                    /* Increment total register. */
-                    ++nTotalRegisters;
-
-                    /* Check if tokenized*/
-                    if(TAO::Register::Address(object.hashOwner).IsToken())
-                        nTotalTokenized++;
-
-                    /* Update count*/
-                    nTotalObjects++;
-                }
+                /* Update count*/
+                nTotalObjects++;
             }
         }
 
         /* Check by unique owners. */
         std::set<uint256_t> setOwners;
 
-        /* Special handle if address indexed. */
-        if(config::fIndexAddress.load())
-        {
-            /* Batch read all object registers. */
-            std::vector<std::pair<uint256_t, TAO::Register::Object>> vCrypto;
-            if(LLD::Register->BatchRead("crypto_address", vCrypto, -1))
-            {
-                /* Check through all names. */
-                for(auto& rObject : vCrypto)
-                {
-                    /* Increment total register. */
-                    ++nTotalRegisters;
-
-                    /* Use a set to get unique owners. */
-                    setOwners.insert(rObject.second.hashOwner);
-                    ++nTotalCrypto;
-                }
-
-            }
-        }
-        else
+        /* Read all crypto registers. */
+        std::vector<TAO::Register::Object> vCrypto;
+        if(read_registers("crypto", vCrypto))
         {
-            /* Batch read all object registers. */
-            std::vector<TAO::Register::Object> vCrypto;
-            if(LLD::Register->BatchRead("crypto", vCrypto, -1))
+            /* Check through all names. */
+            for(auto& rObject : vCrypto)
             {
-                /* Check through all names. */
-                for(auto& rObject : vCrypto)
-                {
-                    /* Increment total register. */
-                    ++nTotalRegisters;
+                /* Increment total register. */
+                ++nTotalRegisters;
 
-                    /* Use a set to get unique owners. */
-                    setOwners.insert(rObject.hashOwner);
-                    ++nTotalCrypto;
-                }
+                /* Use a set to get unique owners. */
+                setOwners.insert(rObject.hashOwner);
+                ++nTotalCrypto;
             }
         }
 
@@ -305,6 +192,16 @@ namespace TAO::API
         /* Add sig chain metrics */
         jRet["sigchains"] = setOwners.size();
 
+        /* Add signature cache metrics */
+        const encoding::json jSigCache =
+        {
+            { "hits",    TAO::Ledger::sigcache.Hits()   },
+            { "misses",  TAO::Ledger::sigcache.Misses() },
+            { "entries", TAO::Ledger::sigcache.Size()   }
+        };
+
+        jRet["sigcache"] = jSigCache;
+
         /* We only need supply data when on a public network or testnet, private and hybrid do not have supply. */
         if(!config::fHybrid.load())
         {
@@ -328,7 +225,7 @@ namespace TAO::API
             /* for the ambassador/dev/fee reserves we need to add together the reserves from the last block from each of the respective channels*/
             uint64_t nAmbassador = (fHasPrime ? lastPrimeBlockState.nReleasedReserve[1] : 0) + (fHasHash ? lastHashBlockState.nReleasedReserve[1] : 0);
             uint64_t nDeveloper  = (fHasPrime ? lastPrimeBlockState.nReleasedReserve[2] : 0) + (fHasHash ? lastHashBlockState.nReleasedReserve[2] : 0);
-            uint64_t nFee        = TAO::Ledger::ChainState::tStateBest.load().nFeesBurned;
+            uint64_t nFee        = TAO::Ledger::ChainState::tStateBest.get()->nFeesBurned;
 
             jReserves["ambassador"] = double(nAmbassador) / TAO::Ledger::NXS_COIN;
             jReserves["developer"] = double(nDeveloper) / TAO::Ledger::NXS_COIN;
@@ -345,6 +242,10 @@ namespace TAO::API
     /* Returns the count of registers of the given type in the register DB */
     uint64_t System::count_registers(const std::string& strType)
     {
+        /* Use the count of our type index once it is built. */
+        if(LLD::Register->HasTypes())
+            return LLD::Register->CountTypes(strType);
+
         /* Special handle if address indexed. */
         if(config::fIndexAddress.load())
         {
@@ -361,4 +262,52 @@ namespace TAO::API
 
         return vRegisters.size();
     }
+
+
+    /* Reads every register of the given type in the register DB, from the type index once it is built. */
+    bool System::read_registers(const std::string& strType, std::vector<TAO::Register::Object> &vRegisters)
+    {
+        vRegisters.clear();
+
+        /* Read only the registers of our type from our type index. */
+        if(LLD::Register->HasTypes())
+        {
+            /* Read a page of addresses at a time. */
+            uint32_t nCursor = 0;
+            std::vector<uint256_t> vAddresses;
+            while(LLD::Register->ListTypes(strType, 0, vAddresses, nCursor))
+            {
+                /* Read the states of our page together. */
+                std::vector<TAO::Register::State> vStates;
+                LLD::Register->ReadState(vAddresses, vStates);
+
+                /* Skip over registers erased since our page was listed. */
+                for(const auto& rState : vStates)
+                {
+                    if(!rState.IsNull())
+                        vRegisters.push_back(TAO::Register::Object(rState));
+                }
+            }
+
+            return !vRegisters.empty();
+        }
+
+        /* Special handle if address indexed. */
+        if(config::fIndexAddress.load())
+        {
+            /* Batch read all registers with their addresses. */
+            std::vector<std::pair<uint256_t, TAO::Register::Object>> vPairs;
+            if(!LLD::Register->BatchRead(strType + "_address", vPairs, -1))
+                return false;
+
+            /* Drop the addresses we don't need. */
+            for(auto& rPair : vPairs)
+                vRegisters.push_back(std::move(rPair.second));
+
+            return !vRegisters.empty();
+        }
+
+        /* Batch read all registers. */
+        return LLD::Register->BatchRead(strType, vRegisters, -1);
+    }
 }
@@ -0,0 +1,28 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/API/types/commands/system.h>
+
+#include <LLP/include/command_pool.h>
+
+#include <Util/include/json.h>
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+    /* Returns the queue depths and latency histograms of the workers executing API and RPC commands. */
+    encoding::json System::GetWorkers(const encoding::json& jParams, const bool fHelp)
+    {
+        return LLP::CommandPool::Get().Status();
+    }
+}
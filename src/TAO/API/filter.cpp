@@ -271,6 +271,17 @@ namespace TAO::API
     }
 
 
+    /* Determines if an object should be included in a list based on input parameters and its JSON encoding. */
+    bool FilterObject(const encoding::json& jParams, encoding::json &jCheck, TAO::Register::Object &rObject)
+    {
+        /* Check for a where clause. */
+        if(jParams.find("where") == jParams.end())
+            return true; //no filters
+
+        return FilterStatement<TAO::Register::Object>(jParams["where"], jCheck, rObject, EvaluateObject);
+    }
+
+
     /* Determines if an object should be included in results list if they match parameters. */
     bool FilterResults(const encoding::json& jParams, encoding::json &jCheck)
     {
@@ -93,6 +93,21 @@ namespace TAO::API
     bool FilterObject(const encoding::json& jParams, TAO::Register::Object &rObject);
 
 
+    /** FilterObject
+     *
+     *  Determines if an object should be included in a list based on input parameters, checking results clauses
+     *  against the object encoded in JSON and object clauses against the object itself.
+     *
+     *  @param[in] jParams The input parameters for the command.
+     *  @param[out] jCheck The object encoded in JSON.
+     *  @param[out] rObject The object we are checking for.
+     *
+     *  @return true if the object should be included in the results.
+     *
+     **/
+    bool FilterObject(const encoding::json& jParams, encoding::json &jCheck, TAO::Register::Object &rObject);
+
+
     /** FilterResults
      *
      *  Determines if an object should be included in results list if they match parameters.
@@ -0,0 +1,560 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/API/include/check.h>
+#include <TAO/API/include/evaluate.h>
+#include <TAO/API/include/extract.h>
+#include <TAO/API/include/filter.h>
+#include <TAO/API/include/format.h>
+#include <TAO/API/include/get.h>
+#include <TAO/API/include/json.h>
+
+#include <TAO/API/types/cache.h>
+#include <TAO/API/types/exception.h>
+#include <TAO/API/types/query.h>
+
+#include <TAO/Register/include/enum.h>
+
+#include <Util/include/hex.h>
+
+#include <set>
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+    /* Fields RegisterToJSON adds from lookups or derived values, which we leave to the encoded register. */
+    const std::set<std::string> setDeferred =
+    {
+        "address", "name", "namespace", "global", "mine", "register", "ticker", "currentsupply", "maxsupply", "age", "rate"
+    };
+
+
+    /* Builds the plan that Base::Execute prepared in our parameters. */
+    QueryPlan::QueryPlan(const encoding::json& jParamsIn)
+    : jParams    (jParamsIn)
+    , tWhere     ( )
+    , fWhere     (false)
+    , nLimit     (0)
+    , nSort      (FIELD_MEMBER)
+    , fSorted    (false)
+    , fDesc      (true)
+    , vResults   ( )
+    , mapResults ( )
+    {
+        /* Without a plan we keep every register we are given. */
+        if(!CheckRequest(jParams, "plan", "object"))
+            return;
+
+        /* Get a reference of our plan. */
+        const encoding::json& jPlan = jParams["request"]["plan"];
+
+        /* Compile our where clause once for every register we check. */
+        fWhere = jPlan["where"].get<bool>();
+        if(fWhere)
+            tWhere = Compile(jParams["where"]);
+
+        /* Grab our limits and sorting. */
+        nLimit  = jPlan["limit"].get<uint64_t>();
+        fSorted = jPlan["sorted"].get<bool>();
+        fDesc   = (jPlan["order"].get<std::string>() == "desc");
+
+        /* Check if we sort by a header we can read from the raw object. */
+        const std::string strColumn = jPlan["column"].get<std::string>();
+        if(strColumn == "modified")
+            nSort = FIELD_MODIFIED;
+
+        else if(strColumn == "created")
+            nSort = FIELD_CREATED;
+
+        else if(strColumn == "version")
+            nSort = FIELD_VERSION;
+
+        /* Results sorted by any other column need all of them encoded to be sorted after. */
+        if(fSorted && nSort == FIELD_MEMBER)
+            nLimit = 0;
+    }
+
+
+    /* Adds a plan to the parameters for a function to apply while it reads, if there is anything to plan. */
+    bool QueryPlan::Prepare(encoding::json &jParams, const uint8_t nSettings, const std::string& strDefaultColumn)
+    {
+        /* Check for a where clause that would be applied to the results. */
+        const bool fWhere =
+            (nSettings & ENABLE::QUERIES) && jParams.find("where") != jParams.end();
+
+        /* Operators and fieldnames are applied to every result, so we can only limit plain pages. */
+        uint64_t nLimit = 0;
+        if((nSettings & ENABLE::PAGING)
+        && !((nSettings & ENABLE::OPERATORS) && CheckRequest(jParams, "operator", "string, array"))
+        && !((nSettings & ENABLE::FILTERS)   && CheckRequest(jParams, "fieldname", "string, array")))
+        {
+            /* Number of results to return. */
+            uint32_t nPage = 100, nOffset = 0;
+            ExtractList(jParams, nPage, nOffset);
+
+            /* We need every result up to the end of our page. */
+            nLimit = uint64_t(nPage) + nOffset;
+        }
+
+        /* Check that we have anything to plan. */
+        if(!fWhere && nLimit == 0)
+            return false;
+
+        /* Get the sorting that will be applied to the results. */
+        std::string strOrder = "desc", strColumn = strDefaultColumn;
+        if(nSettings & ENABLE::SORTING)
+            ExtractSort(jParams, strOrder, strColumn);
+
+        /* Unfiltered pages sorted by a member column need every register encoded to be sorted, so functions that
+         * cache are better served by their cached full dataset, which answers every page after the first. */
+        const bool fHeader = (strColumn == "created" || strColumn == "modified" || strColumn == "version");
+        if(!fWhere && (nSettings & ENABLE::CACHING) && (nLimit == 0 || ((nSettings & ENABLE::SORTING) && !fHeader)))
+            return false;
+
+        /* Add our plan to the request. */
+        jParams["request"]["plan"] =
+        {
+            { "where",  fWhere                          },
+            { "limit",  nLimit                          },
+            { "sorted", bool(nSettings & ENABLE::SORTING) },
+            { "column", strColumn                       },
+            { "order",  strOrder                        }
+        };
+
+        return true;
+    }
+
+
+    /* Checks a register against the where clause and keeps it if it passes. */
+    bool QueryPlan::Insert(TAO::Register::Object& rObject, const TAO::Register::Address& hashAddress)
+    {
+        /* Check if we are keeping the best results by sort column. */
+        const bool fBest = (fSorted && nLimit > 0);
+
+        /* Skip over registers that wouldn't make our page before checking them. */
+        uint64_t nKey = 0;
+        if(fBest)
+        {
+            /* Get our sort value. */
+            nKey = Key(rObject);
+
+            /* Check against the worst result we are keeping. */
+            if(mapResults.size() >= nLimit)
+            {
+                if(fDesc && nKey <= mapResults.begin()->first)
+                    return true;
+
+                if(!fDesc && nKey >= mapResults.rbegin()->first)
+                    return true;
+            }
+        }
+        else if(Full())
+            return false;
+
+        /* Check our where clause, only encoding the register if our predicates can't decide. */
+        encoding::json jRegister;
+        if(fWhere)
+        {
+            /* Evaluate on the raw object first. */
+            const uint8_t nResult = Evaluate(tWhere, rObject);
+            if(nResult == FAILED)
+                return true;
+
+            /* Check the full statement on the encoded register. */
+            if(nResult == UNKNOWN)
+            {
+                jRegister = StandardToJSON(jParams, rObject, hashAddress);
+                if(!FilterObject(jParams, jRegister, rObject))
+                    return true;
+            }
+        }
+
+        /* Keep the best results, dropping the worst once we have enough. */
+        if(fBest)
+        {
+            mapResults.insert(std::make_pair(nKey, Entry{ rObject, hashAddress, std::move(jRegister) }));
+            if(mapResults.size() > nLimit)
+                mapResults.erase(fDesc ? mapResults.begin() : std::prev(mapResults.end()));
+
+            return true;
+        }
+
+        /* Otherwise keep them in the order they were read. */
+        vResults.push_back(Entry{ rObject, hashAddress, std::move(jRegister) });
+
+        return !Full();
+    }
+
+
+    /* Checks if we have all the results we need so reading can stop. */
+    bool QueryPlan::Full() const
+    {
+        /* Sorted results are only complete once every register has been read. */
+        if(fSorted || nLimit == 0)
+            return false;
+
+        return (vResults.size() >= nLimit);
+    }
+
+
+    /* Gets the owner the where clause requires every result to have, so registers can be read by owner. */
+    bool QueryPlan::Owner(uint256_t &hashOwner) const
+    {
+        /* Without a where clause any owner passes. */
+        if(!fWhere)
+            return false;
+
+        return Owner(tWhere, hashOwner);
+    }
+
+
+    /* Encodes the registers that passed into JSON. */
+    encoding::json QueryPlan::Results()
+    {
+        /* Encode any registers we haven't already. */
+        encoding::json jRet = encoding::json::array();
+        const auto fnEncode = [&](Entry& tEntry)
+        {
+            /* Check if we encoded it for our where clause. */
+            if(tEntry.jRegister.is_null())
+                tEntry.jRegister = StandardToJSON(jParams, tEntry.tObject, tEntry.hashAddress);
+
+            jRet.emplace_back(std::move(tEntry.jRegister));
+        };
+
+        /* Add the results in the order they were read. */
+        for(auto& tEntry : vResults)
+            fnEncode(tEntry);
+
+        /* Add the best results in their sorted order. */
+        if(fDesc)
+        {
+            for(auto it = mapResults.rbegin(); it != mapResults.rend(); ++it)
+                fnEncode(it->second);
+        }
+        else
+        {
+            for(auto it = mapResults.begin(); it != mapResults.end(); ++it)
+                fnEncode(it->second);
+        }
+
+        return jRet;
+    }
+
+
+    /* Compiles a statement of the where clause. */
+    QueryPlan::Node QueryPlan::Compile(const encoding::json& jStatement)
+    {
+        /* Handle for a group of statements. */
+        Node tNode;
+        if(jStatement.find("statement") != jStatement.end())
+        {
+            /* Grab our logical operator. */
+            tNode.strLogical = "NONE";
+            if(jStatement.find("logical") != jStatement.end())
+                tNode.strLogical = jStatement["logical"].get<std::string>();
+
+            /* Compile our statements recursively. */
+            for(const auto& jClause : jStatement["statement"])
+                tNode.vNodes.push_back(Compile(jClause));
+
+            return tNode;
+        }
+
+        /* Malformed clauses are left to the full statement to report. */
+        tNode.fClause = true;
+        tNode.jClause = jStatement;
+        if(!CheckParameter(jStatement, "class", "string") || !CheckParameter(jStatement, "field", "string"))
+            return tNode;
+
+        /* Results are filtered on their encoding, which rejects object clauses the same way. */
+        const std::string strClass = jStatement["class"].get<std::string>();
+        if(strClass == "object")
+            throw Exception(-56, "Query Syntax Error: cannot mix [results] with [", strClass, "]");
+
+        /* Check that we are on the results and not a nested field. */
+        tNode.strField = jStatement["field"].get<std::string>();
+        if(strClass != "results" || tNode.strField.find(".") != tNode.strField.npos)
+            return tNode;
+
+        /* Fields that need lookups are left to the encoded register. */
+        if(setDeferred.count(tNode.strField))
+            return tNode;
+
+        /* Find the field we are reading. */
+        if(tNode.strField == "owner")
+            tNode.nField = FIELD_OWNER;
+
+        else if(tNode.strField == "version")
+            tNode.nField = FIELD_VERSION;
+
+        else if(tNode.strField == "created")
+            tNode.nField = FIELD_CREATED;
+
+        else if(tNode.strField == "modified")
+            tNode.nField = FIELD_MODIFIED;
+
+        else if(tNode.strField == "type" || tNode.strField == "form")
+            tNode.nField = FIELD_TYPES;
+
+        else
+            tNode.nField = FIELD_MEMBER;
+
+        return tNode;
+    }
+
+
+    /* Gets the owner a compiled statement requires to pass. */
+    bool QueryPlan::Owner(const Node& tNode, uint256_t &hashOwner)
+    {
+        /* Check for an exact match on our owner. */
+        if(tNode.fClause)
+        {
+            /* Check that we are reading the owner. */
+            if(tNode.nField != FIELD_OWNER || !CheckParameter(tNode.jClause, "operator", "string"))
+                return false;
+
+            /* Check for an exact match, wildcards can match more than one owner. */
+            if(tNode.jClause["operator"].get<std::string>() != "=" || !CheckParameter(tNode.jClause, "value", "string"))
+                return false;
+
+            /* Owners are encoded as full hex strings. */
+            const std::string strOwner = tNode.jClause["value"].get<std::string>();
+            if(strOwner.size() != 64 || !IsHex(strOwner))
+                return false;
+
+            hashOwner.SetHex(strOwner);
+            return true;
+        }
+
+        /* Check that we have statements to check. */
+        if(tNode.vNodes.empty())
+            return false;
+
+        /* Every statement of an AND must pass, so any of them can require the owner. */
+        if(tNode.strLogical == "AND")
+        {
+            for(const auto& tStatement : tNode.vNodes)
+            {
+                if(Owner(tStatement, hashOwner))
+                    return true;
+            }
+
+            return false;
+        }
+
+        /* Without a logical operator only our first statement is checked. */
+        if(tNode.strLogical == "NONE")
+            return Owner(tNode.vNodes[0], hashOwner);
+
+        return false;
+    }
+
+
+    /* Evaluates a compiled statement on a raw object. */
+    uint8_t QueryPlan::Evaluate(const Node& tNode, TAO::Register::Object& rObject)
+    {
+        /* Check for a clause at the final level of recursion. */
+        if(tNode.fClause)
+        {
+            /* Check for a field we can't read. */
+            if(tNode.nField == FIELD_DEFERRED)
+                return UNKNOWN;
+
+            /* Read the field into an object the same shape as the encoded register. */
+            encoding::json jField = encoding::json::object();
+            if(!Field(tNode, rObject, jField))
+                return UNKNOWN;
+
+            return EvaluateResults(tNode.jClause, jField) ? PASSED : FAILED;
+        }
+
+        /* Evaluate our statements in the same order as FilterStatement. */
+        uint8_t nResult = PASSED;
+        for(uint32_t n = 0; n < tNode.vNodes.size(); ++n)
+        {
+            /* If first iteration, set the result by evalute. */
+            if(n == 0)
+            {
+                nResult = Evaluate(tNode.vNodes[n], rObject);
+                continue;
+            }
+
+            /* Handle for an AND operator, unknown unless either side failed. */
+            if(tNode.strLogical == "AND")
+            {
+                if(nResult == FAILED)
+                    continue;
+
+                const uint8_t nNext = Evaluate(tNode.vNodes[n], rObject);
+                if(nNext != PASSED)
+                    nResult = nNext;
+
+                continue;
+            }
+
+            /* Handle for an OR operator, unknown unless either side passed. */
+            if(tNode.strLogical == "OR")
+            {
+                if(nResult == PASSED)
+                    continue;
+
+                const uint8_t nNext = Evaluate(tNode.vNodes[n], rObject);
+                if(nNext != FAILED)
+                    nResult = nNext;
+
+                continue;
+            }
+        }
+
+        return nResult;
+    }
+
+
+    /* Reads a results field from a raw object the way RegisterToJSON encodes it. */
+    bool QueryPlan::Field(const Node& tNode, const TAO::Register::Object& rObject, encoding::json &jField)
+    {
+        /* Get a reference of our field name. */
+        const std::string& strField = tNode.strField;
+
+        /* Data members are encoded after the headers, so they replace them. */
+        if(rObject.nType == TAO::Register::REGISTER::OBJECT && rObject.Check(strField))
+        {
+            /* Get the type of our member. */
+            uint8_t nType = 0;
+            rObject.Type(strField, nType);
+
+            /* Encode it the same way as MembersToJSON. */
+            switch(nType)
+            {
+                case TAO::Register::TYPES::UINT8_T:
+                    jField[strField] = rObject.get<uint8_t>(strField);
+                    return true;
+
+                case TAO::Register::TYPES::UINT16_T:
+                {
+                    /* Our system usertype is never encoded. */
+                    if(strField != "_usertype")
+                        jField[strField] = rObject.get<uint16_t>(strField);
+
+                    return true;
+                }
+
+                case TAO::Register::TYPES::UINT32_T:
+                    jField[strField] = rObject.get<uint32_t>(strField);
+                    return true;
+
+                case TAO::Register::TYPES::UINT64_T:
+                {
+                    /* Balances are encoded in their token's decimals. */
+                    const uint64_t nValue = rObject.get<uint64_t>(strField);
+                    if(strField == "balance" || strField == "stake")
+                        jField[strField] = FormatBalance(nValue, GetDecimals(rObject));
+
+                    /* Supply is encoded as current and max supply instead. */
+                    else if(strField != "supply")
+                        jField[strField] = nValue;
+
+                    return true;
+                }
+
+                case TAO::Register::TYPES::UINT256_T:
+                {
+                    /* Tokens are encoded as their address. */
+                    const uint256_t hashValue = rObject.get<uint256_t>(strField);
+                    if(strField == "token")
+                        jField[strField] = TAO::Register::Address(hashValue).ToString();
+                    else
+                        jField[strField] = hashValue.GetHex();
+
+                    return true;
+                }
+
+                case TAO::Register::TYPES::UINT512_T:
+                    jField[strField] = rObject.get<uint512_t>(strField).GetHex();
+                    return true;
+
+                case TAO::Register::TYPES::UINT1024_T:
+                    jField[strField] = rObject.get<uint1024_t>(strField).GetHex();
+                    return true;
+
+                case TAO::Register::TYPES::STRING:
+                {
+                    /* Strings holding json are parsed when encoded, so we leave those to the encoded register. */
+                    const std::string strValue = rObject.get<std::string>(strField);
+                    if(encoding::json::accept(strValue))
+                        return false;
+
+                    /* Remove trailing nulls from the data, which are padding to maxlength on mutable fields */
+                    jField[strField] = strValue.substr(0, strValue.find_last_not_of('\0') + 1);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /* Read our register headers. */
+        switch(tNode.nField)
+        {
+            case FIELD_OWNER:
+                jField[strField] = rObject.hashOwner.ToString();
+                return true;
+
+            case FIELD_VERSION:
+                jField[strField] = rObject.nVersion;
+                return true;
+
+            case FIELD_CREATED:
+                jField[strField] = rObject.nCreated;
+                return true;
+
+            case FIELD_MODIFIED:
+                jField[strField] = rObject.nModified;
+                return true;
+
+            case FIELD_TYPES:
+            {
+                /* Our type names don't need any lookups. */
+                encoding::json jTypes;
+                RegisterTypesToJSON(rObject, jTypes);
+
+                /* Add our field if this register has it. */
+                if(jTypes.find(strField) != jTypes.end())
+                    jField[strField] = jTypes[strField];
+
+                return true;
+            }
+        }
+
+        /* Any other field is missing from objects, but state registers encode their data by content. */
+        return (rObject.nType == TAO::Register::REGISTER::OBJECT);
+    }
+
+
+    /* Gets the value of our sort column from an object. */
+    uint64_t QueryPlan::Key(const TAO::Register::Object& rObject) const
+    {
+        /* Check for our header. */
+        switch(nSort)
+        {
+            case FIELD_CREATED:
+                return rObject.nCreated;
+
+            case FIELD_VERSION:
+                return rObject.nVersion;
+        }
+
+        return rObject.nModified;
+    }
+}
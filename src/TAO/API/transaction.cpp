@@ -209,11 +209,11 @@ namespace TAO::API
 
         /* Switch for coinbase. */
         if(IsCoinBase())
-            return (nConfirmations >= TAO::Ledger::MaturityCoinBase(TAO::Ledger::ChainState::tStateBest.load()));
+            return (nConfirmations >= TAO::Ledger::MaturityCoinBase(*TAO::Ledger::ChainState::tStateBest.get()));
 
         /* Switch for coinstake. */
         if(IsCoinStake())
-            return (nConfirmations >= TAO::Ledger::MaturityCoinStake(TAO::Ledger::ChainState::tStateBest.load()));
+            return (nConfirmations >= TAO::Ledger::MaturityCoinStake(*TAO::Ledger::ChainState::tStateBest.get()));
 
         return true; //we shouldn't get here, but if we do return true
     }
@@ -47,6 +47,7 @@ namespace TAO::API
             FILTERS   = (1 << 4), //if we want to apply filters to our results
             QUERIES   = (1 << 5), //if we want to allow queries to our results
             OPERATORS = (1 << 6), //if we want to allow computing on the dataset
+            PLANNING  = (1 << 7), //if the function applies queries and paging while reading its dataset
         };
     };
 
@@ -351,6 +352,24 @@ namespace TAO::API
             /* Make sure our cache is up to date. */
             refresh_cache();
 
+            /* Sort our data before it is cached. */
+            Sort(jParams, jCache);
+
+            /* Add to our LRU cache. */
+            mapCache.Put(jParams, jCache);
+        }
+
+
+        /** Sort
+         *
+         *  Sort data by the order and column in the parameters, if sorting is enabled.
+         *
+         *  @param[in] jParams The json formatted parameters
+         *  @param[out] jData The data that we are sorting returned by reference.
+         *
+         **/
+        void Sort(const encoding::json& jParams, encoding::json &jData)
+        {
             /* Handle here if we need to sort. */
             if(nSettings & ENABLE::SORTING)
             {
@@ -359,11 +378,8 @@ namespace TAO::API
                 ExtractSort(jParams, strOrder, strColumn);
 
                 /* Now we sort the data. */
-                sort(strOrder, strColumn, jCache);
+                sort(strOrder, strColumn, jData);
             }
-
-            /* Add to our LRU cache. */
-            mapCache.Put(jParams, jCache);
         }
 
     private:
@@ -15,6 +15,8 @@ ________________________________________________________________________________
 
 #include <TAO/API/types/base.h>
 
+#include <TAO/Register/types/object.h>
+
 /* Global TAO namespace. */
 namespace TAO::API
 {
@@ -134,6 +136,19 @@ namespace TAO::API
         encoding::json Metrics(const encoding::json& params, const bool fHelp);
 
 
+        /** GetWorkers
+         *
+         *  Returns the queue depths and latency histograms of the workers executing API and RPC commands
+         *
+         *  @param[in] params The parameters from the API call.
+         *  @param[in] fHelp Trigger for help data.
+         *
+         *  @return The return object in JSON.
+         *
+         **/
+        encoding::json GetWorkers(const encoding::json& params, const bool fHelp);
+
+
         /** GetMiningInfo
          *
          *  Returns mining-related information including enabled status, channel, height, and connections
@@ -264,5 +279,18 @@ namespace TAO::API
         **/
         uint64_t count_registers(const std::string& strType);
 
+
+        /** read_registers
+        *
+        *  Reads every register of the given type in the register DB, from the type index once it is built.
+        *
+        *  @param[in] strType the register type to read
+        *  @param[out] vRegisters the registers read, not yet parsed
+        *
+        *  @return true if any registers were read.
+        *
+        **/
+        bool read_registers(const std::string& strType, std::vector<TAO::Register::Object> &vRegisters);
+
     };
 }
@@ -0,0 +1,274 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+
+#include <TAO/Register/types/address.h>
+#include <TAO/Register/types/object.h>
+
+#include <Util/include/json.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+    /** QueryPlan
+     *
+     *  Applies the where clause, paging and sorting of a list command while its registers are read from disk, rather
+     *  than after every register has been encoded into JSON.
+     *
+     *  Base::Execute prepares the plan for functions with ENABLE::PLANNING, which build a QueryPlan from their
+     *  parameters and hand it every register they read. Clauses are compiled once into predicates that check the raw
+     *  object, reading results fields the way RegisterToJSON encodes them. Only registers the predicates can't decide
+     *  on are encoded to check the full statement. Once limit + offset registers pass, the read stops if the results
+     *  are unsorted, or keeps only the best registers by sort column if it is a register header.
+     *
+     **/
+    class QueryPlan
+    {
+        /** The outcome of evaluating a statement on a raw object. **/
+        enum : uint8_t
+        {
+            FAILED  = 0,
+            PASSED  = 1,
+            UNKNOWN = 2,
+        };
+
+
+        /** The fields we read straight from the object. **/
+        enum : uint8_t
+        {
+            FIELD_MEMBER   = 0,
+            FIELD_OWNER    = 1,
+            FIELD_VERSION  = 2,
+            FIELD_CREATED  = 3,
+            FIELD_MODIFIED = 4,
+            FIELD_TYPES    = 5,
+            FIELD_DEFERRED = 6,
+        };
+
+
+        /** A compiled statement or clause of the where clause. **/
+        struct Node
+        {
+            /** The logical operator of a statement. **/
+            std::string strLogical;
+
+            /** The statements of a group, empty for a clause. **/
+            std::vector<Node> vNodes;
+
+            /** The clause in JSON to evaluate. **/
+            encoding::json jClause;
+
+            /** Flag indicating this is a clause rather than a statement. **/
+            bool fClause = false;
+
+            /** The field the clause reads. **/
+            uint8_t nField = FIELD_DEFERRED;
+
+            /** The name of the field. **/
+            std::string strField;
+        };
+
+
+        /** A register kept for the results. **/
+        struct Entry
+        {
+            /** The register we read. **/
+            TAO::Register::Object tObject;
+
+            /** The address of the register, zero if not indexed. **/
+            TAO::Register::Address hashAddress;
+
+            /** The register in JSON if it was encoded to check the statement. **/
+            encoding::json jRegister;
+        };
+
+
+        /** The parameters of the request. **/
+        const encoding::json& jParams;
+
+
+        /** The compiled where clause. **/
+        Node tWhere;
+
+
+        /** Flag indicating we have a where clause to check. **/
+        bool fWhere;
+
+
+        /** The number of results we need, zero if we need all of them. **/
+        uint64_t nLimit;
+
+
+        /** The header field we keep the best results by, FIELD_MEMBER if not sorting by a header. **/
+        uint8_t nSort;
+
+
+        /** Flag indicating our results are sorted, so we can't stop reading early. **/
+        bool fSorted;
+
+
+        /** Flag indicating we sort in descending order. **/
+        bool fDesc;
+
+
+        /** The results in order they were read. **/
+        std::vector<Entry> vResults;
+
+
+        /** The best results by sort column. **/
+        std::multimap<uint64_t, Entry> mapResults;
+
+
+    public:
+
+        /** Constructor
+         *
+         *  Builds the plan that Base::Execute prepared in our parameters.
+         *
+         *  @param[in] jParamsIn The parameters of the request.
+         *
+         **/
+        QueryPlan(const encoding::json& jParamsIn);
+
+
+        /** Prepare
+         *
+         *  Adds a plan to the parameters for a function to apply while it reads, if there is anything to plan. Functions
+         *  that cache keep their cached full dataset for unfiltered pages sorted by a member column.
+         *
+         *  @param[out] jParams The parameters of the request.
+         *  @param[in] nSettings The settings of the function.
+         *  @param[in] strDefaultColumn The column results are sorted by if not given.
+         *
+         *  @return true if the function will apply the where clause or limit, so results are partial.
+         *
+         **/
+        static bool Prepare(encoding::json &jParams, const uint8_t nSettings, const std::string& strDefaultColumn);
+
+
+        /** Insert
+         *
+         *  Checks a register against the where clause and keeps it if it passes.
+         *
+         *  @param[in] rObject The register we read, parsed if an object.
+         *  @param[in] hashAddress The address of the register, zero if not indexed.
+         *
+         *  @return false once we have all the results we need.
+         *
+         **/
+        bool Insert(TAO::Register::Object& rObject, const TAO::Register::Address& hashAddress = uint256_t(0));
+
+
+        /** Full
+         *
+         *  Checks if we have all the results we need so reading can stop.
+         *
+         *  @return true if reading can stop.
+         *
+         **/
+        bool Full() const;
+
+
+        /** Owner
+         *
+         *  Gets the owner the where clause requires every result to have, so registers can be read by owner.
+         *
+         *  @param[out] hashOwner The owner every result must have.
+         *
+         *  @return true if the where clause requires a single owner.
+         *
+         **/
+        bool Owner(uint256_t &hashOwner) const;
+
+
+        /** Results
+         *
+         *  Encodes the registers that passed into JSON.
+         *
+         *  @return The results array.
+         *
+         **/
+        encoding::json Results();
+
+
+    private:
+
+        /** Compile
+         *
+         *  Compiles a statement of the where clause.
+         *
+         *  @param[in] jStatement The statement in JSON.
+         *
+         *  @return The compiled statement.
+         *
+         **/
+        static Node Compile(const encoding::json& jStatement);
+
+
+        /** Owner
+         *
+         *  Gets the owner a compiled statement requires to pass.
+         *
+         *  @param[in] tNode The statement to check.
+         *  @param[out] hashOwner The owner the statement requires.
+         *
+         *  @return true if the statement only passes for a single owner.
+         *
+         **/
+        static bool Owner(const Node& tNode, uint256_t &hashOwner);
+
+
+        /** Evaluate
+         *
+         *  Evaluates a compiled statement on a raw object.
+         *
+         *  @param[in] tNode The statement to evaluate.
+         *  @param[in] rObject The object we are checking.
+         *
+         *  @return PASSED or FAILED, or UNKNOWN if it needs the object encoded.
+         *
+         **/
+        static uint8_t Evaluate(const Node& tNode, TAO::Register::Object& rObject);
+
+
+        /** Field
+         *
+         *  Reads a results field from a raw object the way RegisterToJSON encodes it.
+         *
+         *  @param[in] tNode The clause reading the field.
+         *  @param[in] rObject The object we are reading.
+         *  @param[out] jField The object holding the field, empty if the field is missing.
+         *
+         *  @return false if the field can only be found by encoding the object.
+         *
+         **/
+        static bool Field(const Node& tNode, const TAO::Register::Object& rObject, encoding::json &jField);
+
+
+        /** Key
+         *
+         *  Gets the value of our sort column from an object.
+         *
+         *  @param[in] rObject The object to get the value from.
+         *
+         *  @return The value of the header we sort by.
+         *
+         **/
+        uint64_t Key(const TAO::Register::Object& rObject) const;
+    };
+}
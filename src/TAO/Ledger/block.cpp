@@ -54,7 +54,7 @@ namespace TAO
         , vOffsets       ( )
         , vchBlockSig    ( )
         , vMissing       ( )
-        , vMerkleTree    ( )
+        , tMerkleTree    ( )
         , hashMissing    (0)
         , fConflicted    (false)
         {
@@ -74,7 +74,7 @@ namespace TAO
         , vOffsets       (block.vOffsets)
         , vchBlockSig    (block.vchBlockSig)
         , vMissing       (block.vMissing)
-        , vMerkleTree    (block.vMerkleTree)
+        , tMerkleTree    (block.tMerkleTree)
         , hashMissing    (block.hashMissing)
         , fConflicted    (block.fConflicted)
         {
@@ -93,7 +93,7 @@ namespace TAO
         , vOffsets       (std::move(block.vOffsets))
         , vchBlockSig    (std::move(block.vchBlockSig))
         , vMissing       (std::move(block.vMissing))
-        , vMerkleTree    (std::move(block.vMerkleTree))
+        , tMerkleTree    (std::move(block.tMerkleTree))
         , hashMissing    (std::move(block.hashMissing))
         , fConflicted    (std::move(block.fConflicted))
         {
@@ -114,7 +114,7 @@ namespace TAO
             vOffsets       = block.vOffsets;
             vchBlockSig    = block.vchBlockSig;
             vMissing       = block.vMissing;
-            vMerkleTree    = block.vMerkleTree;
+            tMerkleTree    = block.tMerkleTree;
             hashMissing    = block.hashMissing;
             fConflicted    = block.fConflicted;
 
@@ -136,7 +136,7 @@ namespace TAO
             vOffsets       = std::move(block.vOffsets);
             vchBlockSig    = std::move(block.vchBlockSig);
             vMissing       = std::move(block.vMissing);
-            vMerkleTree    = std::move(block.vMerkleTree);
+            tMerkleTree    = std::move(block.tMerkleTree);
             hashMissing    = std::move(block.hashMissing);
 
             fConflicted    = std::move(block.fConflicted);
@@ -163,7 +163,7 @@ namespace TAO
         , vOffsets       ( )
         , vchBlockSig    ( )
         , vMissing       ( )
-        , vMerkleTree    ( )
+        , tMerkleTree    ( )
         , hashMissing    (0)
         , fConflicted    (false)
         {
@@ -333,112 +333,42 @@ namespace TAO
         /* Generate the Merkle Tree from uint512_t hashes. */
         uint512_t Block::BuildMerkleTree(const std::vector<uint512_t>& vtx) const
         {
-            /* Build the in memory cache of merkle tree. */
-            vMerkleTree.clear();
-            for(const auto& hash : vtx)
-                vMerkleTree.push_back(hash);
-
-            /* Compute the merkle root. */
-            uint32_t i = 0;
-            uint32_t j = 0;
-            for(uint32_t nSize = static_cast<uint32_t>(vtx.size()); nSize > 1; nSize = (nSize + 1) >> 1)
-            {
-                for(i = 0; i < nSize; i += 2)
-                {
-                    /* get the references to the left and right leaves in the merkle tree */
-                    const uint512_t& hashLeft  = vMerkleTree[j + i];
-                    const uint512_t& hashRight = vMerkleTree[j + std::min(i + 1, nSize - 1)];
-
-                    vMerkleTree.push_back(LLC::SK512(BEGIN(hashLeft),  END(hashLeft),
-                                                     BEGIN(hashRight), END(hashRight)));
-                }
-
-                j += nSize;
-            }
-
-            return (vMerkleTree.empty() ? 0 : vMerkleTree.back());
+            /* Only the paths above leaves that changed since the last build are rehashed. */
+            return tMerkleTree.Build(vtx);
         }
 
 
         /* Generate the Merkle Tree from uint512_t hashes. */
         uint512_t Block::BuildMerkleTree(const std::vector<std::pair<uint8_t, uint512_t> >& vtx) const
         {
-            /* Build the in memory cache of merkle tree. */
-            vMerkleTree.clear();
-            for(const auto& hash : vtx)
-                vMerkleTree.push_back(hash.second);
-
-            /* Compute the merkle root. */
-            uint32_t i = 0;
-            uint32_t j = 0;
-            for(uint32_t nSize = static_cast<uint32_t>(vtx.size()); nSize > 1; nSize = (nSize + 1) / 2)
-            {
-                for(i = 0; i < nSize; i += 2)
-                {
-                    /* get the references to the left and right leaves in the merkle tree */
-                    const uint512_t& hashLeft  = vMerkleTree[j + i];
-                    const uint512_t& hashRight = vMerkleTree[j + std::min(i + 1, nSize - 1)];
-
-                    vMerkleTree.push_back(LLC::SK512(BEGIN(hashLeft),  END(hashLeft),
-                                                     BEGIN(hashRight), END(hashRight)));
-                }
+            /* Get the list of transaction hashes. */
+            std::vector<uint512_t> vHashes;
+            vHashes.reserve(vtx.size());
 
-                j += nSize;
-            }
+            for(const auto& hash : vtx)
+                vHashes.push_back(hash.second);
 
-            return (vMerkleTree.empty() ? 0 : vMerkleTree.back());
+            return tMerkleTree.Build(vHashes);
         }
 
 
         /* Get the merkle branch of a transaction at given index. */
         std::vector<uint512_t> Block::GetMerkleBranch(const std::vector<uint512_t>& vtx, uint32_t nIndex) const
         {
-            /* Build merkle tree if it's not already built. */
-            if (vMerkleTree.empty())
-                BuildMerkleTree(vtx);
-
-            /* Merkle branch to return. */
-            std::vector<uint512_t> vMerkleBranch;
-
-            /* Loop through the transactions to generate merkle path. */
-            uint32_t j = 0;
-            for (uint32_t nSize = vtx.size(); nSize > 1; nSize = (nSize + 1) / 2)
-            {
-                /* Grab the next instance from cached memory. */
-                uint32_t i = std::min(nIndex^1, nSize - 1);
-                vMerkleBranch.push_back(vMerkleTree[j + i]);
-
-                nIndex >>= 1;
-                j += nSize;
-            }
+            /* Bring the merkle tree up to date with the list. */
+            BuildMerkleTree(vtx);
 
-            return vMerkleBranch;
+            return tMerkleTree.Branch(nIndex);
         }
 
 
         /* Get the merkle branch of a transaction at given index. */
         std::vector<uint512_t> Block::GetMerkleBranch(const std::vector<std::pair<uint8_t, uint512_t>>& vtx, uint32_t nIndex) const
         {
-            /* Build merkle tree if it's not already built. */
-            if (vMerkleTree.empty())
-                BuildMerkleTree(vtx);
-
-            /* Merkle branch to return. */
-            std::vector<uint512_t> vMerkleBranch;
-
-            /* Loop through the transactions to generate merkle path. */
-            uint32_t j = 0;
-            for (uint32_t nSize = vtx.size(); nSize > 1; nSize = (nSize + 1) / 2)
-            {
-                /* Grab the next instance from cached memory. */
-                uint32_t i = std::min(nIndex^1, nSize - 1);
-                vMerkleBranch.push_back(vMerkleTree[j + i]);
-
-                nIndex >>= 1;
-                j += nSize;
-            }
+            /* Bring the merkle tree up to date with the list. */
+            BuildMerkleTree(vtx);
 
-            return vMerkleBranch;
+            return tMerkleTree.Branch(nIndex);
         }
 
 
@@ -56,7 +56,7 @@ namespace TAO
 
 
         /* The best block in the chain. */
-        memory::atomic<BlockState> ChainState::tStateBest;
+        memory::snapshot<BlockState> ChainState::tStateBest;
 
 
         /* The best block in the chain. */
@@ -363,23 +363,32 @@ namespace TAO
                     runtime::timer tElapsed;
                     tElapsed.Start();
 
+                    /* Track the hash of our last block. */
+                    uint1024_t hashLast = hashStart;
+
                     /* List our blocks via a batch read for efficiency. */
                     std::vector<TAO::Ledger::BlockState> vStates;
+                    std::vector<uint1024_t> vHashes;
                     while(!config::fShutdown.load() && hashStart != TAO::Ledger::ChainState::hashBestChain.load() &&
                         LLD::Ledger->BatchRead(hashStart, "block", vStates, 1000, true))
                     {
+                        /* Hash the whole batch of headers at once. */
+                        TAO::Ledger::BlockState::GetHashes(vStates, vHashes);
+
                         /* Loop through all available states. */
-                        for(auto& tBlock : vStates)
+                        for(uint32_t nIndex = 0; nIndex < vStates.size(); ++nIndex)
                         {
+                            auto& tBlock = vStates[nIndex];
+
                             /* Update start every iteration. */
-                            hashStart = tBlock.GetHash();
+                            hashStart = vHashes[nIndex];
 
                             /* Skip if not in main chain. */
                             if(!tBlock.IsInMainChain())
                                 continue;
 
                             /* Check for matching hashes. */
-                            if(tBlock.hashPrevBlock != tLastBlock.GetHash())
+                            if(tBlock.hashPrevBlock != hashLast)
                             {
                                 /* Read the correct block from next index. */
                                 if(!LLD::Ledger->ReadBlock(tLastBlock.hashNextBlock, tBlock))
@@ -391,6 +400,7 @@ namespace TAO
 
                             /* Cache the block hash. */
                             tLastBlock = tBlock;
+                            hashLast   = hashStart;
 
                             /* Add a meter for progress output. */
                             if(tLastBlock.nHeight % 10000 == 0)
@@ -492,8 +492,8 @@ namespace TAO::Ledger
             tBlockCache[nChannel].load();
 
         /* Cache the best chain before processing. */
-        const TAO::Ledger::BlockState tStateBest =
-            ChainState::tStateBest.load();
+        const auto pStateBest = ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& tStateBest = *pStateBest;
 
         /* Event-driven cache invalidation: check each condition individually. */
         bool fNeedsNewBlock = false;
@@ -705,6 +705,20 @@ namespace TAO::Ledger
         if(!CreateTransaction(user, pin, rProducer))
             return debug::error(FUNCTION, "Failed to create producer transactions.");
 
+        return AddProducerContracts(user, rProducer, tStateBest, nBlockVersion, nChannel, nExtraNonce, pCoinbaseRecipients, hashDynamicGenesis);
+    }
+
+
+    /* Add the producer operations to a producer transaction. */
+    bool AddProducerContracts(const memory::encrypted_ptr<TAO::Ledger::Credentials>& user,
+                              TAO::Ledger::Transaction &rProducer,
+                              const TAO::Ledger::BlockState& tStateBest,
+                              const uint32_t nBlockVersion,
+                              const uint32_t nChannel,
+                              const uint64_t nExtraNonce,
+                              Legacy::Coinbase *pCoinbaseRecipients,
+                              const uint256_t& hashDynamicGenesis)
+    {
         /* Create the Coinbase Transaction if the Channel specifies. */
         if(nChannel == 1 || nChannel == 2)
         {
@@ -880,7 +894,8 @@ namespace TAO::Ledger
             block.nVersion = nCurrent - 1;
 
         /* Cache the best chain before processing. */
-        const TAO::Ledger::BlockState tStateBest = ChainState::tStateBest.load();
+        const auto pStateBest = ChainState::tStateBest.get();
+        const TAO::Ledger::BlockState& tStateBest = *pStateBest;
 
         /* Add the transactions to the block. */
         /* Solo Genesis has no transactions, but pool Genesis does to calculate proofs (pool Genesis won't hash this block) */
@@ -1149,8 +1164,9 @@ namespace TAO::Ledger
         /* Update the producer timestamp, making sure it is not earlier than the previous block.  However we can't simply
         set the timstamp to be last block time + 1, in case there is a long gap between blocks, as there is a consensus
         rule that the producer timestamp cannot be more than 3600 seconds before the current block time. */
-        if(ChainState::tStateBest.load().GetBlockTime() + 1 > runtime::unifiedtimestamp())
-            rProducer.nTimestamp = std::max(rProducer.nTimestamp, ChainState::tStateBest.load().GetBlockTime() + 1);
+        const uint64_t nBestTime = ChainState::tStateBest.get()->GetBlockTime();
+        if(nBestTime + 1 > runtime::unifiedtimestamp())
+            rProducer.nTimestamp = std::max(rProducer.nTimestamp, nBestTime + 1);
         else
             rProducer.nTimestamp = std::max(rProducer.nTimestamp, runtime::unifiedtimestamp());
 
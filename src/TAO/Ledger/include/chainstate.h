@@ -102,7 +102,7 @@ namespace TAO
 
 
             /** The best block in the chain. **/
-            extern memory::atomic<BlockState> tStateBest;
+            extern memory::snapshot<BlockState> tStateBest;
 
 
             /** The best block in the chain. **/
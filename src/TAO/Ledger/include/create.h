@@ -78,6 +78,33 @@ namespace TAO
                                const uint256_t& hashDynamicGenesis = uint256_t(0));
 
 
+        /** AddProducerContracts
+         *
+         *  Add the producer operations to a producer transaction created by CreateTransaction.
+         *
+         *  This is the part of a producer that differs per miner (reward routing and extra nonce),
+         *  so a producer can be created once and have its contracts added for each miner.
+         *
+         *  @param[in] user The signature chain that generated this tx
+         *  @param[out] tx The producer transaction to add contracts to
+         *  @param[in] tStateBest The current best block state
+         *  @param[in] nBlockVersion The block version the producer is being created for
+         *  @param[in] nChannel The channel to create block for.
+         *  @param[in] nExtraNonce An extra nonce to use for double iterating.
+         *  @param[in] pCoinbaseRecipients The coinbase recipients, if any.
+         *  @param[in] hashDynamicGenesis Reward recipient (genesis hash OR register address, 0 = use user genesis)
+         *
+         **/
+        bool AddProducerContracts(const memory::encrypted_ptr<TAO::Ledger::Credentials>& user,
+                                  TAO::Ledger::Transaction& tx,
+                                  const TAO::Ledger::BlockState& tStateBest,
+                                  const uint32_t nBlockVersion,
+                                  const uint32_t nChannel,
+                                  const uint64_t nExtraNonce,
+                                  Legacy::Coinbase *pCoinbaseRecipients = nullptr,
+                                  const uint256_t& hashDynamicGenesis = uint256_t(0));
+
+
 
         /** AddTransactions
          *
@@ -25,6 +25,10 @@ namespace TAO
     namespace Ledger
     {
 
+        /** The number of prime cluster candidates verified in one batch. **/
+        const uint32_t PRIME_CLUSTER_BATCH = 16;
+
+
         /** SetBits
          *
          *  Convert Double to unsigned int Representative.
@@ -102,9 +106,24 @@ namespace TAO
         bool PrimeCheck(const uint1024_t& hashTest);
 
 
+        /** PrimeCluster
+         *
+         *  Checks the candidates of a prime cluster, running the base 2 fermat test of every
+         *  candidate before any of the Miller-Rabin rounds.
+         *
+         *  @param[in] pCandidates The numbers to test for primality.
+         *  @param[in] nCount The number of candidates, up to PRIME_CLUSTER_BATCH.
+         *
+         *  @return The number of candidates that pass the prime tests.
+         *
+         **/
+        uint32_t PrimeCluster(const uint1024_t* pCandidates, const uint32_t nCount);
+
+
         /** FermatTest
          *
-         *  Used after Miller-Rabin and Divisor tests to verify primality.
+         *  Used after Divisor tests to verify primality, before Miller-Rabin.
+         *  Odd numbers use the fixed width montgomery kernel of LLC/prime/fermat.h.
          *
          *  @param[in] hashTest The prime to check
          *
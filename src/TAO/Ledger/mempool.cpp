@@ -44,13 +44,11 @@ namespace TAO
         /** Default Constructor. **/
         Mempool::Mempool()
         : MUTEX              ( )
-        , mapLegacy          ( )
-        , mapLegacyConflicts ( )
-        , mapLedger          ( )
-        , mapConflicts       ( )
+        , INPUTS_MUTEX       ( )
+        , vShards            ( )
+        , vGenesis           ( )
         , mapOrphans         ( )
         , mapClaimed         ( )
-        , mapRejected        ( )
         , mapInputs          ( )
         , setOrphansByIndex  ( )
         {
@@ -69,14 +67,17 @@ namespace TAO
             /* Get the transaction hash. */
             const uint512_t hashTx = tx.GetHash();
 
-            RECURSIVE(MUTEX);
+            /* Add to the shard if not already in the mempool. */
+            {
+                Shard& rShard = shard(hashTx);
+                WRITE_LOCK(rShard.MUTEX);
 
-            /* Check the mempool. */
-            if(mapLedger.count(hashTx))
-                return false;
+                if(!rShard.mapLedger.emplace(hashTx, tx).second)
+                    return false;
+            }
 
-            /* Add to the map. */
-            mapLedger[hashTx] = tx;
+            /* Add to the genesis index. */
+            index(tx.hashGenesis, hashTx);
 
             return true;
         }
@@ -85,38 +86,19 @@ namespace TAO
         /* Accepts a transaction with validation rules. */
         bool Mempool::Accept(const TAO::Ledger::Transaction& tx, LLP::TritiumNode* pnode)
         {
-            RECURSIVE(MUTEX);
-
             /* Get the transaction hash. */
-            uint512_t hashTx = tx.GetHash();
+            const uint512_t hashTx = tx.GetHash();
 
             try
             {
-                /* Check for transaction on disk. */
-                if(mapLedger.count(hashTx))
+                /* Check for transaction in pool before anything else, relays of known transactions are the common case. */
+                if(has(hashTx))
                     return false; //NOTE: this was true, but changed to false to prevent relay loops in tritium LLP
 
-                /* Keep adding penalties if we have consecutive orphans. */
-                if(mapOrphans.count(tx.hashPrevTx))
-                {
-                    /* Increment consecutive orphans. */
-                    if(pnode)
-                    {
-                        /* Increment our consecutive orphans here. */
-                        ++pnode->nConsecutiveOrphans;
-
-                        /* Add an additional DDOS penalty. */
-                        if(pnode->DDOS)
-                            pnode->DDOS->rSCORE += 1;
-                    }
-
-                    return false;
-                }
-
                 /* Check for rejected tx. */
-                if(mapRejected.count(tx.hashPrevTx))
+                if(rejected(tx.hashPrevTx))
                 {
-                    mapRejected.insert(hashTx);
+                    reject(hashTx);
                     return false;
                 }
 
@@ -131,31 +113,55 @@ namespace TAO
                 /* Check for duplicate coinbase or coinstake. */
                 if(tx.IsCoinBase())
                 {
-                    mapRejected.insert(hashTx);
+                    reject(hashTx);
                     return debug::error(FUNCTION, "coinbase ", hashTx.SubString(), " not accepted in pool");
                 }
 
                 /* Check for duplicate coinbase or coinstake. */
                 if(tx.IsCoinStake())
                 {
-                    mapRejected.insert(hashTx);
+                    reject(hashTx);
                     return debug::error(FUNCTION, "coinstake ", hashTx.SubString(), " not accepted in pool");
                 }
 
                 /* Check for duplicate coinbase or coinstake. */
                 if(tx.IsHybrid())
                 {
-                    mapRejected.insert(hashTx);
+                    reject(hashTx);
                     return debug::error(FUNCTION, "hybrid ", hashTx.SubString(), " not accepted in pool");
                 }
 
-                /* Check that the transaction is in a valid state. */
+                /* Check that the transaction is in a valid state, this is stateless so is done outside of admission. */
                 if(!tx.Check())
                 {
-                    mapRejected.insert(hashTx);
+                    reject(hashTx);
                     return debug::error(FUNCTION, "tx ", hashTx.SubString(), " REJECTED: ", debug::GetLastError());
                 }
 
+                /* Everything from here links to other transactions in the pool. */
+                RECURSIVE(MUTEX);
+
+                /* Check again now that we hold admission, another thread could have accepted it while we checked. */
+                if(has(hashTx))
+                    return false;
+
+                /* Keep adding penalties if we have consecutive orphans. */
+                if(mapOrphans.count(tx.hashPrevTx))
+                {
+                    /* Increment consecutive orphans. */
+                    if(pnode)
+                    {
+                        /* Increment our consecutive orphans here. */
+                        ++pnode->nConsecutiveOrphans;
+
+                        /* Add an additional DDOS penalty. */
+                        if(pnode->DDOS)
+                            pnode->DDOS->rSCORE += 1;
+                    }
+
+                    return false;
+                }
+
                 /* Check for orphans and conflicts when not first transaction. */
                 if(!tx.IsFirst())
                 {
@@ -182,12 +188,21 @@ namespace TAO
                         return false;
                     }
 
+                    /* Check if previous transaction is conflicted. */
+                    bool fConflicted = false;
+                    {
+                        Shard& rShard = shard(tx.hashPrevTx);
+                        SHARED_LOCK(rShard.MUTEX);
+
+                        fConflicted = rShard.mapConflicts.count(tx.hashPrevTx);
+                    }
+
                     /* Check for conflicts. */
-                    if(mapClaimed.count(tx.hashPrevTx) || mapConflicts.count(tx.hashPrevTx))
+                    if(mapClaimed.count(tx.hashPrevTx) || fConflicted)
                     {
                         /* Add to conflicts map. */
                         debug::error(FUNCTION, "CONFLICT: prev tx ", (mapClaimed.count(tx.hashPrevTx) ? "CLAIMED " : "CONFLICTED "), tx.hashPrevTx.SubString());
-                        mapConflicts[hashTx] = tx;
+                        conflict(hashTx, tx);
 
                         return false;
                     }
@@ -202,7 +217,7 @@ namespace TAO
                     {
                         /* Add to conflicts map. */
                         debug::error(FUNCTION, "CONFLICT: hash last mismatch ", tx.hashPrevTx.SubString(), " and ", hashLast.SubString());
-                        mapConflicts[hashTx] = tx;
+                        conflict(hashTx, tx);
 
                         return false;
                     }
@@ -211,7 +226,7 @@ namespace TAO
                 {
                     /* Add to conflicts map. */
                     debug::error(FUNCTION, "CONFLICT: duplicate genesis-id ", tx.hashGenesis.SubString());
-                    mapConflicts[hashTx] = tx;
+                    conflict(hashTx, tx);
 
                     return false;
                 }
@@ -219,7 +234,7 @@ namespace TAO
                 /* Begin an ACID transction for internal memory commits. */
                 if(!tx.Verify(FLAGS::MEMPOOL))
                 {
-                    mapRejected.insert(hashTx);
+                    reject(hashTx);
                     return debug::error(FUNCTION, "tx ", hashTx.SubString(), " REJECTED: ", debug::GetLastError());
                 }
 
@@ -229,7 +244,7 @@ namespace TAO
                 {
                     /* Abort memory commits on failures. */
                     LLD::TxnAbort(FLAGS::MEMPOOL);
-                    mapRejected.insert(hashTx);
+                    reject(hashTx);
 
                     return debug::error(FUNCTION, "tx ", hashTx.SubString(), " REJECTED: ", debug::GetLastError());
                 }
@@ -238,7 +253,15 @@ namespace TAO
                 LLD::TxnCommit(FLAGS::MEMPOOL);
 
                 /* Set the internal memory. */
-                mapLedger[hashTx] = tx;
+                {
+                    Shard& rShard = shard(hashTx);
+                    WRITE_LOCK(rShard.MUTEX);
+
+                    rShard.mapLedger[hashTx] = tx;
+                }
+
+                /* Add to the genesis index. */
+                index(tx.hashGenesis, hashTx);
 
                 /* Update map claimed if not first tx. */
                 if(!tx.IsFirst())
@@ -270,7 +293,7 @@ namespace TAO
             }
             catch(const std::exception& e)
             {
-                mapRejected.insert(hashTx);
+                reject(hashTx);
                 return false; //debug::error(FUNCTION, "REJECTED: exception encountered ", e.what());
             }
 
@@ -297,7 +320,7 @@ namespace TAO
                 debug::log(0, FUNCTION, "PROCESSING ORPHAN tx ", hashThis.SubString());
 
                 /* Check if this is already in our mempool. */
-                if(mapLedger.count(hashTx))
+                if(has(hashTx))
                 {
                     /* Erase the transaction. */
                     mapOrphans.erase(hashTx);
@@ -333,13 +356,15 @@ namespace TAO
         /* Gets a transaction from mempool */
         bool Mempool::Get(const uint512_t& hashTx, TAO::Ledger::Transaction &tx, bool &fConflicted) const
         {
-            RECURSIVE(MUTEX);
+            Shard& rShard = shard(hashTx);
+            SHARED_LOCK(rShard.MUTEX);
 
             /* Check in conflict memory. */
-            if(mapConflicts.count(hashTx))
+            auto it = rShard.mapConflicts.find(hashTx);
+            if(it != rShard.mapConflicts.end())
             {
                 /* Get from conflicts map. */
-                tx = mapConflicts.at(hashTx);
+                tx = it->second;
                 fConflicted = true;
 
                 /* Set our internal cached hash. */
@@ -351,9 +376,10 @@ namespace TAO
             }
 
             /* Check in ledger memory. */
-            if(mapLedger.count(hashTx))
+            it = rShard.mapLedger.find(hashTx);
+            if(it != rShard.mapLedger.end())
             {
-                tx = mapLedger.at(hashTx);
+                tx = it->second;
 
                 /* Set our internal cached hash. */
                 tx.hashCache = hashTx;
@@ -368,12 +394,14 @@ namespace TAO
         /* Gets a transaction from mempool */
         bool Mempool::Get(const uint512_t& hashTx, TAO::Ledger::Transaction &tx) const
         {
-            RECURSIVE(MUTEX);
+            Shard& rShard = shard(hashTx);
+            SHARED_LOCK(rShard.MUTEX);
 
             /* Check in ledger memory. */
-            if(mapLedger.count(hashTx))
+            auto it = rShard.mapLedger.find(hashTx);
+            if(it != rShard.mapLedger.end())
             {
-                tx = mapLedger.at(hashTx);
+                tx = it->second;
 
                 /* Set our internal cached hash. */
                 tx.hashCache = hashTx;
@@ -388,18 +416,25 @@ namespace TAO
         /* Get by genesis. */
         bool Mempool::Get(const uint256_t& hashGenesis, std::vector<TAO::Ledger::Transaction> &vtx) const
         {
-            RECURSIVE(MUTEX);
+            /* Copy the txids out of the index so we don't hold two shards at once. */
+            std::vector<uint512_t> vHashes;
+            {
+                GenesisShard& rGenesis = genesis(hashGenesis);
+                SHARED_LOCK(rGenesis.MUTEX);
+
+                auto it = rGenesis.mapIndex.find(hashGenesis);
+                if(it == rGenesis.mapIndex.end())
+                    return false;
+
+                vHashes = it->second;
+            }
 
-            /* Check through the ledger map for the genesis. */
-            for(const auto& tx : mapLedger)
+            /* Get the transactions by their txid, skipping any removed since we read the index. */
+            for(const auto& hashTx : vHashes)
             {
-                /* Check for non-conflicted genesis-id's. */
-                if(tx.second.hashGenesis == hashGenesis)
-                {
-                    /* Cache our txid in here. */
-                    tx.second.hashCache = tx.first;
-                    vtx.push_back(tx.second);
-                }
+                TAO::Ledger::Transaction tx;
+                if(Get(hashTx, tx))
+                    vtx.push_back(tx);
             }
 
             /* Check that a transaction was found. */
@@ -450,23 +485,20 @@ namespace TAO
         /* Checks if a transaction exists. */
         bool Mempool::Has(const uint512_t& hashTx) const
         {
-            RECURSIVE(MUTEX);
+            Shard& rShard = shard(hashTx);
+            SHARED_LOCK(rShard.MUTEX);
 
-            return mapLedger.count(hashTx) || mapLegacy.count(hashTx) || mapConflicts.count(hashTx);
+            return rShard.mapLedger.count(hashTx) || rShard.mapLegacy.count(hashTx) || rShard.mapConflicts.count(hashTx);
         }
 
 
         /* Checks if a genesis exists. */
         bool Mempool::Has(const uint256_t& hashGenesis) const
         {
-            RECURSIVE(MUTEX);
-
-            /* Check through the ledger map for the genesis. */
-            for(const auto& tx : mapLedger)
-                if(tx.second.hashGenesis == hashGenesis)
-                    return true;
+            GenesisShard& rGenesis = genesis(hashGenesis);
+            SHARED_LOCK(rGenesis.MUTEX);
 
-            return false;
+            return rGenesis.mapIndex.count(hashGenesis);
         }
 
 
@@ -475,47 +507,61 @@ namespace TAO
         {
             RECURSIVE(MUTEX);
 
-            /* Erase from conflicted memory. */
-            if(mapConflicts.count(hashTx))
-                mapConflicts.erase(hashTx);
+            /* Erase from orphans memory. */
+            setOrphansByIndex.erase(hashTx);
 
-            /* Erase from rejected memory. */
-            if(mapRejected.count(hashTx))
-                mapRejected.erase(hashTx);
+            /* Take the transaction out of its shard. */
+            bool fLedger = false, fLegacy = false;
+            TAO::Ledger::Transaction tx;
+            Legacy::Transaction txLegacy;
+            {
+                Shard& rShard = shard(hashTx);
+                WRITE_LOCK(rShard.MUTEX);
 
-            /* Erase from legacy conflicted memory. */
-            if(mapLegacyConflicts.count(hashTx))
-                mapLegacyConflicts.erase(hashTx);
+                /* Erase from conflicted and rejected memory. */
+                rShard.mapConflicts.erase(hashTx);
+                rShard.setRejected.erase(hashTx);
+                rShard.mapLegacyConflicts.erase(hashTx);
 
-            /* Erase from orphans memory. */
-            if(setOrphansByIndex.count(hashTx))
-                setOrphansByIndex.erase(hashTx);
+                /* Find the transaction in pool. */
+                auto itLedger = rShard.mapLedger.find(hashTx);
+                if(itLedger != rShard.mapLedger.end())
+                {
+                    tx = std::move(itLedger->second);
+                    rShard.mapLedger.erase(itLedger);
 
-            /* Find the transaction in pool. */
-            if(mapLedger.count(hashTx))
-            {
-                /* Get a reference from the map. */
-                const TAO::Ledger::Transaction& tx = mapLedger[hashTx];
+                    fLedger = true;
+                }
+                else
+                {
+                    /* Find the legacy transaction in pool. */
+                    auto itLegacy = rShard.mapLegacy.find(hashTx);
+                    if(itLegacy != rShard.mapLegacy.end())
+                    {
+                        txLegacy = std::move(itLegacy->second);
+                        rShard.mapLegacy.erase(itLegacy);
+
+                        fLegacy = true;
+                    }
+                }
+            }
 
-                /* Erase from the memory map. */
+            /* Erase the links of a ledger transaction. */
+            if(fLedger)
+            {
                 mapClaimed.erase(tx.hashPrevTx);
                 mapOrphans.erase(tx.hashPrevTx);
-                mapLedger.erase(hashTx);
+                deindex(tx.hashGenesis, hashTx);
 
                 return true;
             }
 
-            /* Find the legacy transaction in pool. */
-            if(mapLegacy.count(hashTx))
+            /* Erase the claimed inputs of a legacy transaction. */
+            if(fLegacy)
             {
-                const Legacy::Transaction& tx = mapLegacy[hashTx];
-
-                /* Erase the claimed inputs */
-                uint32_t nSize = static_cast<uint32_t>(tx.vin.size());
-                for(uint32_t i = 0; i < nSize; ++i)
-                    mapInputs.erase(tx.vin[i].prevout);
-
-                mapLegacy.erase(hashTx);
+                LOCK(INPUTS_MUTEX);
+                for(const auto& vin : txLegacy.vin)
+                    mapInputs.erase(vin.prevout);
             }
 
             return false;
@@ -529,20 +575,7 @@ namespace TAO
 
             /* Create map of transactions by genesis. */
             std::map<uint256_t, std::vector<TAO::Ledger::Transaction> > mapTransactions;
-
-            /* Loop through all the transactions. */
-            for(const auto& tx : mapLedger)
-            {
-                /* Cache the genesis. */
-                const uint256_t& hashGenesis = tx.second.hashGenesis;
-
-                /* Check in map for push back. */
-                if(!mapTransactions.count(hashGenesis))
-                    mapTransactions[hashGenesis] = std::vector<TAO::Ledger::Transaction>();
-
-                /* Push to back of map. */
-                mapTransactions[hashGenesis].push_back(tx.second);
-            }
+            collect(mapTransactions, true);
 
             /* Loop transctions map by genesis. */
             for(auto& rTransaction : mapTransactions)
@@ -660,17 +693,11 @@ namespace TAO
             std::map<uint256_t, std::vector<TAO::Ledger::Transaction> > mapConflicted;
 
             /* Loop through all our conflicted transactions. */
-            for(const auto& tx : mapConflicts)
+            for(const auto& rShard : vShards)
             {
-                /* Cache the genesis. */
-                const uint256_t& hashGenesis = tx.second.hashGenesis;
-
-                /* Check in map for push back. */
-                if(!mapConflicted.count(hashGenesis))
-                    mapConflicted[hashGenesis] = std::vector<TAO::Ledger::Transaction>();
-
-                /* Push to back of map. */
-                mapConflicted[hashGenesis].push_back(tx.second);
+                SHARED_LOCK(rShard.MUTEX);
+                for(const auto& tx : rShard.mapConflicts)
+                    mapConflicted[tx.second.hashGenesis].push_back(tx.second);
             }
 
             /* Loop transctions map by genesis. */
@@ -692,7 +719,14 @@ namespace TAO
                 {
                     /* Loop through our transactions and remove them. */
                     for(const auto& tx : vtx)
-                        mapConflicts.erase(tx.GetHash());
+                    {
+                        const uint512_t hashTx = tx.GetHash();
+
+                        Shard& rShard = shard(hashTx);
+                        WRITE_LOCK(rShard.MUTEX);
+
+                        rShard.mapConflicts.erase(hashTx);
+                    }
                 }
             }
         }
@@ -701,35 +735,12 @@ namespace TAO
         /* List transactions in memory pool. */
         bool Mempool::List(std::vector<uint512_t> &vHashes, uint32_t nCount, bool fLegacy)
         {
-            RECURSIVE(MUTEX);
-
             /* If legacy flag set, skip over getting tritium transactions. */
             if(!fLegacy)
             {
-                /* Create map of transactions by genesis. */
+                /* Create map of transactions by genesis, skipping rejected transactions. */
                 std::map<uint256_t, std::vector<TAO::Ledger::Transaction> > mapTransactions;
-
-                /* Loop through all the transactions. */
-                for(const auto& tx : mapLedger)
-                {
-                    /* Check that this transaction isn't conflicted. */
-                    //if(mapConflicts.count(tx.first))
-                    //    continue;
-
-                    /* Check that this transaction hasn't been rejected. */
-                    if(mapRejected.count(tx.first))
-                        continue;
-
-                    /* Cache the genesis. */
-                    const uint256_t& hashGenesis = tx.second.hashGenesis;
-
-                    /* Check in map for push back. */
-                    if(!mapTransactions.count(hashGenesis))
-                        mapTransactions[hashGenesis] = std::vector<TAO::Ledger::Transaction>();
-
-                    /* Push to back of map. */
-                    mapTransactions[hashGenesis].push_back(tx.second);
-                }
+                collect(mapTransactions, false);
 
                 /* Loop transctions map by genesis. */
                 for(auto& list : mapTransactions)
@@ -783,15 +794,19 @@ namespace TAO
             }
             else
             {
-                /* Loop transctions map by genesis. */
-                for(const auto& list : mapLegacy)
+                /* Loop the legacy transactions shard by shard. */
+                for(const auto& rShard : vShards)
                 {
-                    /* Push legacy transactions last. */
-                    vHashes.push_back(list.first);;
+                    SHARED_LOCK(rShard.MUTEX);
+                    for(const auto& list : rShard.mapLegacy)
+                    {
+                        /* Push legacy transactions last. */
+                        vHashes.push_back(list.first);
 
-                    /* Check for end of line. */
-                    if(--nCount == 0)
-                        return true;
+                        /* Check for end of line. */
+                        if(--nCount == 0)
+                            return true;
+                    }
                 }
             }
 
@@ -802,18 +817,147 @@ namespace TAO
         /* Gets the size of the memory pool. */
         uint32_t Mempool::Size()
         {
-            RECURSIVE(MUTEX);
+            uint32_t nSize = 0;
+            for(const auto& rShard : vShards)
+            {
+                SHARED_LOCK(rShard.MUTEX);
+                nSize += static_cast<uint32_t>(rShard.mapLedger.size() + rShard.mapLegacy.size());
+            }
 
-            return static_cast<uint32_t>(mapLedger.size() + mapLegacy.size());
+            return nSize;
         }
 
 
         /* Gets the size of the memory pool. */
         uint32_t Mempool::Conflicts()
         {
-            RECURSIVE(MUTEX);
+            uint32_t nSize = 0;
+            for(const auto& rShard : vShards)
+            {
+                SHARED_LOCK(rShard.MUTEX);
+                nSize += static_cast<uint32_t>(rShard.mapConflicts.size() + rShard.mapLegacyConflicts.size());
+            }
+
+            return nSize;
+        }
+
+
+        /* Find the shard responsible for a given txid. */
+        Mempool::Shard& Mempool::shard(const uint512_t& hashTx) const
+        {
+            /* Use the second word, the shard's own buckets are selected by the first. */
+            return vShards[hashTx.Get64(1) % MEMPOOL_SHARDS];
+        }
+
+
+        /* Find the genesis index shard responsible for a given genesis-id. */
+        Mempool::GenesisShard& Mempool::genesis(const uint256_t& hashGenesis) const
+        {
+            /* Use the second word, the shard's own buckets are selected by the first. */
+            return vGenesis[hashGenesis.Get64(1) % MEMPOOL_SHARDS];
+        }
+
+
+        /* Add a txid to the genesis index. */
+        void Mempool::index(const uint256_t& hashGenesis, const uint512_t& hashTx)
+        {
+            GenesisShard& rGenesis = genesis(hashGenesis);
+            WRITE_LOCK(rGenesis.MUTEX);
+
+            /* Only add the txid once. */
+            std::vector<uint512_t>& vHashes = rGenesis.mapIndex[hashGenesis];
+            if(std::find(vHashes.begin(), vHashes.end(), hashTx) == vHashes.end())
+                vHashes.push_back(hashTx);
+        }
+
+
+        /* Remove a txid from the genesis index. */
+        void Mempool::deindex(const uint256_t& hashGenesis, const uint512_t& hashTx)
+        {
+            GenesisShard& rGenesis = genesis(hashGenesis);
+            WRITE_LOCK(rGenesis.MUTEX);
+
+            /* Check that genesis is indexed. */
+            auto it = rGenesis.mapIndex.find(hashGenesis);
+            if(it == rGenesis.mapIndex.end())
+                return;
+
+            /* Erase the txid, and the genesis once it has no more transactions. */
+            std::vector<uint512_t>& vHashes = it->second;
+            vHashes.erase(std::remove(vHashes.begin(), vHashes.end(), hashTx), vHashes.end());
+            if(vHashes.empty())
+                rGenesis.mapIndex.erase(it);
+        }
+
+
+        /* Record a transaction as rejected. */
+        void Mempool::reject(const uint512_t& hashTx)
+        {
+            Shard& rShard = shard(hashTx);
+            WRITE_LOCK(rShard.MUTEX);
+
+            rShard.setRejected.insert(hashTx);
+        }
+
+
+        /* Checks if a transaction was rejected. */
+        bool Mempool::rejected(const uint512_t& hashTx) const
+        {
+            Shard& rShard = shard(hashTx);
+            SHARED_LOCK(rShard.MUTEX);
+
+            return rShard.setRejected.count(hashTx);
+        }
+
 
-            return static_cast<uint32_t>(mapConflicts.size() + mapLegacyConflicts.size());
+        /* Record a transaction as conflicted. */
+        void Mempool::conflict(const uint512_t& hashTx, const TAO::Ledger::Transaction& tx)
+        {
+            Shard& rShard = shard(hashTx);
+            WRITE_LOCK(rShard.MUTEX);
+
+            rShard.mapConflicts[hashTx] = tx;
+        }
+
+
+        /* Checks if a transaction is in the ledger memory pool. */
+        bool Mempool::has(const uint512_t& hashTx) const
+        {
+            Shard& rShard = shard(hashTx);
+            SHARED_LOCK(rShard.MUTEX);
+
+            return rShard.mapLedger.count(hashTx);
+        }
+
+
+        /* Get the transactions of the ledger memory pool grouped by genesis-id. */
+        void Mempool::collect(std::map<uint256_t, std::vector<TAO::Ledger::Transaction>>& mapTransactions, const bool fRejected) const
+        {
+            /* Copy the genesis index one shard at a time, never holding two shards at once. */
+            std::vector<std::pair<uint256_t, uint512_t>> vIndex;
+            for(const auto& rGenesis : vGenesis)
+            {
+                SHARED_LOCK(rGenesis.MUTEX);
+                for(const auto& rIndex : rGenesis.mapIndex)
+                    for(const auto& hashTx : rIndex.second)
+                        vIndex.push_back(std::make_pair(rIndex.first, hashTx));
+            }
+
+            /* Get the transactions by their txid, skipping any removed since we read the index. */
+            for(const auto& rIndex : vIndex)
+            {
+                Shard& rShard = shard(rIndex.second);
+                SHARED_LOCK(rShard.MUTEX);
+
+                /* Check that this transaction hasn't been rejected. */
+                if(!fRejected && rShard.setRejected.count(rIndex.second))
+                    continue;
+
+                /* Push to back of map. */
+                auto it = rShard.mapLedger.find(rIndex.second);
+                if(it != rShard.mapLedger.end())
+                    mapTransactions[rIndex.first].push_back(it->second);
+            }
         }
     }
 }
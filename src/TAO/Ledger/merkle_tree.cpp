@@ -0,0 +1,251 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+#include <LLC/hash/macro.h>
+
+#include <LLP/include/validation_thread_pool.h>
+
+#include <TAO/Ledger/types/merkle_tree.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /* Hash the pairs of a level in slices over the validation pool, with the calling thread taking part.
+         * Workers claim slices by index so the level completes even if no worker picks up a task. */
+        static void hash_slices(const std::vector<uint512_t>& vChildren, std::vector<uint512_t>& vParents,
+                                const uint32_t nBegin, const uint32_t nPairs, LLP::ValidationThreadPool* pPool)
+        {
+            /* Counters shared with the pool tasks, which may outlive this call. */
+            struct Batch
+            {
+                std::atomic<uint32_t> nNext;
+                std::atomic<uint32_t> nDone;
+                std::mutex MUTEX;
+                std::condition_variable CONDITION;
+
+                Batch() : nNext(0), nDone(0), MUTEX(), CONDITION() { }
+            };
+
+            const uint32_t nSlices = (nPairs - nBegin + MERKLE_PARALLEL_PAIRS - 1) / MERKLE_PARALLEL_PAIRS;
+
+            std::shared_ptr<Batch> pBatch = std::make_shared<Batch>();
+
+            /* Claim and hash slices until none are left, a worker that starts late never touches the levels. */
+            const auto fnWork = [pBatch, nSlices, nBegin, nPairs, &vChildren, &vParents]()
+            {
+                for(uint32_t n = pBatch->nNext++; n < nSlices; n = pBatch->nNext++)
+                {
+                    const uint32_t nFirst = nBegin + n * MERKLE_PARALLEL_PAIRS;
+                    const uint32_t nLast  = std::min(nFirst + MERKLE_PARALLEL_PAIRS, nPairs);
+
+                    LLC::SK512Pairs(&vChildren[2 * nFirst], nLast - nFirst, &vParents[nFirst]);
+
+                    /* Wake the caller on the last slice. */
+                    if(++pBatch->nDone == nSlices)
+                    {
+                        std::lock_guard<std::mutex> lock(pBatch->MUTEX);
+                        pBatch->CONDITION.notify_all();
+                    }
+                }
+
+                return true;
+            };
+
+            /* Hand out a task per worker, keeping a slice for ourselves. */
+            const uint32_t nTasks = std::min(pPool->GetThreadCount(), nSlices - 1);
+            for(uint32_t n = 0; n < nTasks; ++n)
+                pPool->Submit(0, 0, 0, fnWork);
+
+            /* Work on our own slices, then wait for any still in flight. */
+            fnWork();
+
+            std::unique_lock<std::mutex> lock(pBatch->MUTEX);
+            pBatch->CONDITION.wait(lock, [pBatch, nSlices]{ return pBatch->nDone.load() == nSlices; });
+        }
+
+
+        /* Hash the parents of a level from the given parent index to the end. */
+        static void HashLevel(const std::vector<uint512_t>& vChildren, std::vector<uint512_t>& vParents, const uint32_t nBegin)
+        {
+            /* Full pairs are hashed in lanes, the last child of an odd level is paired with itself. */
+            const uint32_t nPairs = static_cast<uint32_t>(vChildren.size() / 2);
+            if(nBegin < nPairs)
+            {
+                /* Only levels larger than a slice are spread over the validation pool. */
+                LLP::ValidationThreadPool* pPool = LLP::GetValidationPool();
+                if(pPool && nPairs - nBegin > MERKLE_PARALLEL_PAIRS)
+                    hash_slices(vChildren, vParents, nBegin, nPairs, pPool);
+                else
+                    LLC::SK512Pairs(&vChildren[2 * nBegin], nPairs - nBegin, &vParents[nBegin]);
+            }
+
+            /* Pair the odd node out with itself. */
+            if(vChildren.size() & 1)
+            {
+                const uint512_t& hashLast = vChildren.back();
+                vParents.back() = LLC::SK512(BEGIN(hashLast), END(hashLast), BEGIN(hashLast), END(hashLast));
+            }
+        }
+
+
+        /* The default constructor. */
+        MerkleTree::MerkleTree()
+        : vLevels ( )
+        {
+        }
+
+
+        /* Copy constructor. */
+        MerkleTree::MerkleTree(const MerkleTree& tree)
+        : vLevels (tree.vLevels)
+        {
+        }
+
+
+        /* Move constructor. */
+        MerkleTree::MerkleTree(MerkleTree&& tree) noexcept
+        : vLevels (std::move(tree.vLevels))
+        {
+        }
+
+
+        /* Copy assignment. */
+        MerkleTree& MerkleTree::operator=(const MerkleTree& tree)
+        {
+            vLevels = tree.vLevels;
+
+            return *this;
+        }
+
+
+        /* Move assignment. */
+        MerkleTree& MerkleTree::operator=(MerkleTree&& tree) noexcept
+        {
+            vLevels = std::move(tree.vLevels);
+
+            return *this;
+        }
+
+
+        /* Default Destructor */
+        MerkleTree::~MerkleTree()
+        {
+        }
+
+
+        /* Build the tree over the given leaves, rehashing only what changed. */
+        uint512_t MerkleTree::Build(const std::vector<uint512_t>& vLeaves)
+        {
+            if(vLevels.empty())
+                vLevels.resize(1);
+
+            /* Find the first leaf that differs from our last build. */
+            std::vector<uint512_t>& vOld = vLevels[0];
+
+            uint32_t nFirst = 0;
+            const uint32_t nCommon = static_cast<uint32_t>(std::min(vOld.size(), vLeaves.size()));
+            while(nFirst < nCommon && vOld[nFirst] == vLeaves[nFirst])
+                ++nFirst;
+
+            /* Nothing to rehash when the leaves are unchanged. */
+            if(nFirst == vOld.size() && nFirst == vLeaves.size())
+                return Root();
+
+            /* Update the leaves that changed. */
+            vOld.resize(vLeaves.size());
+            std::copy(vLeaves.begin() + nFirst, vLeaves.end(), vOld.begin() + nFirst);
+
+            /* Rehash every level from the parent of the first changed node. */
+            uint32_t nLevel = 0;
+            for( ; vLevels[nLevel].size() > 1; ++nLevel)
+            {
+                if(vLevels.size() == nLevel + 1)
+                    vLevels.emplace_back();
+
+                const std::vector<uint512_t>& vChildren = vLevels[nLevel];
+                std::vector<uint512_t>& vParents = vLevels[nLevel + 1];
+
+                /* Parents below the first changed one still cover the same children. */
+                const uint32_t nParents = static_cast<uint32_t>((vChildren.size() + 1) / 2);
+                vParents.resize(nParents);
+
+                nFirst = std::min(nFirst / 2, nParents);
+                HashLevel(vChildren, vParents, nFirst);
+            }
+
+            /* Drop the levels of a taller tree from our last build. */
+            vLevels.resize(nLevel + 1);
+
+            return Root();
+        }
+
+
+        /* Get the merkle root of the last build. */
+        uint512_t MerkleTree::Root() const
+        {
+            if(vLevels.empty() || vLevels.back().empty())
+                return 0;
+
+            return vLevels.back()[0];
+        }
+
+
+        /* Get the merkle branch of the leaf at given index. */
+        std::vector<uint512_t> MerkleTree::Branch(uint32_t nIndex) const
+        {
+            /* Merkle branch to return. */
+            std::vector<uint512_t> vMerkleBranch;
+
+            /* Loop through the levels below the root to generate merkle path. */
+            for(uint32_t nLevel = 0; nLevel + 1 < vLevels.size(); ++nLevel)
+            {
+                const std::vector<uint512_t>& vNodes = vLevels[nLevel];
+
+                /* Grab the sibling, or ourselves at the end of an odd level. */
+                vMerkleBranch.push_back(vNodes[std::min<uint32_t>(nIndex ^ 1, vNodes.size() - 1)]);
+                nIndex >>= 1;
+            }
+
+            return vMerkleBranch;
+        }
+
+
+        /* Get the number of leaves in the tree. */
+        uint32_t MerkleTree::Size() const
+        {
+            if(vLevels.empty())
+                return 0;
+
+            return static_cast<uint32_t>(vLevels[0].size());
+        }
+
+
+        /* Release all of the nodes of the tree. */
+        void MerkleTree::Clear()
+        {
+            vLevels.clear();
+        }
+    }
+}
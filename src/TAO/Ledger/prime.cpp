@@ -13,6 +13,7 @@ ________________________________________________________________________________
 
 #include <TAO/Ledger/include/prime.h>
 #include <LLC/types/bignum.h>
+#include <LLC/prime/fermat.h>
 #include <openssl/bn.h>
 
 #include <cstring>
@@ -57,6 +58,10 @@ namespace TAO
             uint1024_t hashNext = hashPrime;
             if(!vOffsets.empty())
             {
+                /* Candidates are verified in batches, so the cluster is checked without allocating. */
+                uint1024_t vCandidates[PRIME_CLUSTER_BATCH];
+                uint32_t nCandidates = 0;
+
                 /* Loop through offsets pattern. */
                 uint32_t nSize = vOffsets.size();
                 for(uint32_t n = 0; n < nSize - 4; ++n)
@@ -71,12 +76,26 @@ namespace TAO
                     /* Set the next offset position. */
                     hashNext += nOffset;
 
-                    /* Check prime at offset. */
-                    if(!fVerify || PrimeCheck(hashNext))
+                    /* Without verifying, every offset counts towards the cluster. */
+                    if(!fVerify)
+                    {
                         ++nClusterSize;
+                        continue;
+                    }
 
+                    /* Check the batch of primes at offsets once it is full. */
+                    vCandidates[nCandidates++] = hashNext;
+                    if(nCandidates == PRIME_CLUSTER_BATCH)
+                    {
+                        nClusterSize += PrimeCluster(vCandidates, nCandidates);
+                        nCandidates   = 0;
+                    }
                 }
 
+                /* Check the remaining primes at offsets. */
+                if(nCandidates > 0)
+                    nClusterSize += PrimeCluster(vCandidates, nCandidates);
+
                 /* Get fractional difficulty. */
                 uint32_t nFraction = 0;
                 std::memcpy(&nFraction, &vOffsets[nSize - 4], 4);
@@ -246,31 +265,31 @@ namespace TAO
             if(fDiagnostic)
                 debug::log(2, FUNCTION, "✅ PASSED: Small divisor test");
 
-            /* Check B: Miller-Rabin Test (OpenSSL probabilistic primality test) */
-            if(!Miller_Rabin(hashTest))
+            /* Check B: Fermat Test, a single base 2 exponentiation rejects composites before the Miller-Rabin rounds */
+            if(FermatTest(hashTest) != 1)
             {
                 if(fDiagnostic)
                 {
-                    debug::log(2, FUNCTION, "❌ FAILED: Miller-Rabin test");
-                    debug::log(2, FUNCTION, "   Prime failed cryptographic primality test (PR #129)");
+                    debug::log(2, FUNCTION, "❌ FAILED: Fermat test");
                 }
                 return false;
             }
             if(fDiagnostic)
-                debug::log(2, FUNCTION, "✅ PASSED: Miller-Rabin test");
+                debug::log(2, FUNCTION, "✅ PASSED: Fermat test");
 
-            /* Check C: Fermat Test */
-            if(FermatTest(hashTest) != 1)
+            /* Check C: Miller-Rabin Test (OpenSSL probabilistic primality test) */
+            if(!Miller_Rabin(hashTest))
             {
                 if(fDiagnostic)
                 {
-                    debug::log(2, FUNCTION, "❌ FAILED: Fermat test");
+                    debug::log(2, FUNCTION, "❌ FAILED: Miller-Rabin test");
+                    debug::log(2, FUNCTION, "   Prime failed cryptographic primality test (PR #129)");
                 }
                 return false;
             }
             if(fDiagnostic)
             {
-                debug::log(2, FUNCTION, "✅ PASSED: Fermat test");
+                debug::log(2, FUNCTION, "✅ PASSED: Miller-Rabin test");
                 debug::log(2, FUNCTION, "════════════════════════════════════════");
                 debug::log(2, FUNCTION, "✅ PRIME IS VALID");
                 debug::log(2, FUNCTION, "════════════════════════════════════════");
@@ -280,9 +299,42 @@ namespace TAO
         }
 
 
-        /* Used after Miller-Rabin and Divisor tests to verify primality. */
+        /* Checks the candidates of a prime cluster, returning how many of them are prime. */
+        uint32_t PrimeCluster(const uint1024_t* pCandidates, const uint32_t nCount)
+        {
+            /* Filter out the candidates with small divisors or an even modulus for the montgomery kernel. */
+            uint1024_t vCandidates[PRIME_CLUSTER_BATCH];
+            uint1024_t vRemainders[PRIME_CLUSTER_BATCH];
+
+            uint32_t nCandidates = 0;
+            for(uint32_t n = 0; n < nCount && n < PRIME_CLUSTER_BATCH; ++n)
+            {
+                if(pCandidates[n] > 1 && SmallDivisors(pCandidates[n]))
+                    vCandidates[nCandidates++] = pCandidates[n];
+            }
+
+            /* Run the fermat tests of the cluster back to back. */
+            fermat_cluster(vCandidates, vRemainders, nCandidates);
+
+            /* Only candidates that pass fermat go through the Miller-Rabin rounds. */
+            uint32_t nPrimes = 0;
+            for(uint32_t n = 0; n < nCandidates; ++n)
+            {
+                if(vRemainders[n] == 1 && Miller_Rabin(vCandidates[n]))
+                    ++nPrimes;
+            }
+
+            return nPrimes;
+        }
+
+
+        /* Used after Divisor tests to verify primality, before Miller-Rabin. */
         uint1024_t FermatTest(const uint1024_t& hashTest)
         {
+            /* The montgomery kernel handles any odd modulus above one. */
+            if((hashTest.Get64(0) & 1) && hashTest > 1)
+                return fermat_remainder(hashTest);
+
             LLC::CAutoBN_CTX pctx;
 
             LLC::CBigNum bnPrime(hashTest);
@@ -0,0 +1,133 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+
+#include <TAO/Ledger/types/sigcache.h>
+
+#include <Util/include/mutex.h>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /* The global signature cache. */
+        SignatureCache sigcache;
+
+
+        /* Default Constructor. */
+        SignatureCache::SignatureCache(const uint32_t nMaxEntriesIn, const uint32_t nShardsIn)
+        : vShards     (nShardsIn == 0 ? 1 : nShardsIn)
+        , nMaxEntries (nMaxEntriesIn / (nShardsIn == 0 ? 1 : nShardsIn))
+        , nHits       (0)
+        , nMisses     (0)
+        {
+        }
+
+
+        /* Build the cache key for a signature. */
+        uint256_t SignatureCache::Key(const uint512_t& hashTx, const std::vector<uint8_t>& vchPubKey, const std::vector<uint8_t>& vchSig)
+        {
+            /* Hash our public key and signature. */
+            const uint256_t hashPubKey = LLC::SK256(vchPubKey);
+            const uint256_t hashSig    = LLC::SK256(vchSig);
+
+            /* Bind them to the txid. */
+            std::vector<uint8_t> vKey = hashTx.GetBytes();
+            const std::vector<uint8_t> vPubKey = hashPubKey.GetBytes();
+            const std::vector<uint8_t> vSig    = hashSig.GetBytes();
+
+            vKey.insert(vKey.end(), vPubKey.begin(), vPubKey.end());
+            vKey.insert(vKey.end(), vSig.begin(), vSig.end());
+
+            return LLC::SK256(vKey);
+        }
+
+
+        /* Check if a signature was already verified. */
+        bool SignatureCache::Has(const uint256_t& hashKey)
+        {
+            Shard& rShard = shard(hashKey);
+            {
+                LOCK(rShard.MUTEX);
+                if(rShard.setVerified.count(hashKey))
+                {
+                    ++nHits;
+                    return true;
+                }
+            }
+
+            ++nMisses;
+            return false;
+        }
+
+
+        /* Record a successful verification. */
+        void SignatureCache::Add(const uint256_t& hashKey)
+        {
+            Shard& rShard = shard(hashKey);
+
+            LOCK(rShard.MUTEX);
+            if(!rShard.setVerified.insert(hashKey).second)
+                return;
+
+            rShard.queueVerified.push_back(hashKey);
+
+            /* Evict our oldest entries once over capacity. */
+            while(rShard.queueVerified.size() > nMaxEntries)
+            {
+                rShard.setVerified.erase(rShard.queueVerified.front());
+                rShard.queueVerified.pop_front();
+            }
+        }
+
+
+        /* Get the total lookups that skipped a verification. */
+        uint64_t SignatureCache::Hits() const
+        {
+            return nHits.load();
+        }
+
+
+        /* Get the total lookups that required a verification. */
+        uint64_t SignatureCache::Misses() const
+        {
+            return nMisses.load();
+        }
+
+
+        /* Get the total verifications held by the cache. */
+        uint64_t SignatureCache::Size()
+        {
+            uint64_t nSize = 0;
+            for(auto& rShard : vShards)
+            {
+                LOCK(rShard.MUTEX);
+                nSize += rShard.setVerified.size();
+            }
+
+            return nSize;
+        }
+
+
+        /* Get the shard responsible for a given key. */
+        SignatureCache::Shard& SignatureCache::shard(const uint256_t& hashKey)
+        {
+            return vShards[hashKey.Get64() % vShards.size()];
+        }
+    }
+}
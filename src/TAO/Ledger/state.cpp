@@ -1702,30 +1702,64 @@ namespace TAO
         }
 
 
+        /* Serialize the header data the signature hash is computed over. */
+        static std::vector<uint8_t> signature_data(const BlockState& state)
+        {
+            /* Create a data stream to get the hash. */
+            DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
+            ss.reserve(256);
+
+            /* Signature hash for version 7 blocks. */
+            if(state.nVersion >= 7)
+                ss << state.nVersion << state.hashPrevBlock << state.hashMerkleRoot << state.nChannel << state.nHeight
+                   << state.nBits << state.nNonce << state.nTime << state.vOffsets;
+            else
+                ss << state.nVersion << state.hashPrevBlock << state.hashMerkleRoot << state.nChannel << state.nHeight
+                   << state.nBits << state.nNonce << uint32_t(state.nTime);
+
+            return std::vector<uint8_t>(ss.begin(), ss.end());
+        }
+
+
         /* Get the Signarture Hash of the block. Used to verify work claims. */
         uint1024_t BlockState::SignatureHash() const
         {
-            /* Signature hash for version 7 blocks. */
-            if(nVersion >= 7)
-            {
-                /* Create a data stream to get the hash. */
-                DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
-                ss.reserve(256);
+            /* From version 5 the block hash is the signature hash, so hash the same bytes as GetHashes(). */
+            const std::vector<uint8_t> vData = (nVersion >= 5 ? HashData() : signature_data(*this));
 
-                /* Serialize the data to hash into a stream. */
-                ss << nVersion << hashPrevBlock << hashMerkleRoot << nChannel << nHeight << nBits << nNonce << nTime << vOffsets;
+            return LLC::SK1024(vData.begin(), vData.end());
+        }
+
+
+        /* Get the bytes the block hash is computed over. */
+        std::vector<uint8_t> BlockState::HashData() const
+        {
+            /* Pre-Version 5 rule of the proof hash being the block hash. */
+            if(nVersion < 5)
+            {
+                /* Hashing template for CPU miners uses nVersion to nBits, GPU uses nVersion to nNonce. */
+                if(nChannel == 1)
+                    return std::vector<uint8_t>(BEGIN(nVersion), END(nBits));
 
-                return LLC::SK1024(ss.begin(), ss.end());
+                return std::vector<uint8_t>(BEGIN(nVersion), END(nNonce));
             }
 
-            /* Create a data stream to get the hash. */
-            DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
-            ss.reserve(256);
+            return signature_data(*this);
+        }
+
+
+        /* Get the hashes of a batch of block states. */
+        void BlockState::GetHashes(const std::vector<BlockState>& vStates, std::vector<uint1024_t>& vHashes)
+        {
+            /* Collect the header bytes of every state. */
+            std::vector<std::vector<uint8_t>> vData;
+            vData.reserve(vStates.size());
 
-            /* Serialize the data to hash into a stream. */
-            ss << nVersion << hashPrevBlock << hashMerkleRoot << nChannel << nHeight << nBits << nNonce << uint32_t(nTime);
+            for(const auto& state : vStates)
+                vData.emplace_back(state.HashData());
 
-            return LLC::SK1024(ss.begin(), ss.end());
+            /* Hash them in as many lanes as the processor supports. */
+            LLC::SK1024(vData, vHashes);
         }
 
 
@@ -35,11 +35,15 @@ ________________________________________________________________________________
 
 #include <LLC/include/flkey.h>
 #include <LLC/include/eckey.h>
+#include <LLC/hash/SK.h>
 
 #include <Util/include/args.h>
 #include <Util/include/convert.h>
 #include <Util/include/debug.h>
 #include <Util/include/runtime.h>
+
+#include <memory>
+#include <mutex>
 #include <sstream>
 
 /* Global TAO namespace. */
@@ -124,6 +128,138 @@ namespace TAO::Ledger
                 vBlockBody, LLP::FalconConstants::FULL_BLOCK_TRITIUM_HEIGHT_OFFSET);
             return true;
         }
+
+
+        /** StatelessTemplate
+         *
+         *  The part of a block template shared by every miner of a channel at a height.
+         *
+         *  Holds the transaction set, the header data and the producer as returned from
+         *  CreateTransaction, before any contracts are added. The producer is the last leaf
+         *  of the merkle tree, so its siblings are cached and each miner's merkle root is
+         *  folded up from its own producer hash without rebuilding the tree.
+         *
+         **/
+        struct StatelessTemplate
+        {
+            /** The block with transactions and header data, producer has no contracts or signature. **/
+            TritiumBlock block;
+
+            /** The best state the template was built on. **/
+            BlockState tStateBest;
+
+            /** The merkle branch of the producer leaf. **/
+            std::vector<uint512_t> vMerkleBranch;
+
+            /** The timestamp the template was built at. **/
+            uint64_t nCreated = 0;
+        };
+
+
+        /* The current template of each mining channel, guarded by its mutex.
+         * The mutex is held while building so that miners asking at the same time wait for one build. */
+        std::shared_ptr<const StatelessTemplate> ptrTemplates[3];
+        std::mutex TEMPLATE_MUTEX[3];
+
+
+        /* Compute the merkle root for a producer hash from the producer's merkle branch.
+         * The producer is the last leaf, so at every level it is either a right node with a
+         * left sibling from the branch, or the odd node out paired with itself. */
+        uint512_t ProducerMerkleRoot(const uint512_t& hashProducer, const std::vector<uint512_t>& vMerkleBranch, uint32_t nIndex)
+        {
+            uint512_t hashMerkle = hashProducer;
+            for(const auto& hashLeaf : vMerkleBranch)
+            {
+                if(nIndex & 1)
+                    hashMerkle = LLC::SK512(BEGIN(hashLeaf), END(hashLeaf), BEGIN(hashMerkle), END(hashMerkle));
+                else
+                    hashMerkle = LLC::SK512(BEGIN(hashMerkle), END(hashMerkle), BEGIN(hashMerkle), END(hashMerkle));
+
+                nIndex >>= 1;
+            }
+
+            return hashMerkle;
+        }
+
+
+        /* Check that a template can still be handed out. */
+        bool TemplateCurrent(const StatelessTemplate& tmpl, const uint1024_t& hashBest, const uint256_t& hashGenesis)
+        {
+            /* Has the blockchain advanced? */
+            if(tmpl.block.hashPrevBlock != hashBest)
+                return false;
+
+            /* Has the user/genesis changed? */
+            if(tmpl.block.producer.hashGenesis != hashGenesis)
+                return false;
+
+            /* Pick up new mempool transactions periodically. */
+            const uint64_t nRefresh = static_cast<uint64_t>(config::GetArg("-templaterefresh", 10));
+            if(runtime::unifiedtimestamp() >= tmpl.nCreated + nRefresh)
+                return false;
+
+            /* Has the producer's sigchain advanced in the mempool or on disk? */
+            TAO::Ledger::Transaction txMempool;
+            if(mempool.Get(hashGenesis, txMempool))
+                return (txMempool.GetHash() == tmpl.block.producer.hashPrevTx);
+
+            uint512_t hashLast = 0;
+            if(LLD::Ledger->ReadLast(hashGenesis, hashLast) && hashLast != tmpl.block.producer.hashPrevTx)
+                return false;
+
+            return true;
+        }
+
+
+        /* Build the shared template of a channel on the given best state. */
+        std::shared_ptr<const StatelessTemplate> BuildTemplate(
+            const memory::encrypted_ptr<TAO::Ledger::Credentials>& pCredentials,
+            const SecureString& strPIN,
+            const uint32_t nChannel,
+            const BlockState& tStateBest)
+        {
+            std::shared_ptr<StatelessTemplate> pTemplate = std::make_shared<StatelessTemplate>();
+            pTemplate->tStateBest = tStateBest;
+            pTemplate->nCreated   = runtime::unifiedtimestamp();
+
+            /* Modulate the block version, same as CreateBlock(). */
+            TritiumBlock& block = pTemplate->block;
+            block.SetNull();
+
+            const uint32_t nCurrent = CurrentBlockVersion();
+            if(BlockVersionActive(runtime::unifiedtimestamp(), nCurrent))
+                block.nVersion = nCurrent;
+            else
+                block.nVersion = nCurrent - 1;
+
+            /* Must add transactions first, before creating producer, so producer is sequenced last if user has tx in block */
+            AddTransactions(block);
+
+            /* Create the producer without contracts, those are added per miner. */
+            if(!CreateTransaction(pCredentials, strPIN, block.producer))
+            {
+                debug::error(FUNCTION, "Failed to create producer transaction");
+                return nullptr;
+            }
+
+            /* Populate the block metadata. */
+            AddBlockData(tStateBest, nChannel, block);
+
+            /* Cache the producer's merkle branch, its siblings don't depend on the producer. */
+            std::vector<uint512_t> vHashes;
+            for(const auto& tx : block.vtx)
+                vHashes.push_back(tx.second);
+
+            vHashes.push_back(block.producer.GetHash(true));
+
+            pTemplate->vMerkleBranch = block.GetMerkleBranch(vHashes, static_cast<uint32_t>(block.vtx.size()));
+            block.tMerkleTree.Clear();
+
+            debug::log(2, FUNCTION, "Built template for channel ", nChannel, " unified height ", block.nHeight,
+                       " with ", block.vtx.size(), " transactions");
+
+            return pTemplate;
+        }
     }
 
 
@@ -200,37 +336,76 @@ namespace TAO::Ledger
                 return nullptr;
             }
             
-            TritiumBlock* pBlock = new TritiumBlock();
-            
-            // CreateBlock() handles wallet signing per consensus requirements
-            bool success = CreateBlock(
-                pCredentials,
-                strPIN,
-                nChannel,
-                *pBlock,
-                nExtraNonce,
-                nullptr,           // No coinbase recipients
-                hashRewardAddress  // Route rewards to miner's address
-            );
-            
-            if (!success) {
+            /* Get the shared template for this channel and height, building it once for all miners. */
+            std::shared_ptr<const StatelessTemplate> pTemplate;
+            {
+                std::lock_guard<std::mutex> lock(TEMPLATE_MUTEX[nChannel]);
+
+                pTemplate = ptrTemplates[nChannel];
+                if(!pTemplate || !TemplateCurrent(*pTemplate, statePrev.GetHash(), pCredentials->Genesis()))
+                {
+                    pTemplate = BuildTemplate(pCredentials, strPIN, nChannel, statePrev);
+                    ptrTemplates[nChannel] = pTemplate;
+                }
+            }
+
+            if(!pTemplate)
+            {
+                debug::error(FUNCTION, "Failed to build block template");
+                return nullptr;
+            }
+
+            /* Apply this miner's reward routing and extra nonce to a copy of the template. */
+            TritiumBlock* pBlock = new TritiumBlock(pTemplate->block);
+            if(!AddProducerContracts(pCredentials, pBlock->producer, pTemplate->tStateBest, pBlock->nVersion,
+                nChannel, nExtraNonce, nullptr, hashRewardAddress))
+            {
                 delete pBlock;
-                debug::error(FUNCTION, "CreateBlock failed");
+                debug::error(FUNCTION, "Failed to add producer contracts");
                 return nullptr;
             }
-            
+
+            /* Update the producer timestamp */
+            UpdateProducerTimestamp(pBlock->producer);
+
+            /* Sign the producer transaction. */
+            pBlock->producer.Sign(pCredentials->Generate(pBlock->producer.nSequence, strPIN));
+
+            /* Double check our next hash if -safemode enabled. */
+            if(config::GetBoolArg("-safemode", false))
+            {
+                /* Re-calculate our next hash if safemode forcing not to use cache. */
+                const uint256_t hashNext =
+                    TAO::Ledger::Transaction::NextHash(pCredentials->Generate(pBlock->producer.nSequence + 1, strPIN, false), pBlock->producer.nNextType);
+
+                /* Check that this next hash is what we are expecting. */
+                if(pBlock->producer.hashNext != hashNext)
+                {
+                    debug::error(FUNCTION, "-safemode next hash mismatch, broadcast terminated");
+                    delete pBlock;
+                    return nullptr;
+                }
+            }
+
+            /* Fold the merkle root up from this producer. */
+            pBlock->hashMerkleRoot = ProducerMerkleRoot(pBlock->producer.GetHash(true), pTemplate->vMerkleBranch,
+                static_cast<uint32_t>(pBlock->vtx.size()));
+
+            /* Update the time for the newly created block. */
+            pBlock->UpdateTime();
+
             /* DO NOT call Check() here - the block hasn't been mined yet.
              * Check() validates PoW which requires a valid nonce from the miner.
              * Validation happens in validate_block() AFTER miner submits solution. */
-            
-            /* Basic sanity check only - verify CreateBlock() produced valid output */
+
+            /* Basic sanity check only - verify the template produced valid output */
             if(pBlock->hashMerkleRoot == 0)
             {
-                debug::error(FUNCTION, "CreateBlock() produced invalid merkle root");
+                debug::error(FUNCTION, "Template produced invalid merkle root");
                 delete pBlock;
                 return nullptr;
             }
-            
+
             /* Log block creation result */
             debug::log(2, FUNCTION, "CreateBlock: channel ", pBlock->nChannel, 
                        " unified height ", pBlock->nHeight);
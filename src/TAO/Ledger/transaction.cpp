@@ -50,6 +50,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/timelocks.h>
 #include <TAO/Ledger/types/merkle.h>
 #include <TAO/Ledger/types/mempool.h>
+#include <TAO/Ledger/types/sigcache.h>
 
 #include <Util/include/args.h>
 #include <Util/include/debug.h>
@@ -534,45 +535,61 @@ namespace TAO
                 }
             }
 
-            /* Verify the block signature (if not synchronizing) */
-            if(!TAO::Ledger::ChainState::Synchronizing())
+            /* Verify the transaction signature (if not synchronizing) */
+            if(!TAO::Ledger::ChainState::Synchronizing() && !VerifySignature())
+                return false;
+
+            return true;
+        }
+
+
+        /* Verify the signature of the transaction against its public key. */
+        bool Transaction::VerifySignature() const
+        {
+            /* Skip verification if this signature was verified before, such as on memory pool accept. */
+            const uint512_t hashTx = GetHash();
+            const uint256_t hashSigCache = SignatureCache::Key(hashTx, vchPubKey, vchSig);
+            if(sigcache.Has(hashSigCache))
+                return true;
+
+            /* Switch based on signature type. */
+            switch(nKeyType)
             {
-                /* Switch based on signature type. */
-                switch(nKeyType)
+                /* Support for the FALCON signature scheeme. */
+                case SIGNATURE::FALCON:
                 {
-                    /* Support for the FALCON signature scheeme. */
-                    case SIGNATURE::FALCON:
-                    {
-                        /* Create the FL Key object. */
-                        LLC::FLKey key;
-
-                        /* Set the public key and verify. */
-                        key.SetPubKey(vchPubKey);
-                        if(!key.Verify(GetHash().GetBytes(), vchSig))
-                            return debug::error(FUNCTION, "invalid transaction signature");
+                    /* Create the FL Key object. */
+                    LLC::FLKey key;
 
-                        break;
-                    }
+                    /* Set the public key and verify. */
+                    key.SetPubKey(vchPubKey);
+                    if(!key.Verify(hashTx.GetBytes(), vchSig))
+                        return debug::error(FUNCTION, "invalid transaction signature");
 
-                    /* Support for the BRAINPOOL signature scheme. */
-                    case SIGNATURE::BRAINPOOL:
-                    {
-                        /* Create EC Key object. */
-                        LLC::ECKey key = LLC::ECKey(LLC::BRAINPOOL_P512_T1, 64);
+                    break;
+                }
 
-                        /* Set the public key and verify. */
-                        key.SetPubKey(vchPubKey);
-                        if(!key.Verify(GetHash().GetBytes(), vchSig))
-                            return debug::error(FUNCTION, "invalid transaction signature");
+                /* Support for the BRAINPOOL signature scheme. */
+                case SIGNATURE::BRAINPOOL:
+                {
+                    /* Create EC Key object. */
+                    LLC::ECKey key = LLC::ECKey(LLC::BRAINPOOL_P512_T1, 64);
 
-                        break;
-                    }
+                    /* Set the public key and verify. */
+                    key.SetPubKey(vchPubKey);
+                    if(!key.Verify(hashTx.GetBytes(), vchSig))
+                        return debug::error(FUNCTION, "invalid transaction signature");
 
-                    default:
-                        return debug::error(FUNCTION, "unknown signature type");
+                    break;
                 }
+
+                default:
+                    return debug::error(FUNCTION, "unknown signature type");
             }
 
+            /* Record our successful verification. */
+            sigcache.Add(hashSigCache);
+
             return true;
         }
 
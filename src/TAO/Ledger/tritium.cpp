@@ -18,6 +18,7 @@ ________________________________________________________________________________
 #include <LLP/packets/message.h>
 #include <LLP/include/global.h>
 #include <LLP/include/inv.h>
+#include <LLP/include/validation_thread_pool.h>
 
 #include <TAO/Operation/include/enum.h>
 
@@ -45,7 +46,12 @@ ________________________________________________________________________________
 #include <Util/include/args.h>
 #include <Util/include/hex.h>
 
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
 
 /* Global TAO namespace. */
 namespace TAO
@@ -322,6 +328,68 @@ namespace TAO
         }
 
 
+        /* Minimum transactions in a block before checks are spread over the validation pool. */
+        const uint32_t MIN_PARALLEL_CHECKS = 16;
+
+
+        /* Run a set of independent checks over the validation pool, with the calling thread taking part.
+         * Workers claim checks by index so the batch completes even if no worker picks up a task, and a
+         * worker that starts late only touches the shared counters, never the checks themselves. */
+        static void check_parallel(const std::vector<std::function<bool()>>& vChecks, std::vector<uint8_t>& vResults,
+                                   const uint512_t& hashMerkle, const uint64_t nNonce)
+        {
+            /* Counters shared with the pool tasks, which may outlive this call. */
+            struct Batch
+            {
+                std::atomic<uint32_t> nNext;
+                std::atomic<uint32_t> nDone;
+                std::mutex MUTEX;
+                std::condition_variable CONDITION;
+
+                Batch() : nNext(0), nDone(0), MUTEX(), CONDITION() { }
+            };
+
+            const uint32_t nTotal = static_cast<uint32_t>(vChecks.size());
+            vResults.assign(nTotal, 0);
+
+            std::shared_ptr<Batch> pBatch = std::make_shared<Batch>();
+
+            /* Claim and run checks until none are left. */
+            const auto fnWork = [pBatch, nTotal, &vChecks, &vResults]()
+            {
+                for(uint32_t n = pBatch->nNext++; n < nTotal; n = pBatch->nNext++)
+                {
+                    try { vResults[n] = vChecks[n]() ? 1 : 0; }
+                    catch(const std::exception& e) { vResults[n] = 0; }
+
+                    /* Wake the caller on the last check. */
+                    if(++pBatch->nDone == nTotal)
+                    {
+                        std::lock_guard<std::mutex> lock(pBatch->MUTEX);
+                        pBatch->CONDITION.notify_all();
+                    }
+                }
+
+                return true;
+            };
+
+            /* Hand out a task per worker, small batches run on this thread only. */
+            LLP::ValidationThreadPool* pPool = LLP::GetValidationPool();
+            if(pPool && nTotal >= MIN_PARALLEL_CHECKS)
+            {
+                const uint32_t nTasks = std::min(pPool->GetThreadCount(), nTotal - 1);
+                for(uint32_t n = 0; n < nTasks; ++n)
+                    pPool->Submit(hashMerkle, nNonce, 0, fnWork);
+            }
+
+            /* Work on our own batch, then wait for any checks still in flight. */
+            fnWork();
+
+            std::unique_lock<std::mutex> lock(pBatch->MUTEX);
+            pBatch->CONDITION.wait(lock, [pBatch, nTotal]{ return pBatch->nDone.load() == nTotal; });
+        }
+
+
         /* Checks if a block is valid if not connected to chain. */
         bool TritiumBlock::Check() const
         {
@@ -447,6 +515,58 @@ namespace TAO
 
             /* Get the signature operations for legacy tx's. */
             uint32_t nSize = (uint32_t)vtx.size();
+
+            /* Fetch all of our transactions from the memory pool up front. */
+            std::vector<Legacy::Transaction>       vLegacy(nSize);
+            std::vector<TAO::Ledger::Transaction>  vTritium(nSize);
+            std::vector<uint8_t>                   vFound(nSize, 0);
+            for(uint32_t i = 0; i < nSize; ++i)
+            {
+                /* Track our conflicted flags here. */
+                bool fHasConflict = false;
+
+                /* Check the memory pool for legacy transactions. */
+                if(vtx[i].first == TRANSACTION::LEGACY)
+                    vFound[i] = LLD::Legacy->ReadTx(vtx[i].second, vLegacy[i], fHasConflict, FLAGS::MEMPOOL) ? 1 : 0;
+
+                /* Check the memory pool for tritium transactions. */
+                else if(vtx[i].first == TRANSACTION::TRITIUM)
+                    vFound[i] = LLD::Ledger->ReadTx(vtx[i].second, vTritium[i], fHasConflict, FLAGS::MEMPOOL) ? 1 : 0;
+
+                /* Check for conflicts. */
+                if(fHasConflict)
+                    this->fConflicted = true;
+            }
+
+            /* Run the stateless checks in parallel: the structural legacy checks, and tritium signatures unless synchronizing. */
+            const bool fSignatures = !TAO::Ledger::ChainState::Synchronizing();
+            std::vector<std::function<bool()>> vChecks;
+            std::vector<uint32_t> vCheckIndex(nSize, 0);
+            for(uint32_t i = 0; i < nSize; ++i)
+            {
+                /* Skip over missing transactions. */
+                if(!vFound[i])
+                    continue;
+
+                /* Legacy transactions get their structural checks. */
+                if(vtx[i].first == TRANSACTION::LEGACY)
+                {
+                    vCheckIndex[i] = static_cast<uint32_t>(vChecks.size());
+                    vChecks.push_back([&vLegacy, i]{ return vLegacy[i].Check(); });
+                }
+
+                /* Tritium transactions get their signature verified, which hits the signature cache if seen in the mempool. */
+                else if(vtx[i].first == TRANSACTION::TRITIUM && fSignatures)
+                {
+                    vCheckIndex[i] = static_cast<uint32_t>(vChecks.size());
+                    vChecks.push_back([&vTritium, i]{ return vTritium[i].VerifySignature(); });
+                }
+            }
+
+            std::vector<uint8_t> vChecked;
+            check_parallel(vChecks, vChecked, hashMerkleRoot, nNonce);
+
+            /* Run the stateful checks in block order, so the first error is the same as a serial pass. */
             for(uint32_t i = 0; i < nSize; ++i)
             {
                 /* Insert txid into set to check for duplicates. */
@@ -456,20 +576,15 @@ namespace TAO
                 /* Basic checks for legacy transactions. */
                 if(vtx[i].first == TRANSACTION::LEGACY)
                 {
-                    /* Track our conflicted flags here. */
-                    bool fHasConflict = false;
-
                     /* Check the memory pool. */
-                    Legacy::Transaction tx;
-                    if(!LLD::Legacy->ReadTx(vtx[i].second, tx, fHasConflict, FLAGS::MEMPOOL))
+                    if(!vFound[i])
                     {
                         vMissing.push_back(vtx[i]);
                         continue;
                     }
 
-                    /* Check for conflicts. */
-                    if(fHasConflict)
-                        this->fConflicted = true;
+                    /* Get the transaction. */
+                    const Legacy::Transaction& tx = vLegacy[i];
 
                     /* Check for coinbase / coinstake. */
                     if(tx.IsCoinBase() || tx.IsCoinStake())
@@ -480,7 +595,7 @@ namespace TAO
                         return debug::error(FUNCTION, "block timestamp earlier than transaction timestamp");
 
                     /* Check the transaction for validity. */
-                    if(!tx.Check())
+                    if(!vChecked[vCheckIndex[i]])
                         return debug::error(FUNCTION, "check transaction failed.");
 
                     /* Check legacy transaction for finality. */
@@ -491,25 +606,24 @@ namespace TAO
                 /* Basic checks for tritium transactions. */
                 else if(vtx[i].first == TRANSACTION::TRITIUM)
                 {
-                    /* Track our conflicted flags here. */
-                    bool fHasConflict = false;
-
                     /* Check the memory pool. */
-                    TAO::Ledger::Transaction tx;
-                    if(!LLD::Ledger->ReadTx(vtx[i].second, tx, fHasConflict, FLAGS::MEMPOOL))
+                    if(!vFound[i])
                     {
                         vMissing.push_back(vtx[i]);
                         continue;
                     }
 
-                    /* Check for conflicts. */
-                    if(fHasConflict)
-                        this->fConflicted = true;
+                    /* Get the transaction. */
+                    const TAO::Ledger::Transaction& tx = vTritium[i];
 
                     /* Check for coinbase / coinstake. */
                     if(tx.IsCoinBase() || tx.IsCoinStake() || tx.IsHybrid())
                         return debug::error(FUNCTION, "cannot have non-producer coinbase / coinstake transaction");
 
+                    /* Check the transaction signature. */
+                    if(fSignatures && !vChecked[vCheckIndex[i]])
+                        return debug::error(FUNCTION, "invalid transaction signature");
+
                     /* Check the sequencing. */
                     if(mapLast.count(tx.hashGenesis) && tx.hashPrevTx != mapLast[tx.hashGenesis])
                         return debug::error(FUNCTION, "transaction in sigchain out of sequence");
@@ -17,6 +17,8 @@ ________________________________________________________________________________
 
 #include <LLC/types/uint1024.h>
 
+#include <TAO/Ledger/types/merkle_tree.h>
+
 #include <set>
 
 //forward declerations for BigNum
@@ -85,8 +87,8 @@ namespace TAO
             mutable std::vector<std::pair<uint8_t, uint512_t> > vMissing;
 
 
-            /** MEMORY ONLY: list of hashes used in computing merkle root. **/
-            mutable std::vector<uint512_t> vMerkleTree;
+            /** MEMORY ONLY: merkle tree of the hashes used in computing merkle root. **/
+            mutable MerkleTree tMerkleTree;
 
 
             /** MEMORY ONLY: hash of root block that missing tx's failed on. **/
@@ -263,7 +265,8 @@ namespace TAO
 
             /** BuildMerkleTree
              *
-             *  Build the merkle tree from the transaction list.
+             *  Build the merkle tree from the transaction list. Only the nodes above transactions that
+             *  changed since the last build are rehashed, so appending to a template stays cheap.
              *
              *  @param[in] vtx The list of hashes to build merkle tree with.
              *
@@ -275,7 +278,8 @@ namespace TAO
 
             /** BuildMerkleTree
              *
-             *  Build the merkle tree from the transaction list.
+             *  Build the merkle tree from the transaction list. Only the nodes above transactions that
+             *  changed since the last build are rehashed, so appending to a template stays cheap.
              *
              *  @param[in] vtx The list of hashes to build merkle tree with.
              *
@@ -26,6 +26,12 @@ ________________________________________________________________________________
 
 #include <Util/include/mutex.h>
 
+#include <array>
+#include <map>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace LLP
 {
     class TritiumNode;
@@ -39,55 +45,124 @@ namespace TAO
     namespace Ledger
     {
 
+        /** MempoolHash
+         *
+         *  Hash functor for the mempool indexes. Txids and genesis-ids are already uniformly
+         *  distributed, so the lowest word is used directly without rehashing.
+         *
+         **/
+        struct MempoolHash
+        {
+            template<typename Type>
+            size_t operator()(const Type& hash) const
+            {
+                return static_cast<size_t>(hash.Get64(0));
+            }
+
+
+            size_t operator()(const Legacy::OutPoint& prevout) const
+            {
+                return static_cast<size_t>(prevout.hash.Get64(0) ^ prevout.n);
+            }
+        };
+
+
         /** Mempool
          *
          *  The memory pool class where transactions are stored until they are validated
          *  and added to the ledger.
          *
+         *  Transactions are stored in hash maps striped over shards by txid, each shard with its
+         *  own reader/writer lock, and indexed by genesis-id in a second set of shards. Lookups only
+         *  lock the shard they touch, so readers never wait on writers of other shards. Admission
+         *  state that links transactions together (orphans, claims, legacy inputs) is guarded by the
+         *  admission lock, which is only taken by writers.
+         *
          **/
         class Mempool
         {
-        public:
+            /** The total shards the transactions and the genesis index are striped over. **/
+            static const uint32_t MEMPOOL_SHARDS = 32;
 
-            /* Mutex to local access to the mempool */
-            mutable std::recursive_mutex MUTEX;
 
-        private:
+            /** Shard
+             *
+             *  The transactions of the memory pool whose txid maps to this shard.
+             *
+             **/
+            struct Shard
+            {
+                /** Mutex for concurrent reads of this shard. **/
+                mutable std::shared_mutex MUTEX;
 
-            /** The transactions in the ledger memory pool. **/
-            std::map<uint512_t, Legacy::Transaction> mapLegacy;
 
+                /** The transactions in the legacy memory pool. **/
+                std::unordered_map<uint512_t, Legacy::Transaction, MempoolHash> mapLegacy;
 
-            /** The transactions in conflicted legacy memory pool. */
-            std::map<uint512_t, Legacy::Transaction> mapLegacyConflicts;
 
+                /** The transactions in conflicted legacy memory pool. **/
+                std::unordered_map<uint512_t, Legacy::Transaction, MempoolHash> mapLegacyConflicts;
 
-            /** The transactions in the ledger memory pool. **/
-            std::map<uint512_t, TAO::Ledger::Transaction> mapLedger;
 
+                /** The transactions in the ledger memory pool. **/
+                std::unordered_map<uint512_t, TAO::Ledger::Transaction, MempoolHash> mapLedger;
 
-            /** The transactions in the conflicted ledger memory pool. **/
-            std::map<uint512_t, TAO::Ledger::Transaction> mapConflicts;
 
+                /** The transactions in the conflicted ledger memory pool. **/
+                std::unordered_map<uint512_t, TAO::Ledger::Transaction, MempoolHash> mapConflicts;
 
-            /** Oprhan transactions in queue. **/
-            std::map<uint512_t, TAO::Ledger::Transaction> mapOrphans;
 
+                /** Record of rejected transactions. **/
+                std::unordered_set<uint512_t, MempoolHash> setRejected;
+            };
+
+
+            /** GenesisShard
+             *
+             *  The txids of the ledger memory pool indexed by the genesis-id mapping to this shard.
+             *
+             **/
+            struct GenesisShard
+            {
+                /** Mutex for concurrent reads of this shard. **/
+                mutable std::shared_mutex MUTEX;
 
-            /** Record of conflicted transactions in mempool. **/
-            std::map<uint512_t, uint512_t> mapClaimed;
+
+                /** The txids in the ledger memory pool by their genesis-id. **/
+                std::unordered_map<uint256_t, std::vector<uint512_t>, MempoolHash> mapIndex;
+            };
+
+
+            /** Mutex to serialize admission of transactions into the mempool. **/
+            mutable std::recursive_mutex MUTEX;
+
+
+            /** Mutex for the legacy inputs, which are read by the wallet outside of admission. **/
+            mutable std::mutex INPUTS_MUTEX;
+
+
+            /** The transactions striped by txid. **/
+            mutable std::array<Shard, MEMPOOL_SHARDS> vShards;
+
+
+            /** The genesis index striped by genesis-id. **/
+            mutable std::array<GenesisShard, MEMPOOL_SHARDS> vGenesis;
+
+
+            /** Oprhan transactions in queue. **/
+            std::unordered_map<uint512_t, TAO::Ledger::Transaction, MempoolHash> mapOrphans;
 
 
             /** Record of conflicted transactions in mempool. **/
-            std::set<uint512_t> mapRejected;
+            std::unordered_map<uint512_t, uint512_t, MempoolHash> mapClaimed;
 
 
             /** Record of legacy inputs in the mempool. **/
-            std::map<Legacy::OutPoint, uint512_t> mapInputs;
+            std::unordered_map<Legacy::OutPoint, uint512_t, MempoolHash> mapInputs;
 
 
             /** Set to keep track of duplicate orphans by index. **/
-            std::set<uint512_t> setOrphansByIndex;
+            std::unordered_set<uint512_t, MempoolHash> setOrphansByIndex;
 
         public:
 
@@ -331,6 +406,109 @@ namespace TAO
              **/
             uint32_t Conflicts();
 
+        private:
+
+            /** shard
+             *
+             *  Find the shard responsible for a given txid.
+             *
+             *  @param[in] hashTx The txid to find shard for.
+             *
+             *  @return A reference of the shard.
+             *
+             **/
+            Shard& shard(const uint512_t& hashTx) const;
+
+
+            /** genesis
+             *
+             *  Find the genesis index shard responsible for a given genesis-id.
+             *
+             *  @param[in] hashGenesis The genesis-id to find shard for.
+             *
+             *  @return A reference of the shard.
+             *
+             **/
+            GenesisShard& genesis(const uint256_t& hashGenesis) const;
+
+
+            /** index
+             *
+             *  Add a txid to the genesis index.
+             *
+             *  @param[in] hashGenesis The genesis-id of the transaction.
+             *  @param[in] hashTx The txid to add.
+             *
+             **/
+            void index(const uint256_t& hashGenesis, const uint512_t& hashTx);
+
+
+            /** deindex
+             *
+             *  Remove a txid from the genesis index.
+             *
+             *  @param[in] hashGenesis The genesis-id of the transaction.
+             *  @param[in] hashTx The txid to remove.
+             *
+             **/
+            void deindex(const uint256_t& hashGenesis, const uint512_t& hashTx);
+
+
+            /** reject
+             *
+             *  Record a transaction as rejected.
+             *
+             *  @param[in] hashTx The txid to reject.
+             *
+             **/
+            void reject(const uint512_t& hashTx);
+
+
+            /** rejected
+             *
+             *  Checks if a transaction was rejected.
+             *
+             *  @param[in] hashTx The txid to check.
+             *
+             *  @return true if the transaction was rejected.
+             *
+             **/
+            bool rejected(const uint512_t& hashTx) const;
+
+
+            /** conflict
+             *
+             *  Record a transaction as conflicted.
+             *
+             *  @param[in] hashTx The txid of the transaction.
+             *  @param[in] tx The conflicted transaction.
+             *
+             **/
+            void conflict(const uint512_t& hashTx, const TAO::Ledger::Transaction& tx);
+
+
+            /** has
+             *
+             *  Checks if a transaction is in the ledger memory pool, not including conflicts.
+             *
+             *  @param[in] hashTx The txid to check.
+             *
+             *  @return true if the transaction is in the ledger memory pool.
+             *
+             **/
+            bool has(const uint512_t& hashTx) const;
+
+
+            /** collect
+             *
+             *  Get the transactions of the ledger memory pool grouped by genesis-id.
+             *
+             *  @param[out] mapTransactions The transactions by genesis-id.
+             *  @param[in] fRejected Flag to include rejected transactions.
+             *
+             **/
+            void collect(std::map<uint256_t, std::vector<TAO::Ledger::Transaction>>& mapTransactions, const bool fRejected) const;
+
         };
 
         extern Mempool mempool;
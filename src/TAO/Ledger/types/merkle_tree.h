@@ -0,0 +1,125 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_LEDGER_TYPES_MERKLE_TREE_H
+#define NEXUS_TAO_LEDGER_TYPES_MERKLE_TREE_H
+
+#include <LLC/types/uint1024.h>
+
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /** Number of hash pairs in a slice of a level handed to the validation pool. **/
+        const uint32_t MERKLE_PARALLEL_PAIRS = 2048;
+
+
+        /** @class MerkleTree
+         *
+         *  Merkle tree of 512-bit hashes, where the last node of an odd level is paired with itself.
+         *  Keeps every level so that rebuilding after leaves are appended or replaced only rehashes the
+         *  nodes above the leaves that changed.
+         *
+         **/
+        class MerkleTree
+        {
+            /** The hashes of each level of the tree, leaves first and root last. **/
+            std::vector<std::vector<uint512_t>> vLevels;
+
+        public:
+
+            /** The default constructor. **/
+            MerkleTree();
+
+
+            /** Copy constructor. **/
+            MerkleTree(const MerkleTree& tree);
+
+
+            /** Move constructor. **/
+            MerkleTree(MerkleTree&& tree) noexcept;
+
+
+            /** Copy assignment. **/
+            MerkleTree& operator=(const MerkleTree& tree);
+
+
+            /** Move assignment. **/
+            MerkleTree& operator=(MerkleTree&& tree) noexcept;
+
+
+            /** Default Destructor **/
+            ~MerkleTree();
+
+
+            /** Build
+             *
+             *  Build the tree over the given leaves. Leaves that match the previous build keep their nodes, so
+             *  only the paths above the first changed leaf are rehashed. Large levels are hashed in parallel.
+             *
+             *  @param[in] vLeaves The leaf hashes of the tree.
+             *
+             *  @return The merkle root, 0 if there are no leaves.
+             *
+             **/
+            uint512_t Build(const std::vector<uint512_t>& vLeaves);
+
+
+            /** Root
+             *
+             *  Get the merkle root of the last build.
+             *
+             *  @return The merkle root, 0 if there are no leaves.
+             *
+             **/
+            uint512_t Root() const;
+
+
+            /** Branch
+             *
+             *  Get the merkle branch of the leaf at given index.
+             *
+             *  @param[in] nIndex The index of the leaf.
+             *
+             *  @return The sibling hashes from the leaf up to the root.
+             *
+             **/
+            std::vector<uint512_t> Branch(uint32_t nIndex) const;
+
+
+            /** Size
+             *
+             *  Get the number of leaves in the tree.
+             *
+             **/
+            uint32_t Size() const;
+
+
+            /** Clear
+             *
+             *  Release all of the nodes of the tree.
+             *
+             **/
+            void Clear();
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,161 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_LEDGER_TYPES_SIGCACHE_H
+#define NEXUS_TAO_LEDGER_TYPES_SIGCACHE_H
+
+#include <LLC/types/uint1024.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /** SignatureCache
+         *
+         *  Bounded record of successful signature verifications, keyed on the txid together with
+         *  the hashes of the public key and signature. A transaction verified when entering the
+         *  memory pool can then skip Falcon / Brainpool verification when its block arrives.
+         *
+         *  Only successes are recorded, so a hit can never accept a signature that failed. The
+         *  cache is striped over shards with their own locks, each evicting its oldest entries.
+         *
+         **/
+        class SignatureCache
+        {
+            /** Shard
+             *
+             *  A slice of the cache with its own lock.
+             *
+             **/
+            struct Shard
+            {
+                /* Mutex for this shard. */
+                std::mutex MUTEX;
+
+                /* The verified keys for fast lookups. */
+                std::set<uint256_t> setVerified;
+
+                /* The verified keys in insertion order for eviction. */
+                std::deque<uint256_t> queueVerified;
+            };
+
+
+            /* The shards of the cache. */
+            std::vector<Shard> vShards;
+
+
+            /* The maximum entries of each shard. */
+            uint32_t nMaxEntries;
+
+
+            /* Total lookups that found a verification. */
+            std::atomic<uint64_t> nHits;
+
+
+            /* Total lookups that required a verification. */
+            std::atomic<uint64_t> nMisses;
+
+
+        public:
+
+            /** Default Constructor. **/
+            SignatureCache(const uint32_t nMaxEntriesIn = 131072, const uint32_t nShardsIn = 16);
+
+
+            /** Key
+             *
+             *  Build the cache key for a signature.
+             *
+             *  @param[in] hashTx The txid that was signed.
+             *  @param[in] vchPubKey The public key the signature was verified with.
+             *  @param[in] vchSig The signature.
+             *
+             *  @return The cache key.
+             *
+             **/
+            static uint256_t Key(const uint512_t& hashTx, const std::vector<uint8_t>& vchPubKey, const std::vector<uint8_t>& vchSig);
+
+
+            /** Has
+             *
+             *  Check if a signature was already verified, counting the lookup as a hit or miss.
+             *
+             *  @param[in] hashKey The cache key from Key().
+             *
+             *  @return True if the signature was verified before.
+             *
+             **/
+            bool Has(const uint256_t& hashKey);
+
+
+            /** Add
+             *
+             *  Record a successful verification.
+             *
+             *  @param[in] hashKey The cache key from Key().
+             *
+             **/
+            void Add(const uint256_t& hashKey);
+
+
+            /** Hits
+             *
+             *  Get the total lookups that skipped a verification.
+             *
+             **/
+            uint64_t Hits() const;
+
+
+            /** Misses
+             *
+             *  Get the total lookups that required a verification.
+             *
+             **/
+            uint64_t Misses() const;
+
+
+            /** Size
+             *
+             *  Get the total verifications held by the cache.
+             *
+             **/
+            uint64_t Size();
+
+
+        private:
+
+            /** Shard
+             *
+             *  Get the shard responsible for a given key.
+             *
+             **/
+            Shard& shard(const uint256_t& hashKey);
+
+        };
+
+        extern SignatureCache sigcache;
+    }
+}
+
+#endif
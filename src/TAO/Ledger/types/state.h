@@ -336,6 +336,28 @@ namespace TAO
             uint1024_t SignatureHash() const;
 
 
+            /** HashData
+             *
+             *  Get the bytes the block hash is computed over, the proof hash template before version 5
+             *  and the signature hash serialization after.
+             *
+             *  @return The bytes to hash with SK1024.
+             *
+             **/
+            std::vector<uint8_t> HashData() const;
+
+
+            /** GetHashes
+             *
+             *  Get the hashes of a batch of block states, hashing headers side by side in SIMD lanes.
+             *
+             *  @param[in] vStates The block states to hash.
+             *  @param[out] vHashes The hash of each state, in the same order.
+             *
+             **/
+            static void GetHashes(const std::vector<BlockState>& vStates, std::vector<uint1024_t>& vHashes);
+
+
             /** StakeHash
              *
              *  Prove that you staked a number of seconds based on weight.
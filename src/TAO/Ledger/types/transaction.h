@@ -237,6 +237,17 @@ namespace TAO::Ledger
         bool Check(const uint8_t nFlags = 0) const;
 
 
+        /** VerifySignature
+         *
+         *  Verify the signature of the transaction against its public key. This is stateless, so it
+         *  can be run on any thread, and a successful verification is remembered in the signature cache.
+         *
+         *  @return true if the signature is valid.
+         *
+         **/
+        bool VerifySignature() const;
+
+
         /** Verify
          *
          *  Verify a transaction contracts.
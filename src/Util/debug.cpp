@@ -23,9 +23,15 @@ ________________________________________________________________________________
 #include <Util/include/runtime.h>
 #include <Util/include/version.h>
 
+#include <Util/templates/ring_queue.h>
+
+#include <atomic>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdio>
+#include <ctime>
 #include <map>
+#include <thread>
 #include <vector>
 
 #include <iostream>
@@ -75,6 +81,124 @@ uint32_t nLogFiles;
 /* The maximum size threshold of each log file. */
 uint32_t nLogSizeMB;
 
+/* The number of records waiting for the writer thread before new ones are dropped. */
+const uint32_t LOG_QUEUE_SIZE = 16384;
+
+/* The number of bytes the writer thread collects before writing them out. */
+const uint32_t LOG_BATCH_BYTES = 64 * 1024;
+
+/* Queue of formatted records waiting for the writer thread. */
+util::RingQueue<std::string> queueLog(LOG_QUEUE_SIZE);
+
+/* Flag indicating records are handed to the writer thread. */
+std::atomic<bool> fLogAsync(false);
+
+/* Flag to tell the writer thread to stop once the queue is empty. */
+std::atomic<bool> fLogStop(false);
+
+/* Flag indicating the writer thread is waiting for records. */
+std::atomic<bool> fLogWaiting(false);
+
+/* The number of records dropped since the writer thread last reported them. */
+std::atomic<uint64_t> nLogDropped(0);
+
+/* Mutex and condition to wake the writer thread. Producers never take the mutex. */
+std::mutex LOG_MUTEX;
+std::condition_variable LOG_CONDITION;
+
+/* The writer thread. */
+std::thread LOG_THREAD;
+
+
+/* Append a record with its timestamp to a buffer. */
+void format_record(std::string &strRecord, const time_t& nTimestamp, const std::string& strDebug)
+{
+    /* Use the reentrant localtime, records are formatted outside of any lock. */
+    struct tm tmLocal;
+#ifdef WIN32
+    localtime_s(&tmLocal, &nTimestamp);
+#else
+    localtime_r(&nTimestamp, &tmLocal);
+#endif
+
+    char chTime[16];
+    const size_t nLength = strftime(chTime, sizeof(chTime), "%H:%M:%S", &tmLocal);
+
+    char chMillis[8];
+    snprintf(chMillis, sizeof(chMillis), ".%03u] ", static_cast<uint32_t>(runtime::timestamp(true) % 1000));
+
+    strRecord.reserve(strRecord.size() + strDebug.size() + 24);
+    strRecord += "[";
+    strRecord.append(chTime, nLength);
+    strRecord += chMillis;
+    strRecord += strDebug;
+    strRecord += "\n";
+}
+
+
+/* Write a batch of records to console and debug file and check if the file should be archived. */
+void write_batch(const std::string& strBatch)
+{
+    std::cout.write(strBatch.data(), strBatch.size());
+    std::cout.flush();
+
+    ssFile.write(strBatch.data(), strBatch.size());
+    ssFile.flush();
+
+    /* Check if the current file should be archived and take action. */
+    check_log_archive(ssFile);
+}
+
+
+/* Thread writing the queued records in batches. */
+void LogWriter()
+{
+    std::string strRecord;
+    std::string strBatch;
+    strBatch.reserve(LOG_BATCH_BYTES * 2);
+
+    while(true)
+    {
+        /* Collect the records waiting into one batch. */
+        while(strBatch.size() < LOG_BATCH_BYTES && queueLog.Pop(strRecord))
+        {
+            strBatch += strRecord;
+            strRecord.clear();
+        }
+
+        /* Report the records lost while the queue was full. */
+        const uint64_t nDropped = nLogDropped.exchange(0);
+        if(nDropped > 0)
+            format_record(strBatch, std::time(nullptr),
+                safe_printstr(ANSI_COLOR_BRIGHT_YELLOW, "WARNING: ", ANSI_COLOR_RESET, "log queue full, dropped ", nDropped, " records"));
+
+        /* Write out what we have and look for more straight away. */
+        if(!strBatch.empty())
+        {
+            {
+                LOCK(DEBUG_MUTEX);
+                write_batch(strBatch);
+            }
+            strBatch.clear();
+
+            continue;
+        }
+
+        /* Only stop once everything queued has been written. */
+        if(fLogStop.load())
+            break;
+
+        /* Wait for a producer to wake us, the timeout covers a wakeup missed between these two lines. */
+        fLogWaiting.store(true);
+        {
+            LOCK(LOG_MUTEX);
+            LOG_CONDITION.wait_for(lk, std::chrono::milliseconds(10));
+        }
+        fLogWaiting.store(false);
+    }
+}
+
+
 
 /* Write startup information into the log file */
 void Initialize()
@@ -103,11 +227,43 @@ void Initialize()
 }
 
 
+/* Start the thread writing log records in batches. */
+void StartWriter()
+{
+    /* Keep writing every record as it is logged if requested. */
+    if(config::GetBoolArg("-logsync", false) || LOG_THREAD.joinable())
+        return;
+
+    fLogStop.store(false);
+    LOG_THREAD = std::thread(LogWriter);
+
+    fLogAsync.store(true);
+}
+
+
 /*  Close the debug log file. */
 void Shutdown()
 {
     try
     {
+        /* Go back to writing directly and let the writer thread finish the queue. */
+        if(LOG_THREAD.joinable())
+        {
+            fLogAsync.store(false);
+            fLogStop.store(true);
+
+            LOG_CONDITION.notify_one();
+            LOG_THREAD.join();
+
+            /* Write any record queued while the writer thread was stopping. */
+            std::string strRecord;
+            while(queueLog.Pop(strRecord))
+            {
+                LOCK(DEBUG_MUTEX);
+                write_batch(strRecord);
+            }
+        }
+
         /* Close our debug file on shutdown. */
         if(ssFile.is_open())
             ssFile.close();
@@ -249,28 +405,35 @@ std::string rfc1123Time()
 
 
 /*  Writes log output to console and debug file with timestamps.
- *  Encapsulated log for improved compile time. Not thread safe. */
+ *  Encapsulated log for improved compile time. */
 void _log(const time_t& nTimestamp, const std::string& strDebug)
 {
     //#ifndef UNIT_TESTS
 
-    /* Build the timestamp */
-    std::string strFinal = safe_printstr(
-        "[",
-        std::put_time(std::localtime(&nTimestamp), "%H:%M:%S"),
-        ".",
-        std::setfill('0'),
-        std::setw(3),
-        (runtime::timestamp(true) % 1000),
-        "] ", strDebug
-    );
-
-    /* Dump it to the console. */
-    std::cout << strFinal << std::endl;
-    ssFile    << strFinal << std::endl;
+    /* Build the record in this thread's buffer, which is swapped with an emptied one when it is queued. */
+    thread_local std::string strRecord;
+    strRecord.clear();
+    format_record(strRecord, nTimestamp, strDebug);
 
-    /* Check if the current file should be archived and take action. */
-    check_log_archive(ssFile);
+    /* Hand the record to the writer thread, dropping it rather than waiting if the queue is full. */
+    if(fLogAsync.load())
+    {
+        if(!queueLog.Push(strRecord))
+        {
+            ++nLogDropped;
+            return;
+        }
+
+        /* Wake the writer thread if it is idle. */
+        if(fLogWaiting.load())
+            LOG_CONDITION.notify_one();
+
+        return;
+    }
+
+    /* Write directly when there is no writer thread. */
+    LOCK(DEBUG_MUTEX);
+    write_batch(strRecord);
 
     //#endif
 }
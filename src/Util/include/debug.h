@@ -123,12 +123,21 @@ namespace debug
 
     /** Shutdown
      *
-     *  Close the debug log file.
+     *  Write out the records still queued, stop the writer thread and close the debug log file.
      *
      **/
     void Shutdown();
 
 
+    /** StartWriter
+     *
+     *  Start the thread writing log records in batches, after which logging no longer waits on the console or
+     *  the log file. Records that don't fit in the queue are dropped and counted. Disabled with -logsync.
+     *
+     **/
+    void StartWriter();
+
+
     /** LogStartup
      *
      *  Log startup information.
@@ -163,7 +172,8 @@ namespace debug
     /** log_
      *
      *  Writes log output to console and debug file with timestamps.
-     *  Encapsulated log for improved compile time. Not thread safe.
+     *  Encapsulated log for improved compile time. Hands the record to the writer thread once it is running,
+     *  otherwise writes it directly under DEBUG_MUTEX.
      *
      **/
      void _log(const time_t& nTimestamp, const std::string& strDebug);
@@ -188,11 +198,8 @@ namespace debug
         /* We catch execption here to prevent crashes on shutdown for iOS. */
         try
         {
-            /* Lock the mutex. */
-            LOCK(DEBUG_MUTEX);
-
-            /* Get the debug string and log file. */
-            std::string strDebug = safe_printstr(args...);
+            /* Get the debug string, formatted without holding any lock. */
+            const std::string strDebug = safe_printstr(args...);
 
             /* Get the timestamp. */
             time_t nTimestamp = std::time(nullptr);
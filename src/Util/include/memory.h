@@ -25,6 +25,8 @@ ________________________________________________________________________________
 
 #include <openssl/rand.h>
 
+#include <memory>
+
 namespace memory
 {
 
@@ -218,6 +220,142 @@ namespace memory
     };
 
 
+    /** snapshot
+     *
+     *  Publishes immutable copies of an object through a shared pointer.
+     *
+     *  Readers get a reference counted view of the current copy without a lock or a copy of the object. A
+     *  published copy is never modified: a store publishes a new one, and readers still holding the old one
+     *  keep it alive until they let go of it.
+     *
+     **/
+    template<class TypeName>
+    class snapshot
+    {
+        /* The current published copy. */
+        std::shared_ptr<const TypeName> pdata;
+
+
+    public:
+
+        /** Default Constructor. **/
+        snapshot()
+        : pdata(std::make_shared<const TypeName>())
+        {
+        }
+
+
+        /** Constructor for storing. **/
+        snapshot(const TypeName& dataIn)
+        : pdata(std::make_shared<const TypeName>(dataIn))
+        {
+        }
+
+
+        /** Assignment operator.
+         *
+         *  @param[in] a The snapshot to share the current copy of.
+         *
+         **/
+        snapshot& operator=(const snapshot& a)
+        {
+            std::atomic_store(&pdata, a.get());
+            return (*this);
+        }
+
+
+        /** Assignment operator.
+         *
+         *  @param[in] dataIn The object to publish.
+         *
+         **/
+        snapshot& operator=(const TypeName& dataIn)
+        {
+            store(dataIn);
+            return (*this);
+        }
+
+
+        /** Equivilent operator.
+         *
+         *  @param[in] a The snapshot to compare to.
+         *
+         **/
+        bool operator==(const snapshot& a) const
+        {
+            return *get() == *a.get();
+        }
+
+
+        /** Equivilent operator.
+         *
+         *  @param[in] a The data type to compare to.
+         *
+         **/
+        bool operator==(const TypeName& dataIn) const
+        {
+            return *get() == dataIn;
+        }
+
+
+        /** Not equivilent operator.
+         *
+         *  @param[in] a The snapshot to compare to.
+         *
+         **/
+        bool operator!=(const snapshot& a) const
+        {
+            return *get() != *a.get();
+        }
+
+
+        /** Not equivilent operator.
+         *
+         *  @param[in] a The data type to compare to.
+         *
+         **/
+        bool operator!=(const TypeName& dataIn) const
+        {
+            return *get() != dataIn;
+        }
+
+
+        /** get
+         *
+         *  Get a view of the current copy, which stays valid and unchanged for as long as it is held.
+         *
+         **/
+        std::shared_ptr<const TypeName> get() const
+        {
+            return std::atomic_load(&pdata);
+        }
+
+
+        /** load
+         *
+         *  Get a copy of the object, for callers that need to modify it.
+         *
+         **/
+        const TypeName load() const
+        {
+            return *get();
+        }
+
+
+        /** store
+         *
+         *  Publish a new copy of an object.
+         *
+         *  @param[in] dataIn The data to publish.
+         *
+         **/
+        void store(const TypeName& dataIn)
+        {
+            std::atomic_store(&pdata, std::make_shared<const TypeName>(dataIn));
+        }
+    };
+
+
     /** encrypted
      *
      *  Abstract base class for encrypting specific data types in a class.
@@ -0,0 +1,146 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_UTIL_TEMPLATES_RING_QUEUE_H
+#define NEXUS_UTIL_TEMPLATES_RING_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace util
+{
+    /** RingQueue
+     *
+     *  Bounded lock-free queue for many producers and a single consumer.
+     *
+     *  Every slot carries a sequence number telling whether it is free for the producer claiming that position
+     *  or filled for the consumer, so producers only contend on the tail index and never wait on each other.
+     *  Items are swapped in and out of the slots rather than copied, so a producer that hands over a string gets
+     *  back a buffer the consumer has already emptied and the queue keeps reusing the same allocations.
+     *
+     **/
+    template<typename Type>
+    class RingQueue
+    {
+        /** Slot holding an item and its sequence number. **/
+        struct Slot
+        {
+            std::atomic<uint64_t> nSequence;
+            Type tData;
+        };
+
+
+        /** The slots of the ring. **/
+        std::vector<Slot> vSlots;
+
+
+        /** Mask to get a slot from a position. **/
+        const uint64_t nMask;
+
+
+        /** The next position for producers to claim. **/
+        alignas(64) std::atomic<uint64_t> nTail;
+
+
+        /** The next position for the consumer to take. **/
+        alignas(64) uint64_t nHead;
+
+
+    public:
+
+        /** Constructor
+         *
+         *  @param[in] nSize The number of slots, which must be a power of two.
+         *
+         **/
+        RingQueue(const uint64_t nSize)
+        : vSlots (nSize)
+        , nMask  (nSize - 1)
+        , nTail  (0)
+        , nHead  (0)
+        {
+            for(uint64_t n = 0; n < nSize; ++n)
+                vSlots[n].nSequence.store(n, std::memory_order_relaxed);
+        }
+
+
+        /** Push
+         *
+         *  Add an item to the queue from any thread. The item is swapped with the contents of the slot.
+         *
+         *  @param[in,out] tData The item to add, left with the old contents of the slot.
+         *
+         *  @return false if the queue is full, leaving the item untouched.
+         *
+         **/
+        bool Push(Type& tData)
+        {
+            uint64_t nPos = nTail.load(std::memory_order_relaxed);
+            while(true)
+            {
+                Slot& slot = vSlots[nPos & nMask];
+
+                /* The slot is free for this position once the consumer has moved its sequence past the last lap. */
+                const int64_t nDiff = static_cast<int64_t>(slot.nSequence.load(std::memory_order_acquire) - nPos);
+                if(nDiff == 0)
+                {
+                    /* Claim the position, otherwise another producer got it and we retry with the new tail. */
+                    if(nTail.compare_exchange_weak(nPos, nPos + 1, std::memory_order_relaxed))
+                    {
+                        std::swap(slot.tData, tData);
+                        slot.nSequence.store(nPos + 1, std::memory_order_release);
+
+                        return true;
+                    }
+                }
+
+                /* The consumer hasn't emptied this slot yet, so the ring is full. */
+                else if(nDiff < 0)
+                    return false;
+
+                else
+                    nPos = nTail.load(std::memory_order_relaxed);
+            }
+        }
+
+
+        /** Pop
+         *
+         *  Take the next item off the queue. Only one thread may call this.
+         *
+         *  @param[in,out] tData The item taken, with its old contents given to the slot.
+         *
+         *  @return false if the queue is empty.
+         *
+         **/
+        bool Pop(Type& tData)
+        {
+            Slot& slot = vSlots[nHead & nMask];
+
+            /* Check that a producer has finished writing this position. */
+            if(slot.nSequence.load(std::memory_order_acquire) != nHead + 1)
+                return false;
+
+            std::swap(tData, slot.tData);
+            slot.nSequence.store(nHead + vSlots.size(), std::memory_order_release);
+            ++nHead;
+
+            return true;
+        }
+    };
+}
+
+#endif
@@ -21,6 +21,7 @@ ________________________________________________________________________________
 #include <LLP/include/channel_state_manager.h>
 
 #include <LLD/include/global.h>
+#include <LLD/include/snapshot.h>
 
 #include <TAO/API/include/global.h>
 #include <TAO/API/include/cmd.h>
@@ -267,8 +268,25 @@ int main(int argc, char** argv)
     }
 
 
+    /* Move log writes off the calling threads, after Daemonize() so the writer thread lives in the process that keeps running. */
+    debug::StartWriter();
+
+
     /* Check for failures or shutdown. */
     bool fFailed = config::fShutdown.load();
+
+    /* Import a snapshot of the consensus databases before they are opened. */
+    uint1024_t hashSnapshot = 0;
+    const bool fSnapshot = (!fFailed && config::HasArg("-snapshot-import"));
+    if(fSnapshot)
+    {
+        if(!LLD::SnapshotImport(config::GetArg("-snapshot-import", ""), hashSnapshot))
+        {
+            config::fShutdown.store(true);
+            fFailed = true;
+        }
+    }
+
     if(!fFailed)
     {
         /* Initialize LLD. */
@@ -283,6 +301,40 @@ int main(int argc, char** argv)
         TAO::Ledger::ChainState::Initialize();
 
 
+        /* Keep an imported snapshot only if its databases hold the best chain its manifest claims. */
+        if(fSnapshot)
+        {
+            if(TAO::Ledger::ChainState::hashBestChain.load() != hashSnapshot)
+            {
+                debug::error(FUNCTION, "snapshot best chain ", TAO::Ledger::ChainState::hashBestChain.load().SubString(),
+                    " does not match manifest ", hashSnapshot.SubString());
+
+                /* Shutdown and put the previous databases back. */
+                TAO::Ledger::Dispatch::Shutdown();
+                LLD::Shutdown();
+                LLD::SnapshotRollback();
+                debug::Shutdown();
+
+                return 1;
+            }
+
+            LLD::SnapshotCommit();
+        }
+
+
+        /* Export a snapshot if we are at the height asked for. This only happens here, before indexing or anything
+         * else can write to the databases through their write buffers, so the files match the best chain. */
+        if(config::HasArg("-snapshot-export"))
+        {
+            const uint32_t nSnapshotHeight = config::GetArg("-snapshot-export", 0);
+            if(TAO::Ledger::ChainState::nBestHeight.load() == nSnapshotHeight)
+                LLD::SnapshotExport(LLD::SnapshotPath(nSnapshotHeight), nSnapshotHeight, TAO::Ledger::ChainState::hashBestChain.load());
+            else
+                debug::warning(FUNCTION, "best chain is at height ", TAO::Ledger::ChainState::nBestHeight.load(),
+                    ", a snapshot at height ", nSnapshotHeight, " is only exported when starting at that height");
+        }
+
+
         /* Run our LLD indexing operations. */
         LLD::Indexing();
 
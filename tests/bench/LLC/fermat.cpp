@@ -0,0 +1,126 @@
+#include <Util/include/runtime.h>
+
+#include <LLC/include/random.h>
+#include <LLC/types/bignum.h>
+#include <LLC/prime/fermat.h>
+
+#include <TAO/Ledger/include/prime.h>
+
+#include <Util/include/debug.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <openssl/bn.h>
+
+
+/* The fermat test as it was done through OpenSSL, allocating big numbers for every candidate. */
+static uint1024_t FermatOpenSSL(const uint1024_t& hashTest)
+{
+    LLC::CAutoBN_CTX pctx;
+
+    LLC::CBigNum bnPrime(hashTest);
+    LLC::CBigNum bnBase(2);
+    LLC::CBigNum bnExp = bnPrime - 1;
+
+    LLC::CBigNum bnResult;
+    BN_mod_exp(bnResult.getBN(), bnBase.getBN(), bnExp.getBN(), bnPrime.getBN(), pctx);
+
+    return bnResult.getuint1024();
+}
+
+
+TEST_CASE( "Fermat Verification Benchmarks", "[LLC]")
+{
+    debug::log(0, "===== Begin Fermat Verification Benchmarks =====");
+
+    //clusters of candidates the way a prime block lays them out, full width origins with the top bit set
+    const uint32_t nClusters = 200;
+    const uint32_t nSize     = 6;
+
+    std::vector<uint1024_t> vCandidates;
+    for(uint32_t n = 0; n < nClusters; n++)
+    {
+        uint1024_t hashOrigin = LLC::GetRand1024();
+        hashOrigin |= (uint1024_t(1) << 1023);
+        hashOrigin |= 1;
+
+        for(uint32_t i = 0; i < nSize; i++)
+            vCandidates.push_back(hashOrigin + (i * 2));
+    }
+
+
+    //check that both paths agree before timing them
+    for(uint32_t n = 0; n < nSize * 4; n++)
+        REQUIRE(fermat_remainder(vCandidates[n]) == FermatOpenSSL(vCandidates[n]));
+
+
+    //one big number exponentiation per candidate
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        uint32_t nPass = 0;
+        for(const auto& hashCandidate : vCandidates)
+            if(FermatOpenSSL(hashCandidate) == 1)
+                ++nPass;
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "OpenSSL::", ANSI_COLOR_RESET, vCandidates.size(), " candidates in ", nTime, " microseconds (",
+            double(nTime) / vCandidates.size(), " per candidate) ", nPass, " passed");
+    }
+
+
+    //the fixed width montgomery kernel
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        uint32_t nPass = 0;
+        for(const auto& hashCandidate : vCandidates)
+            if(fermat_remainder(hashCandidate) == 1)
+                ++nPass;
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Montgomery::", ANSI_COLOR_RESET, vCandidates.size(), " candidates in ", nTime, " microseconds (",
+            double(nTime) / vCandidates.size(), " per candidate) ", nPass, " passed");
+    }
+
+
+    //the kernel over whole clusters
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        uint1024_t vRemainders[nSize];
+
+        uint32_t nPass = 0;
+        for(uint32_t n = 0; n < nClusters; n++)
+        {
+            fermat_cluster(&vCandidates[n * nSize], vRemainders, nSize);
+            for(uint32_t i = 0; i < nSize; i++)
+                if(vRemainders[i] == 1)
+                    ++nPass;
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Cluster::", ANSI_COLOR_RESET, nClusters, " clusters in ", nTime, " microseconds (",
+            double(nTime) / nClusters, " per cluster) ", nPass, " passed");
+    }
+
+
+    //full verification of the same clusters, divisors and fermat before Miller-Rabin
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        uint32_t nPrimes = 0;
+        for(uint32_t n = 0; n < nClusters; n++)
+            nPrimes += TAO::Ledger::PrimeCluster(&vCandidates[n * nSize], nSize);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "PrimeCluster::", ANSI_COLOR_RESET, nClusters, " clusters in ", nTime, " microseconds (",
+            double(nTime) / nClusters, " per cluster) ", nPrimes, " primes");
+    }
+
+    debug::log(0, "===== End Fermat Verification Benchmarks =====\n");
+}
@@ -0,0 +1,78 @@
+#include <Util/include/runtime.h>
+
+#include <LLC/include/random.h>
+#include <LLC/hash/SK.h>
+
+#include <TAO/Ledger/types/state.h>
+
+#include <Util/include/debug.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <ctime>
+
+
+TEST_CASE( "SK1024 Header Hashing Benchmarks", "[LLC]")
+{
+    debug::log(0, "===== Begin SK1024 Header Hashing Benchmarks =====");
+
+    //a batch of version 7 headers the way a sync batch read returns them
+    const uint32_t nHeaders = 20000;
+
+    std::vector<TAO::Ledger::BlockState> vStates(nHeaders);
+    for(uint32_t n = 0; n < nHeaders; n++)
+    {
+        TAO::Ledger::BlockState& state = vStates[n];
+        state.nVersion       = 7;
+        state.hashPrevBlock  = LLC::GetRand1024();
+        state.hashMerkleRoot = LLC::GetRand512();
+        state.nChannel       = (n % 3);
+        state.nHeight        = n;
+        state.nBits          = LLC::GetRandInt(0xffffffff);
+        state.nNonce         = LLC::GetRand();
+        state.nTime          = runtime::unifiedtimestamp();
+
+        if(state.nChannel == 1)
+            state.vOffsets = { 0, 4, 6, 10, 12, 16, 0, 0, 0, 0 };
+    }
+
+
+    //check that the batch agrees with hashing one header at a time
+    std::vector<uint1024_t> vHashes;
+    TAO::Ledger::BlockState::GetHashes(vStates, vHashes);
+    for(uint32_t n = 0; n < 64; n++)
+        REQUIRE(vHashes[n] == vStates[n].GetHash());
+
+
+    //one header at a time through the cached single message hash
+    {
+        const std::clock_t nStart = std::clock();
+        for(const auto& state : vStates)
+            state.GetHash();
+
+        const double dCPU = double(std::clock() - nStart) / CLOCKS_PER_SEC;
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "GetHash::", ANSI_COLOR_RESET, nHeaders, " headers in ", dCPU * 1000000, " CPU microseconds (",
+            uint64_t(nHeaders / dCPU), " headers/s per core)");
+    }
+
+
+    //the batch hash at every lane width the processor supports
+    std::vector<std::vector<uint8_t>> vData;
+    for(const auto& state : vStates)
+        vData.emplace_back(state.HashData());
+
+    for(const uint32_t nLanes : {1u, 4u, 8u})
+    {
+        if(nLanes > LLC::SK1024Lanes())
+            break;
+
+        const std::clock_t nStart = std::clock();
+        LLC::SK1024(vData, vHashes, nLanes);
+
+        const double dCPU = double(std::clock() - nStart) / CLOCKS_PER_SEC;
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "SK1024x", nLanes, "::", ANSI_COLOR_RESET, nHeaders, " headers in ", dCPU * 1000000, " CPU microseconds (",
+            uint64_t(nHeaders / dCPU), " headers/s per core)");
+    }
+
+    debug::log(0, "===== End SK1024 Header Hashing Benchmarks =====\n");
+}
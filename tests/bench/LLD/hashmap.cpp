@@ -0,0 +1,86 @@
+#include <Util/include/runtime.h>
+
+#include <LLC/include/random.h>
+
+#include <LLD/keychain/hashmap.h>
+#include <LLD/templates/key.h>
+
+#include <LLD/include/enum.h>
+#include <LLD/include/version.h>
+
+#include <Util/templates/datastream.h>
+#include <Util/include/filesystem.h>
+#include <Util/include/args.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "Binary Hashmap Benchmarks", "[LLD]")
+{
+    debug::log(0, "===== Begin Binary Hashmap Miss-Heavy Benchmarks =====");
+
+    //use a small bucket count so that buckets collide over several hashmap files
+    LLD::BinaryHashMap* keychain =
+        new LLD::BinaryHashMap(config::GetDataDir() + "_BENCH/keychain/", LLD::FLAGS::CREATE | LLD::FLAGS::FORCE, 4096);
+
+    const uint256_t hash = LLC::GetRand256();
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(int i = 0; i < 20000; i++)
+        {
+            DataStream ssKey(SER_LLD, LLD::DATABASE_VERSION);
+            ssKey << std::make_pair(std::string("exists"), hash + i);
+
+            keychain->Put(LLD::SectorKey(LLD::STATE::READY, ssKey.Bytes(), 0, i, 0));
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Put::", ANSI_COLOR_RESET, "20k keys in ", nTime, " microseconds (", (20000000000) / nTime, ") per/s");
+    }
+
+
+    //lookups for keys that were never written, as with Has* checks during sync
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        uint32_t nFound = 0;
+        for(int i = 0; i < 20000; i++)
+        {
+            DataStream ssKey(SER_LLD, LLD::DATABASE_VERSION);
+            ssKey << std::make_pair(std::string("missing"), hash + i);
+
+            LLD::SectorKey cKey;
+            if(keychain->Get(ssKey.Bytes(), cKey))
+                ++nFound;
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Miss::", ANSI_COLOR_RESET, "20k keys in ", nTime, " microseconds (", (20000000000) / nTime, ") per/s ", nFound, " false hits");
+    }
+
+
+    //lookups for keys that exist
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(int i = 0; i < 20000; i++)
+        {
+            DataStream ssKey(SER_LLD, LLD::DATABASE_VERSION);
+            ssKey << std::make_pair(std::string("exists"), hash + i);
+
+            LLD::SectorKey cKey;
+            keychain->Get(ssKey.Bytes(), cKey);
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Hit::", ANSI_COLOR_RESET, "20k keys in ", nTime, " microseconds (", (20000000000) / nTime, ") per/s");
+    }
+
+    delete keychain;
+
+    debug::log(0, "===== End Binary Hashmap Miss-Heavy Benchmarks =====\n");
+}
@@ -0,0 +1,54 @@
+#include <Util/include/runtime.h>
+
+#include <LLD/templates/journal.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/filesystem.h>
+#include <Util/include/config.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <thread>
+
+
+TEST_CASE( "Journal Group Commit Benchmarks", "[LLD]")
+{
+    debug::log(0, "===== Begin Journal Group Commit Benchmarks =====");
+
+    LLD::Journal* journal = LLD::Journal::Open(config::GetDataDir() + "_BENCH_journal.dat");
+
+    //a block sized checkpoint
+    const std::vector<uint8_t> vData(4096, 0xaa);
+
+    //concurrent committers share each flush as the thread count grows
+    for(const uint32_t nThreads : {1u, 2u, 4u, 8u, 16u})
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<std::thread> vThreads;
+        for(uint32_t t = 0; t < nThreads; t++)
+        {
+            vThreads.push_back(std::thread([&, t]()
+            {
+                const std::string strName = debug::safe_printstr("bench", t);
+                for(int i = 0; i < 200; i++)
+                {
+                    journal->Sync(journal->Append(strName, vData));
+                    journal->Release(strName, std::set<std::string>());
+                }
+            }));
+        }
+
+        for(auto& thread : vThreads)
+            thread.join();
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Commit::", ANSI_COLOR_RESET, nThreads, " threads ", 200 * nThreads, " commits in ", nTime,
+            " microseconds (", (200 * nThreads * 1000000.0) / nTime, ") per/s");
+    }
+
+    LLD::Journal::Close(journal);
+
+    debug::log(0, "===== End Journal Group Commit Benchmarks =====\n");
+}
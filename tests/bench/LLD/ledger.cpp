@@ -3,10 +3,14 @@
 #include <LLC/include/random.h>
 
 #include <LLD/cache/binary_lru.h>
+#include <LLD/cache/file_pool.h>
 
 #include <LLD/include/global.h>
 
 #include <Util/templates/datastream.h>
+#include <Util/include/filesystem.h>
+
+#include <fstream>
 
 #include <unit/catch2/catch.hpp>
 
@@ -66,4 +70,79 @@ TEST_CASE( "LLD Benchamrks", "[LLD]")
 
 
     debug::log(0, "===== End Ledger Sequential Read Benchmarks =====\n");
+
+
+    debug::log(0, "===== Begin Ledger Batch Read Benchmarks =====");
+
+
+    {
+        std::vector<uint1024_t> vHashes;
+        for(int i = 0; i < 5000; i++)
+            vHashes.push_back(uint1024_t(i));
+
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<TAO::Ledger::BlockState> vStates;
+        std::vector<bool> vFound;
+        const uint32_t nFound = LLD::Ledger->ReadMany(vHashes, vStates, vFound);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "ReadMany::", ANSI_COLOR_RESET, nFound, " records in ", nTime, " microseconds (", (nFound * 1000000) / nTime, ") per/s");
+    }
+
+
+    debug::log(0, "===== End Ledger Batch Read Benchmarks =====\n");
+
+
+    debug::log(0, "===== Begin Ledger Cold Read Benchmarks =====");
+
+    /* Give the cache writer a chance to flush our records to disk. */
+    runtime::sleep(1000);
+
+    /* Cold reads bypass the cache and go straight to the sector file. */
+    const std::string strBase = config::GetDataDir() + "_LEDGER/datachain/";
+    const std::string strPath =
+        debug::safe_printstr(strBase, "_block.", std::setfill('0'), std::setw(5), 0);
+
+    const int64_t nFileSize = filesystem::size(strPath);
+    if(nFileSize > 256)
+    {
+        /* Spread our reads evenly over the file. */
+        const uint64_t nStride = (nFileSize - 256) / 5000;
+
+        //ifstream per read (previous behavior)
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            std::vector<uint8_t> vData(256, 0);
+            for(int i = 0; i < 5000; i++)
+            {
+                std::ifstream stream(strPath, std::ios::in | std::ios::binary);
+                stream.seekg(i * nStride, std::ios::beg);
+                stream.read((char*) &vData[0], vData.size());
+            }
+
+            uint64_t nTime = timer.ElapsedMicroseconds();
+            debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "ifstream::", ANSI_COLOR_RESET, "5k records in ", nTime, " microseconds (", (5000000000) / nTime, ") per/s");
+        }
+
+        //pooled descriptors with positional reads
+        {
+            LLD::FilePool pool(strBase);
+
+            runtime::timer timer;
+            timer.Start();
+
+            std::vector<uint8_t> vData(256, 0);
+            for(int i = 0; i < 5000; i++)
+                pool.Read(0, i * nStride, vData);
+
+            uint64_t nTime = timer.ElapsedMicroseconds();
+            debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "pread::", ANSI_COLOR_RESET, "5k records in ", nTime, " microseconds (", (5000000000) / nTime, ") per/s");
+        }
+    }
+
+    debug::log(0, "===== End Ledger Cold Read Benchmarks =====\n");
 }
@@ -0,0 +1,127 @@
+#include <Util/include/runtime.h>
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <TAO/Register/include/create.h>
+#include <TAO/Register/types/address.h>
+#include <TAO/Register/types/object.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <map>
+
+
+TEST_CASE( "Register Scan Benchmarks", "[LLD]")
+{
+    debug::log(0, "===== Begin Register Scan Benchmarks =====");
+
+    //write a dataset of accounts for the list scans
+    const uint32_t nAccounts = 50000;
+    for(uint32_t n = 0; n < nAccounts; n++)
+    {
+        TAO::Register::Object account = TAO::Register::CreateAccount(0);
+        account.hashOwner = LLC::GetRand256();
+        account.nModified = LLC::GetRand(nAccounts);
+        account.SetChecksum();
+
+        REQUIRE(LLD::Register->WriteState(TAO::Register::Address(TAO::Register::Address::ACCOUNT), account));
+    }
+
+    const uint32_t nPage = 100;
+
+    //read every account and then filter them, the way list commands read before planning
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<TAO::Register::Object> vObjects;
+        REQUIRE(LLD::Register->BatchRead("account", vObjects, -1));
+
+        uint32_t nFound = 0;
+        for(auto& rObject : vObjects)
+        {
+            if(rObject.Parse() && (rObject.nModified % 2 == 0) && ++nFound == nPage)
+                break;
+        }
+
+        REQUIRE(nFound == nPage);
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "BatchRead::", ANSI_COLOR_RESET, "first page of ", vObjects.size(), " accounts in ", nTime, "ms");
+    }
+
+
+    //filter each account as it is read, stopping once the page is full
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        uint32_t nFound = 0, nRead = 0;
+        LLD::Register->BatchRead<TAO::Register::Object>("account", [&](TAO::Register::Object& rObject)
+        {
+            ++nRead;
+            if(rObject.Parse() && (rObject.nModified % 2 == 0))
+                ++nFound;
+
+            return nFound < nPage;
+        });
+
+        REQUIRE(nFound == nPage);
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "BatchRead::", ANSI_COLOR_RESET, "first page stopping after ", nRead, " accounts in ", nTime, "ms");
+    }
+
+
+    //filter each account as it is read, keeping only the most recently modified page
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        std::multimap<uint64_t, TAO::Register::Object> mapBest;
+        LLD::Register->BatchRead<TAO::Register::Object>("account", [&](TAO::Register::Object& rObject)
+        {
+            if(!rObject.Parse() || (rObject.nModified % 2 != 0))
+                return true;
+
+            if(mapBest.size() >= nPage && rObject.nModified <= mapBest.begin()->first)
+                return true;
+
+            mapBest.insert(std::make_pair(rObject.nModified, rObject));
+            if(mapBest.size() > nPage)
+                mapBest.erase(mapBest.begin());
+
+            return true;
+        });
+
+        REQUIRE(mapBest.size() == nPage);
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "BatchRead::", ANSI_COLOR_RESET, "sorted page of ", nAccounts, " accounts in ", nTime, "ms");
+    }
+
+
+    //read a page of accounts from the type index
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        REQUIRE(LLD::Register->CountTypes("account") >= nAccounts);
+
+        uint32_t nCursor = 0;
+        std::vector<uint256_t> vAddresses;
+        REQUIRE(LLD::Register->ListTypes("account", 0, vAddresses, nCursor, nPage));
+
+        std::vector<TAO::Register::State> vStates;
+        REQUIRE(LLD::Register->ReadState(vAddresses, vStates));
+        REQUIRE(vStates.size() == nPage);
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "ListTypes::", ANSI_COLOR_RESET, "first page of ", vStates.size(), " accounts in ", nTime, "ms");
+    }
+
+
+    debug::log(0, "===== End Register Scan Benchmarks =====\n");
+}
@@ -0,0 +1,74 @@
+#include <Util/include/runtime.h>
+
+#include <LLC/include/random.h>
+
+#include <LLD/cache/sharded_lru.h>
+#include <LLD/templates/key.h>
+
+#include <LLD/include/enum.h>
+#include <LLD/include/version.h>
+
+#include <Util/templates/datastream.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <thread>
+
+
+TEST_CASE( "Sharded LRU Benchmarks", "[LLD]")
+{
+    debug::log(0, "===== Begin Sharded LRU Benchmarks =====");
+
+    //build our keys up front so that serialization isn't part of the measurement
+    const uint256_t hash = LLC::GetRand256();
+
+    std::vector<std::vector<uint8_t>> vKeys;
+    for(int i = 0; i < 100000; i++)
+    {
+        DataStream ssKey(SER_LLD, LLD::DATABASE_VERSION);
+        ssKey << std::make_pair(std::string("data"), hash + i);
+
+        vKeys.push_back(ssKey.Bytes());
+    }
+
+    DataStream ssData(SER_LLD, LLD::DATABASE_VERSION);
+    ssData << uint1024_t(4934943);
+
+    //compare a single lock against the striped cache as reader threads scale
+    for(const uint32_t nShards : {1u, 32u})
+    {
+        LLD::ShardedLRU* cache = new LLD::ShardedLRU(64 * 1024 * 1024, nShards);
+        for(uint32_t i = 0; i < vKeys.size(); i++)
+            cache->Put(LLD::SectorKey(LLD::STATE::READY, vKeys[i], 0, i, 0), vKeys[i], ssData.Bytes());
+
+        for(const uint32_t nThreads : {1u, 2u, 4u, 8u, 16u, 32u})
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            //every thread reads the full key set
+            std::vector<std::thread> vThreads;
+            for(uint32_t t = 0; t < nThreads; t++)
+            {
+                vThreads.push_back(std::thread([&]()
+                {
+                    std::vector<uint8_t> vBytes;
+                    for(const auto& vKey : vKeys)
+                        cache->Get(vKey, vBytes);
+                }));
+            }
+
+            for(auto& thread : vThreads)
+                thread.join();
+
+            uint64_t nTime = timer.ElapsedMicroseconds();
+            debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Get::", ANSI_COLOR_RESET, nShards, " shards ", nThreads, " threads ",
+                (vKeys.size() * nThreads) / double(nTime), " million records / second");
+        }
+
+        delete cache;
+    }
+
+
+    debug::log(0, "===== End Sharded LRU Benchmarks =====\n");
+}
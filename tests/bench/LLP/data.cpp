@@ -0,0 +1,121 @@
+#include <Util/include/runtime.h>
+
+#include <LLP/templates/data.h>
+#include <LLP/types/time.h>
+#include <LLP/include/base_address.h>
+
+#include <Util/include/args.h>
+#include <Util/include/convert.h>
+#include <Util/include/debug.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <ctime>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+
+/* Write a whole buffer to a blocking socket. */
+static bool send_all(const int nFd, const std::vector<uint8_t>& vData)
+{
+    uint32_t nSent = 0;
+    while(nSent < vData.size())
+    {
+        const ssize_t nWrite = ::send(nFd, &vData[nSent], vData.size() - nSent, 0);
+        if(nWrite <= 0)
+            return false;
+
+        nSent += nWrite;
+    }
+
+    return true;
+}
+
+
+/* Read an exact number of bytes from a blocking socket. */
+static bool recv_all(const int nFd, std::vector<uint8_t>& vData)
+{
+    uint32_t nRead = 0;
+    while(nRead < vData.size())
+    {
+        const ssize_t nRecv = ::recv(nFd, &vData[nRead], vData.size() - nRead, 0);
+        if(nRecv <= 0)
+            return false;
+
+        nRead += nRecv;
+    }
+
+    return true;
+}
+
+
+TEST_CASE( "Data Thread Connection Scaling Benchmarks", "[LLP]")
+{
+    debug::log(0, "===== Begin Data Thread Connection Scaling Benchmarks =====");
+
+    //incoming time connections are only accepted without samples on testnet
+    config::fTestNet.store(true);
+
+    //make sure we can open enough descriptors for the idle connections
+    struct rlimit rLimit;
+    if(getrlimit(RLIMIT_NOFILE, &rLimit) == 0)
+    {
+        rLimit.rlim_cur = rLimit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &rLimit);
+    }
+
+    //GET_OFFSET request, answered by a 4 byte TIME_OFFSET
+    std::vector<uint8_t> vRequest = { 64, 0, 0, 0, 4 };
+    const std::vector<uint8_t> vTimestamp = convert::uint2bytes(static_cast<uint32_t>(runtime::unifiedtimestamp()));
+    vRequest.insert(vRequest.end(), vTimestamp.begin(), vTimestamp.end());
+
+    //one active connection among a growing number of idle ones, as on a seed node
+    for(const uint32_t nIdle : {0u, 250u, 1000u, 4000u})
+    {
+        LLP::DataThread<LLP::TimeNode>* pThread = new LLP::DataThread<LLP::TimeNode>(0, false, 0, 0, 600);
+
+        std::vector<int> vClients;
+        for(uint32_t n = 0; n <= nIdle; n++)
+        {
+            int vPair[2];
+            if(::socketpair(AF_UNIX, SOCK_STREAM, 0, vPair) != 0)
+                break;
+
+            pThread->AddConnection(LLP::Socket(vPair[0], LLP::BaseAddress()), nullptr);
+            vClients.push_back(vPair[1]);
+        }
+
+        //the last connection added is the active one
+        const int nActive = vClients.back();
+        runtime::sleep(100);
+
+        const uint32_t nMessages = 2000;
+        const std::clock_t nStart = std::clock();
+
+        runtime::timer timer;
+        timer.Start();
+
+        uint32_t nAnswered = 0;
+        for(uint32_t n = 0; n < nMessages; n++)
+        {
+            std::vector<uint8_t> vResponse(9, 0);
+            if(!send_all(nActive, vRequest) || !recv_all(nActive, vResponse))
+                break;
+
+            ++nAnswered;
+        }
+
+        const uint64_t nTime = timer.ElapsedMicroseconds();
+        const double dCPU    = (std::clock() - nStart) * 1000000.0 / CLOCKS_PER_SEC;
+
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "RoundTrip::", ANSI_COLOR_RESET, vClients.size() - 1, " idle connections ",
+            nAnswered, " messages in ", nTime, " microseconds, ", dCPU / std::max(nAnswered, 1u), " CPU microseconds / message");
+
+        delete pThread;
+        for(const int nFd : vClients)
+            ::close(nFd);
+    }
+
+    debug::log(0, "===== End Data Thread Connection Scaling Benchmarks =====\n");
+}
@@ -0,0 +1,164 @@
+#include <Util/include/runtime.h>
+
+#include <LLC/include/random.h>
+
+#include <LLP/types/tritium.h>
+#include <LLP/include/base_address.h>
+
+#include <Util/include/args.h>
+#include <Util/include/debug.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <ctime>
+#include <map>
+#include <memory>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+
+/* Subscribe a node to a notification mask, the same way a remote SUBSCRIBE would. */
+static void subscribe(LLP::TritiumNode* pNode, const std::vector<uint8_t>& vTypes)
+{
+    DataStream ssSubscribe(SER_NETWORK, LLP::PROTOCOL_VERSION);
+    for(const uint8_t nType : vTypes)
+        ssSubscribe << nType;
+
+    pNode->INCOMING = LLP::TritiumNode::NewMessage(LLP::TritiumNode::ACTION::SUBSCRIBE, ssSubscribe);
+    pNode->ProcessPacket();
+}
+
+
+TEST_CASE( "Relay Fan-Out Benchmarks", "[LLP]")
+{
+    debug::log(0, "===== Begin Relay Fan-Out Benchmarks =====");
+
+    using TYPES = LLP::TritiumNode::TYPES;
+
+    //make sure we can open enough descriptors for the peers
+    struct rlimit rLimit;
+    if(getrlimit(RLIMIT_NOFILE, &rLimit) == 0)
+    {
+        rLimit.rlim_cur = rLimit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &rLimit);
+    }
+
+    //the subscription masks seen on a typical peer set
+    const std::vector<std::vector<uint8_t>> vMasks =
+    {
+        { TYPES::BLOCK, TYPES::BESTHEIGHT, TYPES::BESTCHAIN },
+        { TYPES::BLOCK, TYPES::TRANSACTION, TYPES::BESTHEIGHT, TYPES::BESTCHAIN },
+        { TYPES::BLOCK, TYPES::TRANSACTION, TYPES::BESTHEIGHT, TYPES::BESTCHAIN, TYPES::ADDRESS },
+        { TYPES::TRANSACTION },
+        { TYPES::BESTHEIGHT },
+    };
+
+    //a block is relayed as its block notification plus a batch of its transactions
+    const uint32_t nBlocks = 20;
+    std::vector<std::pair<uint16_t, DataStream>> vRelays;
+    for(uint32_t n = 0; n < nBlocks; n++)
+    {
+        DataStream ssBlock(SER_NETWORK, LLP::MIN_PROTO_VERSION);
+        ssBlock << uint8_t(TYPES::BLOCK) << LLC::GetRand1024();
+        ssBlock << uint8_t(TYPES::BESTHEIGHT) << uint32_t(n);
+        ssBlock << uint8_t(TYPES::BESTCHAIN) << LLC::GetRand1024();
+        vRelays.push_back(std::make_pair(uint16_t(LLP::TritiumNode::ACTION::NOTIFY), ssBlock));
+
+        DataStream ssTx(SER_NETWORK, LLP::MIN_PROTO_VERSION);
+        for(uint32_t i = 0; i < LLP::TritiumNode::ACTION::NOTIFY_MAX_ITEMS; i++)
+            ssTx << uint8_t(TYPES::TRANSACTION) << LLC::GetRand512();
+        vRelays.push_back(std::make_pair(uint16_t(LLP::TritiumNode::ACTION::NOTIFY), ssTx));
+    }
+
+    for(const uint32_t nPeers : {125u, 500u})
+    {
+        //filter and encode per peer as before, against encoding once per subscription mask
+        for(const bool fShared : {false, true})
+        {
+            std::vector<LLP::TritiumNode*> vPeers;
+            std::vector<int> vRemote;
+            for(uint32_t n = 0; n < nPeers; n++)
+            {
+                int vPair[2];
+                if(::socketpair(AF_UNIX, SOCK_STREAM, 0, vPair) != 0)
+                    break;
+
+                LLP::TritiumNode* pNode = new LLP::TritiumNode(LLP::Socket(vPair[0], LLP::BaseAddress()), nullptr, false);
+                subscribe(pNode, vMasks[LLC::GetRandInt(vMasks.size() - 1)]);
+
+                vPeers.push_back(pNode);
+                vRemote.push_back(vPair[1]);
+            }
+
+            const uint64_t nSentStart   = LLP::Socket::BYTES_SENT.load();
+            const uint64_t nCopiedStart = LLP::Socket::BYTES_COPIED.load();
+
+            const std::clock_t nStart = std::clock();
+
+            runtime::timer timer;
+            timer.Start();
+
+            uint64_t nEncoded = 0;
+            for(auto& qRelay : vRelays)
+            {
+                std::map<uint64_t, std::shared_ptr<const std::vector<uint8_t>>> mapFrames;
+                for(LLP::TritiumNode* pNode : vPeers)
+                {
+                    const uint64_t nKey = pNode->RelayKey();
+                    if(fShared && mapFrames.count(nKey))
+                    {
+                        if(mapFrames[nKey])
+                            pNode->WriteFrame(mapFrames[nKey]);
+
+                        continue;
+                    }
+
+                    qRelay.second.Reset();
+
+                    const DataStream ssRelay = pNode->RelayFilter(qRelay.first, qRelay.second);
+                    ++nEncoded;
+
+                    if(!fShared)
+                    {
+                        if(ssRelay.size() != 0)
+                            pNode->WritePacket(LLP::TritiumNode::NewMessage(qRelay.first, ssRelay));
+
+                        continue;
+                    }
+
+                    std::shared_ptr<const std::vector<uint8_t>> pFrame;
+                    if(ssRelay.size() != 0)
+                    {
+                        LLP::MessagePacket PACKET(qRelay.first);
+                        PACKET.SetData(ssRelay);
+
+                        pFrame = std::make_shared<const std::vector<uint8_t>>(PACKET.GetBytes());
+                        pNode->WriteFrame(pFrame);
+                    }
+
+                    mapFrames[nKey] = pFrame;
+                }
+            }
+
+            const uint64_t nTime = timer.ElapsedMicroseconds();
+            const double dCPU    = (std::clock() - nStart) * 1000000.0 / CLOCKS_PER_SEC;
+
+            //bytes copied into output queues for every byte the kernel took
+            const uint64_t nSent   = LLP::Socket::BYTES_SENT.load() - nSentStart;
+            const uint64_t nCopied = LLP::Socket::BYTES_COPIED.load() - nCopiedStart;
+
+            debug::log(0, ANSI_COLOR_BRIGHT_CYAN, (fShared ? "Shared::" : "Filter::"), ANSI_COLOR_RESET, vPeers.size(), " peers ",
+                nEncoded, " encodes in ", nTime, " microseconds, ", dCPU / nBlocks, " CPU microseconds / block, ",
+                double(nCopied) / std::max(nSent, uint64_t(1)), " bytes copied / byte sent");
+
+            for(LLP::TritiumNode* pNode : vPeers)
+                delete pNode;
+
+            for(const int nFd : vRemote)
+                ::close(nFd);
+        }
+    }
+
+    debug::log(0, "===== End Relay Fan-Out Benchmarks =====\n");
+}
@@ -0,0 +1,93 @@
+#include <Util/include/runtime.h>
+
+#include <LLC/include/random.h>
+
+#include <TAO/Ledger/types/mempool.h>
+#include <TAO/Ledger/types/transaction.h>
+
+#include <Util/include/debug.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <thread>
+
+
+TEST_CASE( "Mempool Concurrency Benchmarks", "[ledger]")
+{
+    debug::log(0, "===== Begin Mempool Concurrency Benchmarks =====");
+
+    //build our transactions up front so that hashing isn't part of the measurement
+    std::vector<TAO::Ledger::Transaction> vTx;
+    std::vector<uint512_t> vHashes;
+    std::vector<uint256_t> vGenesis;
+    for(uint32_t i = 0; i < 1000; i++)
+        vGenesis.push_back(LLC::GetRand256());
+
+    for(uint32_t i = 0; i < 50000; i++)
+    {
+        TAO::Ledger::Transaction tx;
+        tx.hashGenesis = vGenesis[i % vGenesis.size()];
+        tx.nSequence   = i / vGenesis.size();
+        tx.nTimestamp  = runtime::unifiedtimestamp();
+
+        vHashes.push_back(tx.GetHash());
+        vTx.push_back(tx);
+    }
+
+    //half the threads submit while the other half look up by txid and genesis, as with API and relay load
+    for(const uint32_t nThreads : {2u, 4u, 8u, 16u})
+    {
+        TAO::Ledger::Mempool* pool = new TAO::Ledger::Mempool();
+
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<std::thread> vThreads;
+        for(uint32_t t = 0; t < nThreads; t++)
+        {
+            vThreads.push_back(std::thread([&, t]()
+            {
+                const uint32_t nWriters = nThreads / 2;
+                if(t < nWriters)
+                {
+                    for(uint32_t i = t; i < vTx.size(); i += nWriters)
+                        pool->AddUnchecked(vTx[i]);
+                }
+                else
+                {
+                    TAO::Ledger::Transaction tx;
+                    for(uint32_t i = 0; i < vTx.size(); i++)
+                    {
+                        pool->Get(vHashes[i], tx);
+                        pool->Has(vGenesis[i % vGenesis.size()]);
+                    }
+                }
+            }));
+        }
+
+        for(auto& thread : vThreads)
+            thread.join();
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Submit/Lookup::", ANSI_COLOR_RESET, nThreads, " threads ",
+            (vTx.size() * nThreads) / double(nTime), " million operations / second");
+
+        //lookups of a sigchain's transactions go through the genesis index instead of scanning the pool
+        timer.Reset();
+
+        uint32_t nFound = 0;
+        for(const auto& hashGenesis : vGenesis)
+        {
+            std::vector<TAO::Ledger::Transaction> vList;
+            if(pool->Get(hashGenesis, vList))
+                nFound += vList.size();
+        }
+
+        nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Genesis::", ANSI_COLOR_RESET, vGenesis.size(), " sigchains ", nFound, " transactions in ", nTime, " microseconds");
+
+        delete pool;
+    }
+
+    debug::log(0, "===== End Mempool Concurrency Benchmarks =====\n");
+}
@@ -0,0 +1,103 @@
+#include <Util/include/runtime.h>
+
+#include <LLC/include/random.h>
+#include <LLC/hash/SK.h>
+#include <LLC/hash/macro.h>
+
+#include <TAO/Ledger/types/block.h>
+#include <TAO/Ledger/types/merkle_tree.h>
+
+#include <Util/include/debug.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <ctime>
+
+
+/* The merkle root as it was built before, one SK512 call per node on a single thread. */
+static uint512_t SerialRoot(const std::vector<uint512_t>& vLeaves)
+{
+    std::vector<uint512_t> vTree(vLeaves);
+
+    uint32_t j = 0;
+    for(uint32_t nSize = static_cast<uint32_t>(vLeaves.size()); nSize > 1; nSize = (nSize + 1) >> 1)
+    {
+        for(uint32_t i = 0; i < nSize; i += 2)
+        {
+            const uint512_t& hashLeft  = vTree[j + i];
+            const uint512_t& hashRight = vTree[j + std::min(i + 1, nSize - 1)];
+
+            vTree.push_back(LLC::SK512(BEGIN(hashLeft), END(hashLeft), BEGIN(hashRight), END(hashRight)));
+        }
+
+        j += nSize;
+    }
+
+    return (vTree.empty() ? 0 : vTree.back());
+}
+
+
+TEST_CASE( "Merkle Tree Benchmarks", "[ledger]")
+{
+    debug::log(0, "===== Begin Merkle Tree Benchmarks =====");
+
+    for(const uint32_t nLeaves : {1000u, 10000u, 100000u})
+    {
+        std::vector<uint512_t> vLeaves;
+        for(uint32_t n = 0; n < nLeaves; n++)
+            vLeaves.push_back(LLC::GetRand512());
+
+        //the single threaded build
+        uint512_t hashSerial;
+        {
+            const std::clock_t nStart = std::clock();
+            runtime::timer timer;
+            timer.Start();
+
+            hashSerial = SerialRoot(vLeaves);
+
+            debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Serial::", ANSI_COLOR_RESET, nLeaves, " leaves in ", timer.ElapsedMicroseconds(),
+                " microseconds (", double(std::clock() - nStart) * 1000000 / CLOCKS_PER_SEC, " CPU microseconds)");
+        }
+
+        //the full build in lanes and parallel chunks
+        TAO::Ledger::MerkleTree tree;
+        {
+            const std::clock_t nStart = std::clock();
+            runtime::timer timer;
+            timer.Start();
+
+            REQUIRE(tree.Build(vLeaves) == hashSerial);
+
+            debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Build::", ANSI_COLOR_RESET, nLeaves, " leaves in ", timer.ElapsedMicroseconds(),
+                " microseconds (", double(std::clock() - nStart) * 1000000 / CLOCKS_PER_SEC, " CPU microseconds)");
+        }
+
+        //a template update: the producer at the end is replaced and followed by newly added transactions
+        {
+            const uint32_t nUpdates = 100;
+
+            runtime::timer timer;
+            timer.Start();
+
+            for(uint32_t n = 0; n < nUpdates; n++)
+            {
+                vLeaves.back() = LLC::GetRand512();
+                vLeaves.push_back(LLC::GetRand512());
+
+                tree.Build(vLeaves);
+            }
+
+            debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Append::", ANSI_COLOR_RESET, nUpdates, " updates in ", timer.ElapsedMicroseconds(),
+                " microseconds (", double(timer.ElapsedMicroseconds()) / nUpdates, " per update)");
+
+            REQUIRE(tree.Root() == SerialRoot(vLeaves));
+        }
+
+        //branches fold back up to the same root
+        for(const uint32_t nIndex : {0u, nLeaves / 2, tree.Size() - 1})
+            REQUIRE(TAO::Ledger::Block::CheckMerkleBranch(vLeaves[nIndex], tree.Branch(nIndex), nIndex) == tree.Root());
+    }
+
+    debug::log(0, "===== End Merkle Tree Benchmarks =====\n");
+}
@@ -0,0 +1,92 @@
+#include <Util/include/runtime.h>
+#include <Util/include/memory.h>
+
+#include <LLC/include/random.h>
+
+#include <TAO/Ledger/types/state.h>
+#include <TAO/Ledger/include/enum.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <atomic>
+#include <thread>
+
+
+TEST_CASE( "Memory Snapshot Benchmarks", "[Util]")
+{
+    debug::log(0, "===== Begin Memory Snapshot Benchmarks =====");
+
+    //build a best block with a typical number of transaction proofs
+    TAO::Ledger::BlockState state;
+    state.nHeight = 100000;
+    for(uint32_t i = 0; i < 500; i++)
+        state.vtx.push_back(std::make_pair(TAO::Ledger::TRANSACTION::TRITIUM, LLC::GetRand512()));
+
+    memory::atomic<TAO::Ledger::BlockState>   atomicState(state);
+    memory::snapshot<TAO::Ledger::BlockState> snapshotState(state);
+
+    const uint32_t nReads = 100000;
+
+    //compare copying the state out under a lock against sharing the published copy as reader threads scale
+    for(const uint32_t nThreads : {1u, 2u, 4u, 8u, 16u})
+    {
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            std::atomic<uint64_t> nTotal(0);
+            std::vector<std::thread> vThreads;
+            for(uint32_t t = 0; t < nThreads; t++)
+            {
+                vThreads.push_back(std::thread([&]()
+                {
+                    uint64_t nHeights = 0;
+                    for(uint32_t n = 0; n < nReads; n++)
+                        nHeights += atomicState.load().nHeight;
+
+                    nTotal += nHeights;
+                }));
+            }
+
+            for(auto& thread : vThreads)
+                thread.join();
+
+            REQUIRE(nTotal.load() == uint64_t(nReads) * nThreads * state.nHeight);
+
+            uint64_t nTime = timer.ElapsedMicroseconds();
+            debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "atomic::load ", ANSI_COLOR_RESET, nThreads, " threads ",
+                (nReads * nThreads) / double(nTime), " million reads / second");
+        }
+
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            std::atomic<uint64_t> nTotal(0);
+            std::vector<std::thread> vThreads;
+            for(uint32_t t = 0; t < nThreads; t++)
+            {
+                vThreads.push_back(std::thread([&]()
+                {
+                    uint64_t nHeights = 0;
+                    for(uint32_t n = 0; n < nReads; n++)
+                        nHeights += snapshotState.get()->nHeight;
+
+                    nTotal += nHeights;
+                }));
+            }
+
+            for(auto& thread : vThreads)
+                thread.join();
+
+            REQUIRE(nTotal.load() == uint64_t(nReads) * nThreads * state.nHeight);
+
+            uint64_t nTime = timer.ElapsedMicroseconds();
+            debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "snapshot::get ", ANSI_COLOR_RESET, nThreads, " threads ",
+                (nReads * nThreads) / double(nTime), " million reads / second");
+        }
+    }
+
+
+    debug::log(0, "===== End Memory Snapshot Benchmarks =====\n");
+}
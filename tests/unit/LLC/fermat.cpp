@@ -18,6 +18,8 @@ ________________________________________________________________________________
 #include <openssl/bn.h>
 #include <unit/catch2/catch.hpp>
 
+#include <vector>
+
 /* Used after Miller-Rabin and Divisor tests to verify primality. */
 LLC::CBigNum FermatTest2(const LLC::CBigNum& bnPrime)
 {
@@ -82,3 +84,65 @@ TEST_CASE("Fermat Tests", "[LLC]")
 
 
 }
+
+
+/* Random odd modulus of the given number of bits, with the top bit set. */
+uint1024_t RandomModulus(const uint32_t nBits)
+{
+    uint1024_t p = LLC::GetRand1024();
+    if(nBits < 1024)
+        p &= (uint1024_t(1) << nBits) - 1;
+
+    p |= uint1024_t(1) << (nBits - 1);
+    p |= 1;
+
+    return p;
+}
+
+
+TEST_CASE("Montgomery Fermat Tests", "[LLC]")
+{
+    /* Edge moduli around the limb widths of the kernel. */
+    std::vector<uint1024_t> vEdges =
+    {
+        uint1024_t(3), uint1024_t(5), uint1024_t(0xffffffffffffffc5),
+        (uint1024_t(1) << 64) - 1, (uint1024_t(1) << 64) + 1,
+        (uint1024_t(1) << 128) - 1, (uint1024_t(1) << 128) + 1,
+        (uint1024_t(1) << 1023) + 1, ~uint1024_t(0), ~uint1024_t(0) - 2
+    };
+
+    for(const auto& p : vEdges)
+        REQUIRE(fermat_remainder(p).GetHex() == FermatTest2(LLC::CBigNum(p)).getuint1024().GetHex());
+
+    /* Random moduli at every limb boundary and the bit widths just around it. */
+    for(uint32_t nLimb = 1; nLimb <= 16; ++nLimb)
+    {
+        for(const uint32_t nBits : { nLimb * 64 - 1, nLimb * 64, nLimb * 64 + 1 })
+        {
+            if(nBits < 2 || nBits > 1024)
+                continue;
+
+            for(uint32_t i = 0; i < 20; ++i)
+            {
+                const uint1024_t p = RandomModulus(nBits);
+                REQUIRE(fermat_remainder(p).GetHex() == FermatTest2(LLC::CBigNum(p)).getuint1024().GetHex());
+            }
+        }
+    }
+
+    /* Random moduli of any width. */
+    for(uint32_t i = 0; i < 1000; ++i)
+    {
+        const uint1024_t p = RandomModulus(2 + LLC::GetRandInt(1023));
+        REQUIRE(fermat_remainder(p).GetHex() == FermatTest2(LLC::CBigNum(p)).getuint1024().GetHex());
+    }
+
+    /* The cluster kernel gives the same remainders as one at a time. */
+    uint1024_t vModuli[16], vRemainders[16];
+    for(uint32_t i = 0; i < 16; ++i)
+        vModuli[i] = RandomModulus(1024 - i);
+
+    fermat_cluster(vModuli, vRemainders, 16);
+    for(uint32_t i = 0; i < 16; ++i)
+        REQUIRE(vRemainders[i] == fermat_remainder(vModuli[i]));
+}
@@ -0,0 +1,172 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/API/include/extract.h>
+#include <TAO/API/include/filter.h>
+#include <TAO/API/include/json.h>
+
+#include <TAO/API/types/cache.h>
+#include <TAO/API/types/query.h>
+
+#include <TAO/Register/types/object.h>
+
+#include <unit/catch2/catch.hpp>
+
+using namespace TAO::API;
+using namespace TAO::Register;
+
+
+/* Builds the registers we list, with no ties in any column we sort by. */
+static std::vector<Object> QueryObjects()
+{
+    std::vector<Object> vObjects;
+    for(uint64_t n = 0; n < 50; ++n)
+    {
+        Object tObject;
+        tObject << std::string("value") << uint8_t(TYPES::MUTABLE) << uint8_t(TYPES::UINT64_T) << uint64_t((n * 37) % 50)
+                << std::string("label") << uint8_t(TYPES::STRING)  << std::string("item" + std::to_string((n * 13) % 50));
+
+        tObject.nVersion  = 1 + (n * 11) % 50;
+        tObject.nCreated  = 1000 + (n * 13) % 50;
+        tObject.nModified = 2000 + (n * 29) % 50;
+
+        REQUIRE(tObject.Parse());
+        vObjects.push_back(tObject);
+    }
+
+    return vObjects;
+}
+
+
+/* Builds the parameters of a register/list/objects request. */
+static encoding::json QueryParams(const std::string& strWhere, const std::string& strSort, const std::string& strOrder,
+                                  const std::string& strLimit, const std::string& strOffset)
+{
+    encoding::json jParams;
+    jParams["request"]["commands"] = "register";
+    jParams["request"]["type"]     = "object";
+
+    if(!strWhere.empty())
+        jParams["where"] = QueryToJSON(strWhere);
+
+    jParams["sort"]   = strSort;
+    jParams["order"]  = strOrder;
+    jParams["limit"]  = strLimit;
+    jParams["offset"] = strOffset;
+
+    return jParams;
+}
+
+
+/* Pages results the way Base::Execute does. */
+static encoding::json QueryPage(const encoding::json& jParams, const encoding::json& jResults)
+{
+    uint32_t nLimit = 100, nOffset = 0;
+    ExtractList(jParams, nLimit, nOffset);
+
+    encoding::json jPage = encoding::json::array();
+    for(uint32_t n = nOffset; n < jResults.size() && jPage.size() < nLimit; ++n)
+        jPage.push_back(jResults[n]);
+
+    return jPage;
+}
+
+
+/* Gets a page through the query plan, the way register/list reads it. */
+static encoding::json PlannedPage(encoding::json jParams, const uint8_t nSettings)
+{
+    REQUIRE(QueryPlan::Prepare(jParams, nSettings, "modified"));
+
+    QueryPlan tPlan(jParams);
+    for(auto& tObject : QueryObjects())
+    {
+        if(!tPlan.Insert(tObject))
+            break;
+    }
+
+    encoding::json jResults = tPlan.Results();
+    ResponseCache(CacheSettings(nSettings, "modified")).Sort(jParams, jResults);
+
+    return QueryPage(jParams, jResults);
+}
+
+
+/* Gets a page by encoding, sorting and filtering every register. */
+static encoding::json UnplannedPage(const encoding::json& jParams, const uint8_t nSettings)
+{
+    QueryPlan tPlan(jParams);
+    for(auto& tObject : QueryObjects())
+        tPlan.Insert(tObject);
+
+    encoding::json jResults = tPlan.Results();
+    ResponseCache(CacheSettings(nSettings, "modified")).Sort(jParams, jResults);
+
+    encoding::json jFiltered = encoding::json::array();
+    for(auto& jItem : jResults)
+    {
+        if(FilterResults(jParams, jItem))
+            jFiltered.push_back(jItem);
+    }
+
+    return QueryPage(jParams, jFiltered);
+}
+
+
+TEST_CASE( "Query plan pages match unplanned pages", "[API]" )
+{
+    /* The settings of register/list. */
+    const uint8_t nSettings = ENABLE::CACHING | ENABLE::PAGING | ENABLE::SORTING | ENABLE::FILTERS
+                            | ENABLE::QUERIES | ENABLE::OPERATORS | ENABLE::PLANNING;
+
+    /* Where clause sorted by a register header. */
+    {
+        const encoding::json jParams = QueryParams("results.value>20", "created", "asc", "5", "3");
+
+        const encoding::json jPage = UnplannedPage(jParams, nSettings);
+        REQUIRE(jPage.size() == 5);
+        REQUIRE(PlannedPage(jParams, nSettings) == jPage);
+    }
+
+    /* Where clause sorted by a member. */
+    {
+        const encoding::json jParams = QueryParams("results.value<30", "value", "desc", "10", "0");
+
+        const encoding::json jPage = UnplannedPage(jParams, nSettings);
+        REQUIRE(jPage.size() == 10);
+        REQUIRE(PlannedPage(jParams, nSettings) == jPage);
+    }
+
+    /* Where clause on a register header with a page past the end. */
+    {
+        const encoding::json jParams = QueryParams("results.modified>2040", "version", "desc", "4", "8");
+
+        const encoding::json jPage = UnplannedPage(jParams, nSettings);
+        REQUIRE(jPage.size() == 1);
+        REQUIRE(PlannedPage(jParams, nSettings) == jPage);
+    }
+
+    /* No where clause sorted by a register header. */
+    {
+        const encoding::json jParams = QueryParams("", "modified", "desc", "7", "14");
+
+        const encoding::json jPage = UnplannedPage(jParams, nSettings);
+        REQUIRE(jPage.size() == 7);
+        REQUIRE(PlannedPage(jParams, nSettings) == jPage);
+    }
+
+    /* No where clause sorted by a member keeps the cached full dataset. */
+    {
+        encoding::json jParams = QueryParams("", "value", "asc", "7", "14");
+        REQUIRE_FALSE(QueryPlan::Prepare(jParams, nSettings, "modified"));
+    }
+}
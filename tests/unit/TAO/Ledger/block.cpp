@@ -11,6 +11,8 @@
 
 ____________________________________________________________________________________________*/
 
+#include <LLC/include/random.h>
+
 #include <TAO/Ledger/types/block.h>
 #include <TAO/Ledger/types/tritium.h>
 #include <TAO/Ledger/types/state.h>
@@ -185,3 +187,40 @@ TEST_CASE( "Prime Calculation - Nonce Endianness (PR #128)", "[ledger][prime][en
         REQUIRE(nPrime == nProofHash);
     }
 }
+
+
+TEST_CASE( "BlockState GetHashes matches GetHash", "[ledger]")
+{
+    /* Headers of every hashing rule, with offsets long enough to span more than one skein block. */
+    std::vector<TAO::Ledger::BlockState> vStates;
+    for(uint32_t n = 0; n < 60; ++n)
+    {
+        TAO::Ledger::BlockState state;
+        state.nVersion       = 3 + (n % 7);
+        state.hashPrevBlock  = LLC::GetRand1024();
+        state.hashMerkleRoot = LLC::GetRand512();
+        state.nChannel       = n % 3;
+        state.nHeight        = 1000 + n;
+        state.nBits          = 0x7b000000 + n;
+        state.nNonce         = LLC::GetRand();
+        state.nTime          = 1500000000 + n;
+
+        if(state.nVersion >= 7)
+            state.vOffsets.resize((n * 17) % 120, uint8_t(n));
+
+        vStates.push_back(state);
+    }
+
+    std::vector<uint1024_t> vHashes;
+    TAO::Ledger::BlockState::GetHashes(vStates, vHashes);
+
+    REQUIRE(vHashes.size() == vStates.size());
+    for(uint32_t n = 0; n < vStates.size(); ++n)
+    {
+        REQUIRE(vHashes[n] == vStates[n].GetHash());
+
+        /* The signature hash is the block hash from version 5. */
+        if(vStates[n].nVersion >= 5)
+            REQUIRE(vStates[n].SignatureHash() == vHashes[n]);
+    }
+}
@@ -0,0 +1,260 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2025
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+#include <LLC/hash/macro.h>
+#include <LLC/include/random.h>
+
+#include <LLP/include/validation_thread_pool.h>
+
+#include <TAO/Ledger/types/block.h>
+#include <TAO/Ledger/types/merkle_tree.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+/* The merkle root the way Block::BuildMerkleTree computed it before the incremental tree. */
+static uint512_t ScalarMerkleRoot(const std::vector<uint512_t>& vtx)
+{
+    std::vector<uint512_t> vMerkleTree(vtx.begin(), vtx.end());
+
+    uint32_t j = 0;
+    for(uint32_t nSize = static_cast<uint32_t>(vtx.size()); nSize > 1; nSize = (nSize + 1) >> 1)
+    {
+        for(uint32_t i = 0; i < nSize; i += 2)
+        {
+            const uint512_t hashLeft  = vMerkleTree[j + i];
+            const uint512_t hashRight = vMerkleTree[j + std::min(i + 1, nSize - 1)];
+
+            vMerkleTree.push_back(LLC::SK512(BEGIN(hashLeft), END(hashLeft), BEGIN(hashRight), END(hashRight)));
+        }
+
+        j += nSize;
+    }
+
+    return (vMerkleTree.empty() ? 0 : vMerkleTree.back());
+}
+
+
+/* Builds a list of random leaves. */
+static std::vector<uint512_t> RandomLeaves(const uint32_t nCount)
+{
+    std::vector<uint512_t> vLeaves;
+    for(uint32_t n = 0; n < nCount; ++n)
+        vLeaves.push_back(LLC::GetRand512());
+
+    return vLeaves;
+}
+
+
+/* Checks the root and every branch of a tree against the scalar path. */
+static void CheckTree(const TAO::Ledger::MerkleTree& tTree, const std::vector<uint512_t>& vLeaves)
+{
+    REQUIRE(tTree.Size() == vLeaves.size());
+    REQUIRE(tTree.Root() == ScalarMerkleRoot(vLeaves));
+
+    for(uint32_t n = 0; n < vLeaves.size(); n += std::max<uint32_t>(1, vLeaves.size() / 7))
+        REQUIRE(TAO::Ledger::Block::CheckMerkleBranch(vLeaves[n], tTree.Branch(n), n) == tTree.Root());
+}
+
+
+TEST_CASE( "SK512Pairs matches scalar SK512", "[ledger]")
+{
+    for(uint32_t nPairs = 0; nPairs <= 37; ++nPairs)
+    {
+        const std::vector<uint512_t> vHashes = RandomLeaves(nPairs * 2);
+
+        /* The scalar pair hashes. */
+        std::vector<uint512_t> vExpected(nPairs);
+        for(uint32_t n = 0; n < nPairs; ++n)
+            vExpected[n] = LLC::SK512(BEGIN(vHashes[2 * n]), END(vHashes[2 * n]), BEGIN(vHashes[2 * n + 1]), END(vHashes[2 * n + 1]));
+
+        /* Every lane width, falling back to the widest supported. */
+        for(const uint32_t nLanes : {0u, 1u, 4u, 8u})
+        {
+            std::vector<uint512_t> vParents(nPairs);
+            LLC::SK512Pairs(vHashes.data(), nPairs, vParents.data(), nLanes);
+
+            REQUIRE(vParents == vExpected);
+        }
+    }
+}
+
+
+TEST_CASE( "SK1024 batch matches scalar SK1024", "[ledger]")
+{
+    /* Messages of mixed lengths, so lanes group by block count and leave partial groups. */
+    std::vector<std::vector<uint8_t>> vData;
+    for(uint32_t n = 0; n < 45; ++n)
+    {
+        const uint32_t nSize = (n % 5 == 0) ? 0 : (n * 37) % 400;
+
+        std::vector<uint8_t> vMessage(nSize);
+        for(uint32_t i = 0; i < nSize; ++i)
+            vMessage[i] = static_cast<uint8_t>(LLC::GetRand(256));
+
+        vData.push_back(vMessage);
+    }
+
+    for(const uint32_t nLanes : {0u, 1u, 4u, 8u})
+    {
+        std::vector<uint1024_t> vHashes;
+        LLC::SK1024(vData, vHashes, nLanes);
+
+        REQUIRE(vHashes.size() == vData.size());
+        for(uint32_t n = 0; n < vData.size(); ++n)
+            REQUIRE(vHashes[n] == LLC::SK1024(vData[n].begin(), vData[n].end()));
+    }
+}
+
+
+TEST_CASE( "MerkleTree matches scalar merkle root", "[ledger]")
+{
+    /* Empty and single leaf trees. */
+    {
+        TAO::Ledger::MerkleTree tTree;
+        REQUIRE(tTree.Build(std::vector<uint512_t>()) == 0);
+
+        const std::vector<uint512_t> vLeaves = RandomLeaves(1);
+        REQUIRE(tTree.Build(vLeaves) == vLeaves[0]);
+        CheckTree(tTree, vLeaves);
+    }
+
+    /* Odd and even counts from scratch. */
+    for(uint32_t nCount = 2; nCount <= 67; ++nCount)
+    {
+        const std::vector<uint512_t> vLeaves = RandomLeaves(nCount);
+
+        TAO::Ledger::MerkleTree tTree;
+        REQUIRE(tTree.Build(vLeaves) == ScalarMerkleRoot(vLeaves));
+        CheckTree(tTree, vLeaves);
+    }
+
+    /* Append one leaf at a time to the same tree. */
+    {
+        TAO::Ledger::MerkleTree tTree;
+
+        std::vector<uint512_t> vLeaves;
+        for(uint32_t n = 0; n < 40; ++n)
+        {
+            vLeaves.push_back(LLC::GetRand512());
+            REQUIRE(tTree.Build(vLeaves) == ScalarMerkleRoot(vLeaves));
+        }
+
+        CheckTree(tTree, vLeaves);
+    }
+
+    /* Shrink the same tree down past level boundaries. */
+    {
+        std::vector<uint512_t> vLeaves = RandomLeaves(33);
+
+        TAO::Ledger::MerkleTree tTree;
+        tTree.Build(vLeaves);
+
+        for(const uint32_t nCount : {32u, 17u, 16u, 9u, 3u, 2u, 1u})
+        {
+            vLeaves.resize(nCount);
+            REQUIRE(tTree.Build(vLeaves) == ScalarMerkleRoot(vLeaves));
+            CheckTree(tTree, vLeaves);
+        }
+    }
+
+    /* Mutate the first, middle and last leaves of the same tree. */
+    {
+        std::vector<uint512_t> vLeaves = RandomLeaves(29);
+
+        TAO::Ledger::MerkleTree tTree;
+        tTree.Build(vLeaves);
+
+        for(const uint32_t nIndex : {0u, 14u, 28u})
+        {
+            vLeaves[nIndex] = LLC::GetRand512();
+            REQUIRE(tTree.Build(vLeaves) == ScalarMerkleRoot(vLeaves));
+            CheckTree(tTree, vLeaves);
+        }
+
+        /* Rebuilding the same leaves keeps the root. */
+        REQUIRE(tTree.Build(vLeaves) == ScalarMerkleRoot(vLeaves));
+    }
+
+    /* Copies are independent of the tree they came from. */
+    {
+        std::vector<uint512_t> vLeaves = RandomLeaves(12);
+
+        TAO::Ledger::MerkleTree tTree;
+        tTree.Build(vLeaves);
+
+        TAO::Ledger::MerkleTree tCopy = tTree;
+        vLeaves[5] = LLC::GetRand512();
+
+        REQUIRE(tCopy.Build(vLeaves) == ScalarMerkleRoot(vLeaves));
+        REQUIRE(tTree.Root() != tCopy.Root());
+
+        tTree.Clear();
+        REQUIRE(tTree.Size() == 0);
+        REQUIRE(tTree.Root() == 0);
+    }
+}
+
+
+TEST_CASE( "MerkleTree matches scalar merkle root over the validation pool", "[ledger]")
+{
+    /* The pool is started with the network in LLP::Initialize. */
+    REQUIRE(LLP::GetValidationPool() != nullptr);
+
+    /* Levels larger than a slice are hashed over the pool. */
+    const uint32_t nCount = TAO::Ledger::MERKLE_PARALLEL_PAIRS * 5 + 3;
+
+    std::vector<uint512_t> vLeaves = RandomLeaves(nCount);
+
+    TAO::Ledger::MerkleTree tTree;
+    REQUIRE(tTree.Build(vLeaves) == ScalarMerkleRoot(vLeaves));
+
+    /* Change a leaf in the first slice so every slice of the bottom level is rehashed. */
+    vLeaves[7] = LLC::GetRand512();
+    REQUIRE(tTree.Build(vLeaves) == ScalarMerkleRoot(vLeaves));
+
+    /* Change a leaf in the last slice so only part of a slice is rehashed. */
+    vLeaves[nCount - 2] = LLC::GetRand512();
+    REQUIRE(tTree.Build(vLeaves) == ScalarMerkleRoot(vLeaves));
+
+    /* Grow and shrink across slice boundaries. */
+    vLeaves.resize(nCount + TAO::Ledger::MERKLE_PARALLEL_PAIRS * 2 + 1, 1);
+    REQUIRE(tTree.Build(vLeaves) == ScalarMerkleRoot(vLeaves));
+
+    vLeaves.resize(TAO::Ledger::MERKLE_PARALLEL_PAIRS * 2 + 5);
+    REQUIRE(tTree.Build(vLeaves) == ScalarMerkleRoot(vLeaves));
+    CheckTree(tTree, vLeaves);
+}
+
+
+TEST_CASE( "Block BuildMerkleTree matches scalar merkle root", "[ledger]")
+{
+    TAO::Ledger::Block block;
+
+    /* The block's tree is reused between builds of different lists. */
+    for(const uint32_t nCount : {5u, 6u, 11u, 3u, 11u})
+    {
+        const std::vector<uint512_t> vLeaves = RandomLeaves(nCount);
+        REQUIRE(block.BuildMerkleTree(vLeaves) == ScalarMerkleRoot(vLeaves));
+
+        std::vector<std::pair<uint8_t, uint512_t>> vtx;
+        for(const auto& hash : vLeaves)
+            vtx.push_back(std::make_pair(uint8_t(0), hash));
+
+        REQUIRE(block.BuildMerkleTree(vtx) == ScalarMerkleRoot(vLeaves));
+
+        for(uint32_t n = 0; n < nCount; ++n)
+            REQUIRE(TAO::Ledger::Block::CheckMerkleBranch(vLeaves[n], block.GetMerkleBranch(vLeaves, n), n) == ScalarMerkleRoot(vLeaves));
+    }
+}
@@ -18,6 +18,8 @@ ________________________________________________________________________________
 #include <unit/catch2/catch.hpp>
 #include <openssl/bn.h>
 #include <cstring>
+#include <set>
+#include <vector>
 
 
 const LLC::CBigNum bnPrimes[11] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31 };
@@ -264,3 +266,80 @@ TEST_CASE("GetPrimeDifficulty 4-byte fractional round-trip", "[prime][roundtrip]
         REQUIRE(std::abs(fFrac - fExpectedRemainder) < 1e-6);
     }
 }
+
+
+TEST_CASE("PrimeCheck and PrimeCluster match the bignum path", "[prime][cluster]")
+{
+    /* The prime origin of a mainnet block, with primes at offsets 0, 12, 18, 24, 34, 40 and 42 up to 46. */
+    const uint1024_t hashOrigin = uint1024_t("0x010009f035e34e85a13fe2c51d56d96781ace0b2df31fecff9ff09094e7772db452d335fe59dfaab61a6bafcf399a5705e98a9b2e1b368e37d267f76693388ffe8255177a734eb77ceac385f0a994288f24bc2526d4c53499aaf270232eb9d31f6ee6c78627bbd490ac899c5a814d861acafd17f51882e68dc01f7330db013cc")
+                                + uint64_t(5190024797402611181);
+
+    SECTION("Known offsets of a mainnet cluster")
+    {
+        const std::set<uint32_t> setPrimes = { 0, 12, 18, 24, 34, 40, 42 };
+
+        /* Every even offset up to 46, more than a batch of candidates. */
+        std::vector<uint1024_t> vCandidates;
+        uint32_t nPrimes = 0;
+        for(uint32_t nOffset = 0; nOffset <= 46; nOffset += 2)
+        {
+            const uint1024_t hashTest = hashOrigin + nOffset;
+
+            const bool fPrime = PrimeCheck2(CBigNum(hashTest), 1);
+            REQUIRE(fPrime == (setPrimes.count(nOffset) == 1));
+            REQUIRE(TAO::Ledger::PrimeCheck(hashTest) == fPrime);
+
+            vCandidates.push_back(hashTest);
+            if(fPrime)
+                ++nPrimes;
+        }
+        REQUIRE(nPrimes == setPrimes.size());
+
+        /* Check the candidates a batch at a time. */
+        uint32_t nCluster = 0;
+        for(uint32_t n = 0; n < vCandidates.size(); n += TAO::Ledger::PRIME_CLUSTER_BATCH)
+        {
+            const uint32_t nCount = std::min<uint32_t>(TAO::Ledger::PRIME_CLUSTER_BATCH, vCandidates.size() - n);
+            nCluster += TAO::Ledger::PrimeCluster(&vCandidates[n], nCount);
+        }
+
+        REQUIRE(nCluster == nPrimes);
+    }
+
+    SECTION("Random clusters")
+    {
+        for(uint32_t i = 0; i < 50; ++i)
+        {
+            /* Start from a random odd number so every candidate is odd. */
+            const uint1024_t hashBase = GetRand1024() |= 1;
+
+            uint1024_t vCandidates[TAO::Ledger::PRIME_CLUSTER_BATCH];
+            uint32_t nPrimes = 0;
+            for(uint32_t n = 0; n < TAO::Ledger::PRIME_CLUSTER_BATCH; ++n)
+            {
+                vCandidates[n] = hashBase + (n * 2);
+                if(PrimeCheck2(CBigNum(vCandidates[n]), 1))
+                    ++nPrimes;
+            }
+
+            REQUIRE(TAO::Ledger::PrimeCluster(vCandidates, TAO::Ledger::PRIME_CLUSTER_BATCH) == nPrimes);
+        }
+    }
+
+    SECTION("Small primes and composites")
+    {
+        /* The small divisor primes themselves are rejected by both paths. */
+        uint1024_t vCandidates[TAO::Ledger::PRIME_CLUSTER_BATCH];
+        uint32_t nPrimes = 0;
+        for(uint32_t n = 0; n < TAO::Ledger::PRIME_CLUSTER_BATCH; ++n)
+        {
+            vCandidates[n] = uint1024_t(1 + n * 2);
+            if(PrimeCheck2(CBigNum(vCandidates[n]), 1))
+                ++nPrimes;
+
+            REQUIRE(TAO::Ledger::PrimeCheck(vCandidates[n]) == PrimeCheck2(CBigNum(vCandidates[n]), 1));
+        }
+
+        REQUIRE(TAO::Ledger::PrimeCluster(vCandidates, TAO::Ledger::PRIME_CLUSTER_BATCH) == nPrimes);
+    }
+}